@@ -1,13 +1,17 @@
 #include "bfgenerator.ih"
 
-std::string BFGenerator::setToValue(int const addr, int const val)
+std::string BFGenerator::setToValue(int const addr, long const val)
 {
     validateAddr(addr);
 
     std::ostringstream ops;
     ops << movePtr(addr)        // go to address
-        << "[-]"                   // reset cell to 0
-        << std::string(val, '+');  // increment to value
+        << "[-]";                  // reset cell to 0
+
+    if (val >= 0 && static_cast<unsigned long>(val) <= MAX_UNARY_CONST)
+        ops << std::string(val, '+');  // increment to value
+    else
+        ops << addConst(addr, val);
 
     return ops.str();
 }
@@ -24,7 +28,7 @@ std::string BFGenerator::setToValuePlus(int const addr, int const val)
     return ops.str();
 }
 
-std::string BFGenerator::setToValue(int const start, int const val, size_t const n)
+std::string BFGenerator::setToValue(int const start, long const val, size_t const n)
 {
     validateAddr(start);
     
@@ -63,6 +67,230 @@ std::string BFGenerator::print(int const addr)
     return ops.str();
 }
 
+std::string BFGenerator::printConstants(int const cell, std::vector<int> const &deltas)
+{
+    // Prints a sequence of known characters from a single cell, given the difference
+    // between each character and the previous one (starting from 0). The first (and
+    // typically largest) step is taken by a multiplication-loop on a scratch-cell when
+    // this is shorter than incrementing all the way.
+    validateAddr(cell);
+
+    std::ostringstream ops;
+    ops << setToValue(cell, 0);
+
+    for (size_t i = 0; i != deltas.size(); ++i)
+    {
+        int const delta = deltas[i];
+        int const amount = std::abs(delta);
+        int const sign = (delta < 0) ? -1 : 1;
+
+        int bestFactor = 1;
+        if (i == 0)
+        {
+            int const scratch = getTemp(cell);
+            int const dist = std::abs(scratch - cell);
+            int bestCost = amount;
+            for (int factor = 2; factor * factor <= amount; ++factor)
+            {
+                int const times = amount / factor;
+                int const rest = amount - factor * times;
+                int const cost = factor + times + rest + 3 + 4 * dist;
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestFactor = factor;
+                }
+            }
+
+            if (bestFactor > 1)
+            {
+                ops << setToValue(scratch, bestFactor)
+                    << "["
+                    <<     addConst(cell, sign * (amount / bestFactor))
+                    <<     decr(scratch)
+                    << "]";
+            }
+        }
+
+        int const rest = (bestFactor > 1) ? (amount % bestFactor) : amount;
+        ops << addConst(cell, sign * rest)
+            << print(cell);
+    }
+
+    return ops.str();
+}
+
+std::string BFGenerator::printUntilZero(int const start, int const n)
+{
+    // Prints up to n cells, stopping at the first zero. A flag is moved into a second
+    // cell before each element, such that the element can be tested (and the flag
+    // restored) inside a loop that always terminates on the emptied cell.
+    validateAddr(start);
+
+    int const block = getTempBlock(4, start);
+    int const flag = block + 0;
+    int const test = block + 1;
+    int const tmp1 = block + 2;
+    int const tmp2 = block + 3;
+
+    std::ostringstream ops;
+    ops << setToValue(flag, 1)
+        << setToValue(test, 0)
+        << setToValue(tmp1, 0)
+        << setToValue(tmp2, 0);
+
+    for (int i = 0; i != n; ++i)
+    {
+        int const elem = start + i;
+        ops << movePtr(flag)
+            << "["
+            <<     incr(test)
+            <<     decr(flag)
+            << "]"
+            << movePtr(test)
+            << "["
+            <<     decr(test)
+            <<     movePtr(elem)
+            <<     "["
+            <<         incr(tmp1)
+            <<         incr(tmp2)
+            <<         decr(elem)
+            <<     "]"
+            <<     movePtr(tmp1)
+            <<     "["
+            <<         incr(elem)
+            <<         decr(tmp1)
+            <<     "]"
+            <<     movePtr(tmp2)
+            <<     "["
+            <<         setToValue(tmp2, 0)
+            <<         incr(flag)
+            <<         print(elem)
+            <<         movePtr(tmp2)
+            <<     "]"
+            <<     movePtr(test)
+            << "]";
+    }
+
+    ops << setToValue(flag, 0);
+    return ops.str();
+}
+
+std::string BFGenerator::printDecimal(int const value, int const digits)
+{
+    // The digits are split off by repeated division by 10 (the last one holding the
+    // most significant digit) and printed from the most significant one onwards.
+    validateAddr(value);
+
+    int const block = getTempBlock(digits + 3, value);
+    int const flag  = block + digits;
+    int const tmp1  = block + digits + 1;
+    int const tmp2  = block + digits + 2;
+
+    std::ostringstream ops;
+    ops << assign(block + digits - 1, value)
+        << setToValue(flag, 0)
+        << setToValue(tmp1, 0)
+        << setToValue(tmp2, 0);
+
+    for (int i = 0; i != digits - 1; ++i)
+        ops << divmodConst(block + digits - 1, 10, block + digits - 1, block + i);
+
+    ops << printDigits(block, digits);
+    return ops.str();
+}
+
+std::string BFGenerator::printDigits(int const block, int const digits)
+{
+    // Prints the decimal digits in the block (least significant first), which is
+    // followed by a flag and two scratch-cells that are all zero. A flag is raised
+    // at the first nonzero digit to suppress leading zeros; the least significant
+    // digit is always printed. The block is cleared in the process.
+    int const flag = block + digits;
+    int const tmp1 = block + digits + 1;
+    int const tmp2 = block + digits + 2;
+
+    std::ostringstream ops;
+    for (int i = digits - 1; i != 0; --i)
+    {
+        int const digit = block + i;
+        ops << movePtr(digit)
+            << "["
+            <<     incr(tmp1)
+            <<     incr(tmp2)
+            <<     decr(digit)
+            << "]"
+            << movePtr(tmp1)
+            << "["
+            <<     setToValue(flag, 1)
+            <<     setToValue(tmp1, 0)
+            << "]"
+            << movePtr(flag)
+            << "["
+            <<     incr(tmp1)
+            <<     incr(digit)
+            <<     decr(flag)
+            << "]"
+            << movePtr(digit)
+            << "["
+            <<     incr(flag)
+            <<     decr(digit)
+            << "]"
+            << movePtr(tmp1)
+            << "["
+            <<     addConst(tmp2, '0')
+            <<     print(tmp2)
+            <<     setToValue(tmp1, 0)
+            << "]"
+            << setToValue(tmp2, 0);
+    }
+
+    ops << addConst(block, '0')
+        << print(block)
+        << setToValue(block, 0)
+        << setToValue(flag, 0);
+
+    return ops.str();
+}
+
+std::string BFGenerator::scanDecimal(int const result)
+{
+    // Reads digits up to a newline, multiplying the result by 10 before adding each.
+    validateAddr(result);
+
+    int const block = getTempBlock(2, result);
+    int const ch  = block + 0;
+    int const tmp = block + 1;
+
+    std::ostringstream ops;
+    ops << setToValue(result, 0)
+        << setToValue(tmp, 0)
+        << scan(ch)
+        << addConst(ch, -'\n')
+        << "["
+        <<     addConst(ch, '\n' - '0')
+        <<     movePtr(result)
+        <<     "["
+        <<         incr(tmp)
+        <<         decr(result)
+        <<     "]"
+        <<     movePtr(tmp)
+        <<     "["
+        <<         addConst(result, 10)
+        <<         decr(tmp)
+        <<     "]"
+        <<     movePtr(ch)
+        <<     "["
+        <<         incr(result)
+        <<         decr(ch)
+        <<     "]"
+        <<     scan(ch)
+        <<     addConst(ch, -'\n')
+        << "]";
+
+    return ops.str();
+}
+
 std::string BFGenerator::random(int const addr)
 {
     std::ostringstream ops;
@@ -76,7 +304,7 @@ std::string BFGenerator::assign(int const lhs, int const rhs)
 {
     validateAddr(lhs, rhs);
     
-    int const tmp = f_getTemp();
+    int const tmp = getTemp(lhs, rhs);
         
     std::ostringstream ops;
     ops    << setToValue(lhs, 0)
@@ -103,34 +331,130 @@ std::string BFGenerator::assign(int const lhs, int const rhs)
     return ops.str();
 }
 
+std::string BFGenerator::move(int const lhs, int const rhs)
+{
+    // Like assign, but rhs is cleared in the process rather than restored
+    validateAddr(lhs, rhs);
+
+    std::ostringstream ops;
+    ops << setToValue(lhs, 0)
+        << movePtr(rhs)
+        << "["
+        <<     incr(lhs)
+        <<     decr(rhs)
+        << "]"
+        << movePtr(lhs);
+
+    return ops.str();
+}
+
 std::string BFGenerator::movePtr(int const addr)
 {
     validateAddr(addr);
 
+    int const from = d_pointer;
     ++d_profile[addr];
+    if (from != addr)
+        ++d_transitions[{from, addr}];
+    if (d_checkpoints > 0)
+        d_profileLog.push_back({from, addr});
+    
     int const diff = (int)addr - (int)d_pointer;
     d_pointer = addr;
     return (diff >= 0) ? std::string(diff, '>') : std::string(-diff, '<');
 }
 
-std::string BFGenerator::addConst(int const target, int const amount)
+BFGenerator::Checkpoint BFGenerator::checkpoint()
+{
+    ++d_checkpoints;
+    return {
+            .pointer        = d_pointer,
+            .profileLogSize = d_profileLog.size()
+    };
+}
+
+void BFGenerator::rollback(Checkpoint const &cp)
+{
+    while (d_profileLog.size() > cp.profileLogSize)
+    {
+        auto const [from, to] = d_profileLog.back();
+        auto const it = d_profile.find(to);
+        if (--(it->second) == 0)
+            d_profile.erase(it);
+
+        if (from != to)
+        {
+            auto const move = d_transitions.find({from, to});
+            if (--(move->second) == 0)
+                d_transitions.erase(move);
+        }
+        d_profileLog.pop_back();
+    }
+
+    d_pointer = cp.pointer;
+    commit(cp);
+}
+
+void BFGenerator::commit(Checkpoint const &)
+{
+    assert(d_checkpoints > 0 && "commit without matching checkpoint");
+    if (--d_checkpoints == 0)
+        d_profileLog.clear();
+}
+
+bool BFGenerator::visited(Checkpoint const &cp, int const first, int const last) const
+{
+    // Whether the pointer was moved to any address in [first, last) since the checkpoint
+    assert(d_checkpoints > 0 && "visited called without active checkpoint");
+    return std::any_of(d_profileLog.begin() + cp.profileLogSize, d_profileLog.end(),
+                       [&](auto const &move)
+                       {
+                           return move.second >= first && move.second < last;
+                       });
+}
+
+std::string BFGenerator::addConst(int const target, long const amount)
 {
     validateAddr(target);
 
+    char const op = (amount >= 0) ? '+' : '-';
+    unsigned long const magnitude = (amount >= 0) ? amount : 0UL - amount;
+
     std::ostringstream ops;
-    ops << movePtr(target)
-        << ((amount >= 0) ? std::string(amount, '+') : std::string(-amount, '-'));
+    if (magnitude <= MAX_UNARY_CONST)
+    {
+        ops << movePtr(target)
+            << std::string(magnitude, op);
+
+        return ops.str();
+    }
+
+    // Large constants (only on wider cells) are added 256 at a time in a loop. This
+    // keeps the code compact; the number of increments executed stays the same.
+    int const count = getTemp(target);
+    ops << setToValue(count, magnitude / 256)
+        << "["
+        <<     movePtr(target)
+        <<     std::string(256, op)
+        <<     decr(count)
+        << "]"
+        << movePtr(target)
+        << std::string(magnitude % 256, op);
 
     return ops.str();
 }
 
-std::string BFGenerator::addTo(int const target, int const rhs)
+std::string BFGenerator::addTo(int const target, int const rhs, bool const consumeRhs)
 {
+    // When rhs is not needed afterwards, it is added directly instead of through a copy
     validateAddr(target, rhs);
     
     std::ostringstream ops;
-    int const tmp = f_getTemp();
-    ops    << assign(tmp, rhs)
+    int const tmp = consumeRhs ? rhs : getTemp(target, rhs);
+    if (!consumeRhs)
+        ops << assign(tmp, rhs);
+
+    ops    << movePtr(tmp)
            << "["
            <<     incr(target)
            <<     decr(tmp)
@@ -140,13 +464,16 @@ std::string BFGenerator::addTo(int const target, int const rhs)
     return ops.str();
 }
 
-std::string BFGenerator::subtractFrom(int const target, int const rhs)
+std::string BFGenerator::subtractFrom(int const target, int const rhs, bool const consumeRhs)
 {
     validateAddr(target, rhs);
     
-    int const tmp = f_getTemp();
+    int const tmp = consumeRhs ? rhs : getTemp(target, rhs);
     std::ostringstream ops;
-    ops    << assign(tmp, rhs)
+    if (!consumeRhs)
+        ops << assign(tmp, rhs);
+
+    ops    << movePtr(tmp)
            << "["
            <<     decr(target)
            <<     decr(tmp)
@@ -195,7 +522,7 @@ std::string BFGenerator::multiplyBy(int const target, int const factor)
 {
     validateAddr(target, factor);
 
-    int const tmp = f_getTempBlock(2);
+    int const tmp = getTempBlock(2, target, factor);
     int const targetCopy = tmp + 0;
     int const count      = tmp + 1;
 
@@ -212,6 +539,56 @@ std::string BFGenerator::multiplyBy(int const target, int const factor)
     return ops.str();
 }
 
+std::string BFGenerator::multiplyConst(int const lhs, long const factor, int const result)
+{
+    validateAddr(lhs, result);
+
+    // A single transfer of lhs into result (factor times) and a backup,
+    // which is then moved back into lhs.
+    int const tmp = getTemp(lhs, result);
+
+    std::ostringstream ops;
+    ops << setToValue(result, 0)
+        << setToValue(tmp, 0)
+        << movePtr(lhs)
+        << "["
+        <<     addConst(result, factor)
+        <<     incr(tmp)
+        <<     decr(lhs)
+        << "]"
+        << movePtr(tmp)
+        << "["
+        <<     incr(lhs)
+        <<     decr(tmp)
+        << "]"
+        << movePtr(result);
+
+    return ops.str();
+}
+
+std::string BFGenerator::multiplyByConst(int const target, long const factor)
+{
+    validateAddr(target);
+
+    int const tmp = getTemp(target);
+
+    std::ostringstream ops;
+    ops << setToValue(tmp, 0)
+        << movePtr(target)
+        << "["
+        <<     incr(tmp)
+        <<     decr(target)
+        << "]"
+        << movePtr(tmp)
+        << "["
+        <<     addConst(target, factor)
+        <<     decr(tmp)
+        << "]"
+        << movePtr(target);
+
+    return ops.str();
+}
+
 std::string BFGenerator::power(int const lhs, int const rhs, int const result)
 {
     validateAddr(lhs, rhs, result);
@@ -227,7 +604,7 @@ std::string BFGenerator::powerBy(int const base, int const pow)
 {
     validateAddr(base, pow);
     
-    int const tmp = f_getTempBlock(2);
+    int const tmp = getTempBlock(2, base, pow);
     int const baseCopy = tmp + 0;
     int const powCopy = tmp + 1;
     
@@ -250,7 +627,7 @@ std::string BFGenerator::logicalNot(int const addr, int const result)
 {
     validateAddr(addr, result);
     
-    int const tmp = f_getTemp();
+    int const tmp = getTemp(addr, result);
     std::ostringstream ops;
     
     ops    << setToValue(result, 1)
@@ -264,11 +641,48 @@ std::string BFGenerator::logicalNot(int const addr, int const result)
     return ops.str();
 }
 
+std::string BFGenerator::booleanNot(int const addr, int const result, bool const consumeOperand)
+{
+    // Negation of a value that is known to be either 0 or 1: result = 1 - addr. The
+    // operand only needs to be restored (through a temp) when it is used afterwards.
+    validateAddr(addr, result);
+
+    std::ostringstream ops;
+    ops << setToValue(result, 1);
+    if (consumeOperand)
+    {
+        ops << movePtr(addr)
+            << "["
+            <<     decr(result)
+            <<     decr(addr)
+            << "]";
+    }
+    else
+    {
+        int const tmp = getTemp(addr, result);
+        ops << setToValue(tmp, 0)
+            << movePtr(addr)
+            << "["
+            <<     decr(result)
+            <<     incr(tmp)
+            <<     decr(addr)
+            << "]"
+            << movePtr(tmp)
+            << "["
+            <<     incr(addr)
+            <<     decr(tmp)
+            << "]";
+    }
+
+    ops << movePtr(result);
+    return ops.str();
+}
+
 std::string BFGenerator::logicalNot(int const addr)
 {
     validateAddr(addr);
     
-    int flag = f_getTemp();
+    int flag = getTemp(addr);
     
     std::ostringstream ops;
     ops    << setToValue(flag, 1)
@@ -291,7 +705,7 @@ std::string BFGenerator::logicalAnd(int const lhs, int const rhs, int const resu
 {
     validateAddr(lhs, rhs, result);
 
-    int const tmp = f_getTempBlock(2);
+    int const tmp = getTempBlock(2, lhs, rhs, result);
     int const x = tmp + 0;
     int const y = tmp + 1;
     
@@ -316,7 +730,7 @@ std::string BFGenerator::logicalAnd(int const lhs, int const rhs)
 {
     validateAddr(lhs, rhs);
 
-    int const result = f_getTemp();
+    int const result = getTemp(lhs, rhs);
     
     std::ostringstream ops;
     ops    << logicalAnd(lhs, rhs, result)
@@ -330,7 +744,7 @@ std::string BFGenerator::logicalOr(int const lhs, int const rhs, int const resul
 {
     validateAddr(lhs, rhs, result);
 
-    int const tmp = f_getTempBlock(2);
+    int const tmp = getTempBlock(2, lhs, rhs, result);
     int const x = tmp + 0;
     int const y = tmp + 1;
 
@@ -355,7 +769,7 @@ std::string BFGenerator::logicalOr(int const lhs, int const rhs)
 {
     validateAddr(lhs, rhs);
 
-    int const result = f_getTemp();
+    int const result = getTemp(lhs, rhs);
     
     std::ostringstream ops;
     ops    << logicalOr(lhs, rhs, result)
@@ -364,11 +778,257 @@ std::string BFGenerator::logicalOr(int const lhs, int const rhs)
     return ops.str();
 }
     
+std::string BFGenerator::bitwise(int const lhs, int const rhs, int const result, BitOp const op)
+{
+    validateAddr(lhs, rhs, result);
+
+    // Bit-serial: both operands are halved repeatedly, each time producing their
+    // next lowest bit. The combined bit is weighted by the current power of two and
+    // added to the result. The loop ends when both operands have run out of bits,
+    // so the number of iterations is the bit-length of the largest operand (the first
+    // iteration is unconditional, after that the sum of the halves cannot overflow).
+
+    int const tmp = getTempBlock(16, lhs, rhs, result);
+    int const lhsBlock = tmp + 0;   // {n, 2, bit, 0, 0, 0}, see halve()
+    int const rhsBlock = tmp + 6;
+    int const weight   = tmp + 12;
+    int const bit      = tmp + 13;
+    int const flag     = tmp + 14;
+    int const t        = tmp + 15;
+
+    std::ostringstream ops;
+    ops << assign(lhsBlock, lhs)
+        << setToValue(lhsBlock + 1, 2)
+        << setToValue(lhsBlock + 2, 0, 4)
+        << assign(rhsBlock, rhs)
+        << setToValue(rhsBlock + 1, 2)
+        << setToValue(rhsBlock + 2, 0, 4)
+        << setToValue(weight, 1)
+        << setToValue(bit, 0)
+        << setToValue(flag, 1)
+        << setToValue(t, 0)
+        << setToValue(result, 0)
+        << movePtr(flag)
+        << "["
+        <<     "[-]"
+        <<     halve(lhsBlock)
+        <<     halve(rhsBlock)
+        <<     combineBits(lhsBlock + 2, rhsBlock + 2, bit, t, op)
+        <<     movePtr(bit)
+        <<     "["
+        <<         movePtr(weight)
+        <<         "["
+        <<             incr(result)
+        <<             incr(t)
+        <<             decr(weight)
+        <<         "]"
+        <<         movePtr(t)
+        <<         "["
+        <<             incr(weight)
+        <<             decr(t)
+        <<         "]"
+        <<         decr(bit)
+        <<     "]"
+        <<     movePtr(weight)
+        <<     "["
+        <<         addConst(t, 2)
+        <<         decr(weight)
+        <<     "]"
+        <<     movePtr(t)
+        <<     "["
+        <<         incr(weight)
+        <<         decr(t)
+        <<     "]"
+        <<     movePtr(lhsBlock)
+        <<     "["
+        <<         incr(flag)
+        <<         incr(t)
+        <<         decr(lhsBlock)
+        <<     "]"
+        <<     movePtr(t)
+        <<     "["
+        <<         incr(lhsBlock)
+        <<         decr(t)
+        <<     "]"
+        <<     movePtr(rhsBlock)
+        <<     "["
+        <<         incr(flag)
+        <<         incr(t)
+        <<         decr(rhsBlock)
+        <<     "]"
+        <<     movePtr(t)
+        <<     "["
+        <<         incr(rhsBlock)
+        <<         decr(t)
+        <<     "]"
+        <<     movePtr(flag)
+        << "]"
+        << movePtr(result);
+
+    return ops.str();
+}
+
+std::string BFGenerator::halve(int const block)
+{
+    // Divides the first cell of {n, 2, 0, 0, 0, 0} by two, leaving {n / 2, 2, n % 2, 0, 0, 0}.
+    std::ostringstream ops;
+    ops << movePtr(block)
+        << "[->-[>+>>]>[+[-<+>]>+>>]<<<<<]"
+        << movePtr(block + 3)
+        << "["
+        <<     incr(block)
+        <<     decr(block + 3)
+        << "]"
+        << movePtr(block + 1)
+        << "[-]++";
+
+    return ops.str();
+}
+
+std::string BFGenerator::combineBits(int const lhsBit, int const rhsBit, int const bit, int const tmp, BitOp const op)
+{
+    // Consumes the (0 or 1) bits of both operands, and stores the result of the
+    // operation on them in bit (assumed to be 0), using tmp (assumed to be 0).
+    std::ostringstream ops;
+    switch (op)
+    {
+    case BitOp::AND:
+        {
+            ops << movePtr(lhsBit)
+                << "["
+                <<     movePtr(rhsBit)
+                <<     "["
+                <<         incr(bit)
+                <<         decr(rhsBit)
+                <<     "]"
+                <<     decr(lhsBit)
+                << "]"
+                << setToValue(rhsBit, 0);
+            break;
+        }
+    case BitOp::OR:
+        {
+            ops << movePtr(lhsBit)
+                << "["
+                <<     incr(tmp)
+                <<     decr(lhsBit)
+                << "]"
+                << movePtr(rhsBit)
+                << "["
+                <<     incr(tmp)
+                <<     decr(rhsBit)
+                << "]"
+                << movePtr(tmp)
+                << "["
+                <<     "[-]"
+                <<     incr(bit)
+                <<     movePtr(tmp)
+                << "]";
+            break;
+        }
+    case BitOp::XOR:
+        {
+            ops << movePtr(lhsBit)
+                << "["
+                <<     incr(bit)
+                <<     decr(lhsBit)
+                << "]"
+                << movePtr(rhsBit)
+                << "["                        // toggle bit
+                <<     incr(tmp)
+                <<     movePtr(bit)
+                <<     "["
+                <<         decr(tmp)
+                <<         decr(bit)
+                <<     "]"
+                <<     movePtr(tmp)
+                <<     "["
+                <<         incr(bit)
+                <<         decr(tmp)
+                <<     "]"
+                <<     decr(rhsBit)
+                << "]";
+            break;
+        }
+    }
+
+    return ops.str();
+}
+
+std::string BFGenerator::shiftLeft(int const lhs, int const rhs, int const result)
+{
+    validateAddr(lhs, rhs, result);
+
+    // Double a copy of lhs rhs times; bits shifted out wrap around the cell.
+    int const tmp = getTempBlock(3, lhs, rhs, result);
+    int const value = tmp + 0;
+    int const count = tmp + 1;
+    int const t     = tmp + 2;
+
+    std::ostringstream ops;
+    ops << assign(value, lhs)
+        << assign(count, rhs)
+        << setToValue(t, 0)
+        << movePtr(count)
+        << "["
+        <<     movePtr(value)
+        <<     "["
+        <<         addConst(t, 2)
+        <<         decr(value)
+        <<     "]"
+        <<     movePtr(t)
+        <<     "["
+        <<         incr(value)
+        <<         decr(t)
+        <<     "]"
+        <<     decr(count)
+        << "]"
+        << setToValue(result, 0)
+        << movePtr(value)
+        << "["
+        <<     incr(result)
+        <<     decr(value)
+        << "]"
+        << movePtr(result);
+
+    return ops.str();
+}
+
+std::string BFGenerator::shiftRight(int const lhs, int const rhs, int const result)
+{
+    validateAddr(lhs, rhs, result);
+
+    // Halve a copy of lhs rhs times, discarding the remainders.
+    int const tmp = getTempBlock(7, lhs, rhs, result);
+    int const block = tmp + 0;      // {n, 2, bit, 0, 0, 0}, see halve()
+    int const count = tmp + 6;
+
+    std::ostringstream ops;
+    ops << assign(block, lhs)
+        << setToValue(block + 1, 2)
+        << setToValue(block + 2, 0, 4)
+        << assign(count, rhs)
+        << "["
+        <<     halve(block)
+        <<     setToValue(block + 2, 0)
+        <<     decr(count)
+        << "]"
+        << setToValue(result, 0)
+        << movePtr(block)
+        << "["
+        <<     incr(result)
+        <<     decr(block)
+        << "]"
+        << movePtr(result);
+
+    return ops.str();
+}
+
 std::string BFGenerator::equal(int const lhs, int const rhs, int const result)
 {
     validateAddr(lhs, rhs, result);
 
-    int const tmp = f_getTempBlock(6);
+    int const tmp = getTempBlock(6, lhs, rhs, result);
     int const x = tmp + 0;
     int const y = tmp + 1;
     int const underflow1 = tmp + 2;
@@ -408,11 +1068,103 @@ std::string BFGenerator::equal(int const lhs, int const rhs, int const result)
     return ops.str();
 }
 
+std::string BFGenerator::equalConst(int const lhs, long const value, int const result)
+{
+    return compareConst(lhs, value, result, true);
+}
+
+std::string BFGenerator::notEqualConst(int const lhs, long const value, int const result)
+{
+    return compareConst(lhs, value, result, false);
+}
+
+std::string BFGenerator::isZero(int const block)
+{
+    // Sets block + 1 to 1 if block is zero and to 0 otherwise, in constant time and
+    // without touching the value itself. Uses block + 2 as scratch.
+    validateAddr(block);
+
+    std::ostringstream ops;
+    ops << setToValue(block + 1, 1)
+        << setToValue(block + 2, 0)
+        << movePtr(block)
+        << "[>-]>[>]<<";
+
+    return ops.str();
+}
+
+std::string BFGenerator::compareConst(int const lhs, long const value, int const result, bool const equal)
+{
+    validateAddr(lhs, result);
+
+    // Subtract the value from a copy of lhs and test the difference for zero.
+    int const tmp = getTemp(lhs, result);
+
+    std::ostringstream ops;
+    ops << assign(tmp, lhs)
+        << addConst(tmp, -value)
+        << setToValue(result, equal ? 1 : 0)
+        << movePtr(tmp)
+        << "["
+        <<     setToValue(result, equal ? 0 : 1)
+        <<     setToValue(tmp, 0)
+        << "]"
+        << movePtr(result);
+
+    return ops.str();
+}
+
+std::string BFGenerator::lessConst(int const lhs, long const bound, int const result)
+{
+    return countDownConst(lhs, bound, result, true);
+}
+
+std::string BFGenerator::greaterOrEqualConst(int const lhs, long const bound, int const result)
+{
+    return countDownConst(lhs, bound, result, false);
+}
+
+std::string BFGenerator::countDownConst(int const lhs, long const bound, int const result, bool const less)
+{
+    validateAddr(lhs, result);
+
+    // Count down from the bound, while decrementing a copy of lhs as long as it is
+    // nonzero. If it reaches zero before the count is exhausted, lhs < bound.
+    // The zero-test relies on the layout {x, 1, 0}: when x is zero, the pointer
+    // ends up one cell further to the right than when it's not, which allows for
+    // a non-destructive if-else that takes a constant number of steps.
+
+    int const tmp   = getTempBlock(4, lhs, result);
+    int const x     = tmp + 0;
+    int const flag  = tmp + 1;
+    int const zero  = tmp + 2;
+    int const count = tmp + 3;
+
+    std::ostringstream ops;
+    ops << setToValue(result, less ? 0 : 1)
+        << assign(x, lhs)
+        << setToValue(flag, 0)
+        << setToValue(zero, 0)
+        << setToValue(count, bound)
+        << "["
+        <<     incr(flag)
+        <<     movePtr(x)
+        <<     "[->-]>[<"                          // x != 0 -> decrement x
+        <<         setToValue(result, less ? 1 : 0) // x == 0 -> lhs < bound
+        <<         movePtr(x)
+        <<     ">->]<<"
+        <<     decr(count)
+        << "]"
+        << movePtr(result);
+
+    return ops.str();
+}
+
 std::string BFGenerator::notEqual(int const lhs, int const rhs, int const result)
 {
     validateAddr(lhs, rhs, result);
     
-    int const isEqual = f_getTemp();
+    int const isEqual = getTemp(lhs, rhs, result);
     std::ostringstream ops;
     ops << equal(lhs, rhs, isEqual)
         << logicalNot(isEqual, result);
@@ -424,7 +1176,7 @@ std::string BFGenerator::greater(int const lhs, int const rhs, int const result)
 {
     validateAddr(lhs, rhs, result);
 
-    int const tmp  = f_getTempBlock(3);
+    int const tmp  = getTempBlock(3, lhs, rhs, result);
     int const x    = tmp + 0;
     int const y    = tmp + 1;
     int const underflow = tmp + 2;
@@ -460,7 +1212,7 @@ std::string BFGenerator::greaterOrEqual(int const lhs, int const rhs, int const
 {
     validateAddr(lhs, rhs, result);
 
-    int const tmp       = f_getTempBlock(2);
+    int const tmp       = getTempBlock(2, lhs, rhs, result);
     int const isEqual   = tmp + 0;
     int const isGreater = tmp + 1;
 
@@ -479,8 +1231,46 @@ std::string BFGenerator::lessOrEqual(int const lhs, int const rhs, int const res
     return greaterOrEqual(rhs, lhs, result); // reverse arguments
 }
 
-std::string BFGenerator::fetchElement(int const arrStart, int const arrSize, int const index, int const ret)
+std::string BFGenerator::lookupConst(int const index, int const ret, std::vector<int> const &deltas,
+                                     bool const consumeIndex)
+{
+    // Selects one of a table of known values, given the difference between each value
+    // and the previous one (starting from 0), by counting the index down. The result
+    // starts out as the first value and every level of the nested loops, which is only
+    // entered while the counter is nonzero, adds the difference to the next value. An
+    // index beyond the table yields its last value.
+    validateAddr(index, ret);
+
+    int const counter = consumeIndex ? index : getTemp(index, ret);
+    
+    std::ostringstream ops;
+    if (!consumeIndex)
+        ops << assign(counter, index);
+
+    ops << setToValue(ret, 0)
+        << addConst(ret, deltas[0])
+        << movePtr(counter);
+
+    for (size_t i = 1; i != deltas.size(); ++i)
+    {
+        ops << "["
+            <<     decr(counter)
+            <<     addConst(ret, deltas[i])
+            <<     movePtr(counter);
+    }
+
+    ops << "[-]"
+        << std::string(deltas.size() - 1, ']');
+    
+    return ops.str();
+}
+
+std::string BFGenerator::fetchElement(int const arrStart, int const arrSize, int const index, int const ret,
+                                      bool const hasHeader)
 {
+    if (hasHeader)
+        return fetchElementWithHeader(arrStart, index, ret);
+    
     // Algorithms to move an unknown amount to the left and right.
     // Assumes the pointer points to a cell containing the amount
     // it needs to be shifted and a copy of this amount adjacent to it.
@@ -495,7 +1285,7 @@ std::string BFGenerator::fetchElement(int const arrStart, int const arrSize, int
     // 3. to prevent overflow on off-by-one errors
 
     int const bufSize = arrSize + 3;
-    int const buf = f_getTempBlock(bufSize);
+    int const buf = getTempBlock(bufSize, arrStart);
     int const dist = buf - arrStart;
 
     std::string const arr2buf(std::abs(dist), (dist > 0 ? '>' : '<'));
@@ -529,13 +1319,17 @@ std::string BFGenerator::fetchElement(int const arrStart, int const arrSize, int
     return ops.str();
 }
 
-std::string BFGenerator::assignElement(int const arrStart, int const arrSize, int const index, int const val)
+std::string BFGenerator::assignElement(int const arrStart, int const arrSize, int const index, int const val,
+                                       bool const hasHeader)
 {
+    if (hasHeader)
+        return assignElementWithHeader(arrStart, index, val);
+    
     static std::string const dynamicMoveRight = "[>>[->+<]<[->+<]<[->+<]>-]";
     static std::string const dynamicMoveLeft = "[[-<+>]<-]<";
                
     int const bufSize = arrSize + 3;
-    int const buf     = f_getTempBlock(bufSize);
+    int const buf     = getTempBlock(bufSize, arrStart);
     int const dist    = buf - arrStart;
 
     std::string const arr2buf(std::abs(dist), (dist > 0 ? '>' : '<'));
@@ -565,9 +1359,549 @@ std::string BFGenerator::assignElement(int const arrStart, int const arrSize, in
     return ops.str();
 }
 
+std::string BFGenerator::fetchElementWithHeader(int const arrStart, int const index, int const ret)
+{
+    // The array is preceded by scratch-cells, the last 3 of which are used as a
+    // packet {counter, index, 0} that is walked into the array. On each step, the
+    // element in front of the packet is moved to the back of it, so the packet
+    // arrives at element i in i steps without needing a buffer. The element is then
+    // copied into the packet and carried back, moving each element to its original
+    // position. The code is independent of the size of the array.
+
+    static std::string const walkRight = "[>[->+<]<[->+<]>>>[-<<<+>>>]<<-]";
+    static std::string const copy      = ">>>[-<+<<+>>>]<[->+<]<";
+    static std::string const walkLeft  = "[<<[->>>+<<<]>[-<+>]>[-<+>]<-]<";
+
+    int const packet = arrStart - 3;
+    
+    std::ostringstream ops;
+    ops << assign(packet + 0, index)
+        << assign(packet + 1, index)
+        << setToValue(packet + 2, 0)
+        << movePtr(packet)
+        << walkRight
+        << copy
+        << walkLeft
+        << setToValue(ret, 0)
+        << movePtr(packet)
+        << "["
+        <<     incr(ret)
+        <<     decr(packet)
+        << "]";
+
+    return ops.str();
+}
+
+std::string BFGenerator::assignElementWithHeader(int const arrStart, int const index, int const val)
+{
+    // Similar to fetchElement, but now the packet {counter, index, value, 0} occupies
+    // all 4 scratch-cells. The value is carried to the element, after which the
+    // packet returns using the index as a counter.
+
+    static std::string const walkRight = "[>>[->+<]<[->+<]<[->+<]>>>>[-<<<<+>>>>]<<<-]";
+    static std::string const store     = ">>>>[-]<<[->>+<<]<";
+    static std::string const walkLeft  = "[<<[->>>>+<<<<]>>[-<+>]<-]<";
+
+    int const packet = arrStart - 4;
+
+    std::ostringstream ops;
+    ops << assign(packet + 0, index)
+        << assign(packet + 1, index)
+        << assign(packet + 2, val)
+        << setToValue(packet + 3, 0)
+        << movePtr(packet)
+        << walkRight
+        << store
+        << walkLeft;
+
+    return ops.str();
+}
+
+std::string BFGenerator::fetchElement(int const arrStart, std::vector<int> const &dims,
+                                      std::vector<int> const &indices, int const ret)
+{
+    // Multi-dimensional arrays are preceded by one scratch-cell for each index, plus 2.
+    // Like in fetchElementWithHeader, the packet {counter, indices..., 0} is walked into
+    // the array, but for each dimension it advances a whole row of that dimension for
+    // every decrement of the counter. The flat index is therefore never computed.
+
+    int const packetSize = indices.size() + 2;
+    int const packet = arrStart - packetSize;
+    int const last = packetSize - 1;
+
+    std::string const right(packetSize, '>');
+    std::string const left(packetSize, '<');
+    
+    std::ostringstream ops;
+    ops << assign(packet + 0, indices[0]);
+    for (size_t j = 0; j != indices.size(); ++j)
+        ops << assign(packet + 1 + j, indices[j]);
+
+    ops << setToValue(packet + last, 0)
+        << movePtr(packet)
+        << walkPacketRight(packetSize, dims)
+        << right                                  // copy element into the counter
+        << "[-<+" << left.substr(1) << "+" << right << "]"
+        << "<[->+<]" << left.substr(1)
+        << walkPacketLeft(packetSize, dims)
+        << setToValue(ret, 0)
+        << movePtr(packet)
+        << "["
+        <<     incr(ret)
+        <<     decr(packet)
+        << "]";
+
+    return ops.str();
+}
+
+std::string BFGenerator::assignElement(int const arrStart, std::vector<int> const &dims,
+                                       std::vector<int> const &indices, int const val)
+{
+    // Similar to the multi-dimensional fetchElement, but the packet {counter, indices...,
+    // value, 0} carries the value to the element.
+
+    int const packetSize = indices.size() + 3;
+    int const packet = arrStart - packetSize;
+    int const last = packetSize - 1;
+
+    std::ostringstream ops;
+    ops << assign(packet + 0, indices[0]);
+    for (size_t j = 0; j != indices.size(); ++j)
+        ops << assign(packet + 1 + j, indices[j]);
+
+    ops << assign(packet + last - 1, val)
+        << setToValue(packet + last, 0)
+        << movePtr(packet)
+        << walkPacketRight(packetSize, dims)
+        << std::string(packetSize, '>') << "[-]"  // store value in the element
+        << "<<[->>+<<]" << std::string(packetSize - 2, '<')
+        << walkPacketLeft(packetSize, dims);
+
+    return ops.str();
+}
+
+std::string BFGenerator::walkPacketRight(int const packetSize, std::vector<int> const &dims)
+{
+    // Starting at the counter, moves the packet (of which the last cell is empty) to the
+    // element selected by the indices following the counter. On each step, the element
+    // in front of the packet is moved to the back of it. The counter is loaded with
+    // each of the indices in turn, using the empty cell to restore the index.
+
+    int const last = packetSize - 1;
+    std::string const step = stepPacketRight(packetSize);
+
+    std::string ops;
+    int stride = std::accumulate(dims.begin(), dims.end(), 1, std::multiplies<int>());
+    for (size_t j = 0; j != dims.size(); ++j)
+    {
+        stride /= dims[j];
+        if (j > 0)
+        {
+            int const idx = j + 1;
+            ops += moves(idx) + "[-" + moves(-idx) + "+" + moves(last) + "+" + moves(idx - last) + "]"
+                +  moves(last - idx) + "[-" + moves(idx - last) + "+" + moves(last - idx) + "]"
+                +  moves(-last);
+        }
+
+        ops += "[";
+        for (int i = 0; i != stride; ++i)
+            ops += step;
+        ops += "-]";
+    }
+
+    return ops;
+}
+
+std::string BFGenerator::stepPacketRight(int const packetSize)
+{
+    // Moves the packet one cell to the right, starting and ending at its first cell
+    int const last = packetSize - 1;
+    std::string step = moves(last - 1);
+    for (int i = last - 1; i >= 0; --i)
+        step += (i > 0) ? "[->+<]<" : "[->+<]";
+    step += moves(packetSize) + "[-" + moves(-packetSize) + "+" + moves(packetSize) + "]" + moves(-last);
+
+    return step;
+}
+
+std::string BFGenerator::walkPacketLeft(int const packetSize, std::vector<int> const &dims)
+{
+    // Returns the packet to its starting position, counting down the indices that follow
+    // the first cell of the packet in reverse order. On each step, the element behind the
+    // packet is moved to its empty last cell.
+
+    int const last = packetSize - 1;
+    std::string step = "<[-" + moves(packetSize) + "+" + moves(-packetSize) + "]";
+    for (int i = 0; i != last; ++i)
+        step += ">[-<+>]";
+    step += moves(-last);
+
+    std::string ops;
+    int stride = 1;
+    for (int j = dims.size() - 1; j >= 0; --j)
+    {
+        int const idx = j + 1;
+        ops += moves(idx) + "[" + moves(-idx);
+        for (int i = 0; i != stride; ++i)
+            ops += step;
+        ops += moves(idx) + "-]" + moves(-idx);
+        stride *= dims[j];
+    }
+
+    return ops;
+}
+
+std::string BFGenerator::walkCounted(int const packetSize, std::string const &op)
+{
+    // Starting at the counter of the packet {counter, steps, ..., 0}, applies op to the
+    // element in front of the packet before walking past it, until the counter runs
+    // out. The packet then returns by counting down the steps. The op is given relative
+    // to the counter and has to leave the pointer there.
+    return "[" + op + stepPacketRight(packetSize) + "-]" + walkPacketLeft(packetSize, {1});
+}
+
+std::string BFGenerator::transfer(int const from, std::vector<int> const &to)
+{
+    // Relative to the current cell, moves the contents of a cell into all others
+    std::string ops = moves(from) + "[-";
+    int at = from;
+    for (int const cell: to)
+    {
+        ops += moves(cell - at) + "+";
+        at = cell;
+    }
+
+    return ops + moves(from - at) + "]" + moves(-from);
+}
+
+std::string BFGenerator::moves(int const n)
+{
+    return std::string(std::abs(n), (n > 0) ? '>' : '<');
+}
+
+std::string BFGenerator::copyBlock(int const dest, int const src, int const n)
+{
+    // Copies n cells without temporaries. Each element of src is moved into dest and
+    // into the cell in front of it, which was emptied by the previous element (the first
+    // element uses the last cell of the array-header). The elements are then moved back
+    // in reverse order.
+    validateAddr(dest, src);
+
+    std::ostringstream ops;
+    ops << setToValue(dest, 0, n)
+        << setToValue(src - 1, 0);
+
+    for (int i = 0; i != n; ++i)
+    {
+        ops << movePtr(src + i)
+            << "["
+            <<     incr(dest + i)
+            <<     incr(src + i - 1)
+            <<     decr(src + i)
+            << "]";
+    }
+
+    for (int i = n - 1; i >= 0; --i)
+    {
+        ops << movePtr(src + i - 1)
+            << "["
+            <<     incr(src + i)
+            <<     decr(src + i - 1)
+            << "]";
+    }
+
+    return ops.str();
+}
+
+std::string BFGenerator::fillBlock(int const dest, int const value, int const n)
+{
+    // Distributes the value over all n cells in a single loop
+    validateAddr(dest, value);
+
+    int const tmp = getTemp(dest, value);
+
+    std::ostringstream ops;
+    ops << setToValue(dest, 0, n)
+        << setToValue(tmp, 0)
+        << movePtr(value)
+        << "[";
+
+    for (int i = 0; i != n; ++i)
+        ops << incr(dest + i);
+
+    ops <<     incr(tmp)
+        <<     decr(value)
+        << "]"
+        << movePtr(tmp)
+        << "["
+        <<     incr(value)
+        <<     decr(tmp)
+        << "]";
+
+    return ops.str();
+}
+
+std::string BFGenerator::compareBlock(int const lhs, int const rhs, int const n, int const result)
+{
+    // Clears the result when any of the n cells differ. First, each element of rhs is
+    // subtracted from lhs while it's moved into the cell in front of it (like copyBlock).
+    // Then, in reverse order, each difference is tested and both elements are restored,
+    // using the emptied rhs-cell to hold the difference.
+    validateAddr(lhs, rhs, result);
+
+    std::ostringstream ops;
+    ops << setToValue(rhs - 1, 0);
+
+    for (int i = 0; i != n; ++i)
+    {
+        ops << movePtr(rhs + i)
+            << "["
+            <<     decr(lhs + i)
+            <<     incr(rhs + i - 1)
+            <<     decr(rhs + i)
+            << "]";
+    }
+
+    for (int i = n - 1; i >= 0; --i)
+    {
+        ops << movePtr(lhs + i)
+            << "["
+            <<     setToValue(result, 0)
+            <<     movePtr(lhs + i)
+            <<     "["
+            <<         incr(rhs + i)
+            <<         decr(lhs + i)
+            <<     "]"
+            << "]"
+            << movePtr(rhs + i)
+            << "["
+            <<     incr(lhs + i)
+            <<     decr(rhs + i)
+            << "]"
+            << movePtr(rhs + i - 1)
+            << "["
+            <<     incr(lhs + i)
+            <<     incr(rhs + i)
+            <<     decr(rhs + i - 1)
+            << "]";
+    }
+
+    return ops.str();
+}
+
+std::string BFGenerator::compareCell(int const lhs, int const rhs, int const result)
+{
+    // Single-cell version of compareBlock, using a temporary instead of the header
+    validateAddr(lhs, rhs, result);
+
+    int const tmp = getTemp(lhs, rhs);
+
+    std::ostringstream ops;
+    ops << setToValue(tmp, 0)
+        << movePtr(rhs)
+        << "["
+        <<     decr(lhs)
+        <<     incr(tmp)
+        <<     decr(rhs)
+        << "]"
+        << movePtr(lhs)
+        << "["
+        <<     setToValue(result, 0)
+        <<     movePtr(lhs)
+        <<     "["
+        <<         incr(rhs)
+        <<         decr(lhs)
+        <<     "]"
+        << "]"
+        << movePtr(rhs)
+        << "["
+        <<     incr(lhs)
+        <<     decr(rhs)
+        << "]"
+        << movePtr(tmp)
+        << "["
+        <<     incr(lhs)
+        <<     incr(rhs)
+        <<     decr(tmp)
+        << "]";
+
+    return ops.str();
+}
+
+std::string BFGenerator::copyCounted(int const dest, int const src, int const count, bool const walkSrc)
+{
+    // Copies the first count cells of src to dest, where count is only known at runtime
+    // (and does not exceed the size of either array). The packet {counter, steps, 0} is
+    // walked through the header into one of the arrays (see walkCounted()), such that
+    // the corresponding element of the other array is always at the same distance.
+    int const walked = walkSrc ? src : dest;
+    validateAddr(dest, src, count, walked - 3);
+
+    int const packet = walked - 3;
+    int const elem   = 3;
+    int const other  = elem + (walkSrc ? dest - src : src - dest);
+    int const last   = 2;
+
+    std::string const op = walkSrc
+        ? moves(other) + "[-]" + moves(-other) + transfer(elem, {other, last}) + transfer(last, {elem})
+        : moves(elem) + "[-]" + moves(-elem) + transfer(other, {elem, last}) + transfer(last, {other});
+
+    std::ostringstream ops;
+    ops << assign(packet + 0, count)
+        << assign(packet + 1, count)
+        << setToValue(packet + last, 0)
+        << movePtr(packet)
+        << walkCounted(3, op);
+
+    return ops.str();
+}
+
+std::string BFGenerator::fillCounted(int const dest, int const value, int const count)
+{
+    // Like copyCounted, but the packet {counter, steps, value, 0} carries the value
+    validateAddr(dest, value, count, dest - 4);
+
+    int const packet = dest - 4;
+    int const elem   = 4;
+    int const last   = 3;
+
+    std::string const op = moves(elem) + "[-]" + moves(-elem) + transfer(2, {elem, last}) + transfer(last, {2});
+
+    std::ostringstream ops;
+    ops << assign(packet + 0, count)
+        << assign(packet + 1, count)
+        << assign(packet + 2, value)
+        << setToValue(packet + last, 0)
+        << movePtr(packet)
+        << walkCounted(4, op)
+        << setToValue(packet + 2, 0);
+
+    return ops.str();
+}
+
+std::string BFGenerator::compareCounted(int const lhs, int const rhs, int const count, int const result)
+{
+    // Like copyCounted, walking into lhs. The packet {counter, steps, result, 0} carries
+    // the result, which is cleared when any of the elements differ (see compareCell()).
+    validateAddr(lhs, rhs, count, result, lhs - 4);
+
+    int const packet = lhs - 4;
+    int const elem   = 4;
+    int const other  = elem + (rhs - lhs);
+    int const last   = 3;
+
+    std::string const op = moves(other) + "[-" + moves(elem - other) + "-" + moves(last - elem) + "+"
+                         + moves(other - last) + "]" + moves(-other)
+                         + moves(elem) + "[" + moves(2 - elem) + "[-]" + moves(elem - 2)
+                         + "[-" + moves(other - elem) + "+" + moves(elem - other) + "]]" + moves(-elem)
+                         + transfer(other, {elem})
+                         + transfer(last, {elem, other});
+
+    std::ostringstream ops;
+    ops << assign(packet + 0, count)
+        << assign(packet + 1, count)
+        << setToValue(packet + 2, 1)
+        << setToValue(packet + last, 0)
+        << movePtr(packet)
+        << walkCounted(4, op)
+        << move(result, packet + 2);
+
+    return ops.str();
+}
+
+std::string BFGenerator::rotateOut(int const arrStart)
+{
+    // Moves the first element of the array into the last cell of its header. Together
+    // with rotateIn, this rotates the array by one element.
+    validateAddr(arrStart);
+
+    int const slot = arrStart - 1;
+
+    std::ostringstream ops;
+    ops << setToValue(slot, 0)
+        << movePtr(arrStart)
+        << "["
+        <<     incr(slot)
+        <<     decr(arrStart)
+        << "]";
+
+    return ops.str();
+}
+
+std::string BFGenerator::rotateIn(int const arrStart, int const arrSize)
+{
+    // Shifts the remaining elements one cell to the left and moves the element that was
+    // taken out by rotateOut to the back. After arrSize rotations, the array is restored.
+    validateAddr(arrStart);
+
+    int const slot = arrStart - 1;
+
+    std::ostringstream ops;
+    for (int i = 1; i != arrSize; ++i)
+    {
+        ops << movePtr(arrStart + i)
+            << "["
+            <<     incr(arrStart + i - 1)
+            <<     decr(arrStart + i)
+            << "]";
+    }
+
+    ops << movePtr(slot)
+        << "["
+        <<     incr(arrStart + arrSize - 1)
+        <<     decr(slot)
+        << "]";
+
+    return ops.str();
+}
+
+std::string BFGenerator::divmodConst(int const num, int const denom, int const divResult, int const modResult)
+{
+    validateAddr(num, divResult, modResult);
+    assert(denom > 0 && "divmodConst requires a positive denominator");
+
+    std::ostringstream ops;
+    if (denom == 1)
+    {
+        ops << assign(divResult, num)
+            << setToValue(modResult, 0);
+        return ops.str();
+    }
+
+    // With a known denominator, there is no need to check for division by zero and the
+    // compact divmod-algorithm can be used on the layout {n, d, 0, 0, 0, 0}, which
+    // results in {0, d - n % d, n % d, n / d, 0, 0}.
+    int const tmp = getTempBlock(6, num, divResult, modResult);
+    int const tmp_num   = tmp + 0;
+    int const tmp_denom = tmp + 1;
+    int const tmp_mod   = tmp + 2;
+    int const tmp_div   = tmp + 3;
+
+    ops << assign(tmp_num, num)
+        << setToValue(tmp_denom, denom)
+        << setToValue(tmp + 2, 0, 4)
+        << movePtr(tmp_num)
+        << "[->-[>+>>]>[+[-<+>]>+>>]<<<<<]"
+        << setToValue(divResult, 0)
+        << setToValue(modResult, 0)
+        << movePtr(tmp_mod)
+        << "["
+        <<     incr(modResult)
+        <<     decr(tmp_mod)
+        << "]"
+        << movePtr(tmp_div)
+        << "["
+        <<     incr(divResult)
+        <<     decr(tmp_div)
+        << "]"
+        << movePtr(divResult);
+
+    return ops.str();
+}
+
 std::string BFGenerator::divmod(int const num, int const denom, int const divResult, int const modResult)
 {
-    int const tmp = f_getTempBlock(4);
+    int const tmp = getTempBlock(4, num, denom, divResult, modResult);
     int const tmp_loopflag  = tmp + 0;
     int const tmp_zeroflag  = tmp + 1;
     int const tmp_num       = tmp + 2;
@@ -630,3 +1964,298 @@ std::string BFGenerator::divmod(int const num, int const denom, int const divRes
 
     return ops.str();
 }
+
+// Integers spanning n cells (least significant cell first) are operated on in a
+// register, in which every digit is followed by two scratch-cells {digit, 0, 0}.
+// This allows for the constant-time zero-test (see countDownConst) that is needed
+// to propagate a carry or borrow through the digits.
+
+std::string BFGenerator::loadRegister(int const reg, int const n, int const src, int const m)
+{
+    // Clears the n digits of the register and copies the m cells of src into it
+    std::ostringstream ops;
+    ops << setToValue(reg, 0, 3 * n);
+    for (int i = 0; i != m; ++i)
+        ops << assign(reg + 3 * i, src + i);
+
+    return ops.str();
+}
+
+std::string BFGenerator::storeRegister(int const reg, int const n, int const dest)
+{
+    // Moves the n digits of the register to dest (or discards them if dest is -1)
+    std::ostringstream ops;
+    for (int i = 0; i != n; ++i)
+        ops << ((dest == -1) ? setToValue(reg + 3 * i, 0) : move(dest + i, reg + 3 * i));
+
+    return ops.str();
+}
+
+std::string BFGenerator::carryIncr(int const reg, int const i, int const n, int const carry)
+{
+    // Increments digit i of the register. When it wraps around to zero, the next
+    // digit is incremented, or the carry-cell when this was the most significant one.
+    int const digit = reg + 3 * i;
+    
+    std::ostringstream ops;
+    ops << incr(digit);
+    if (i == n - 1 && carry == -1)
+        return ops.str();
+
+    ops << incr(digit + 1)
+        << movePtr(digit)
+        << "[>-]>[<"
+        <<     ((i == n - 1) ? incr(carry) : carryIncr(reg, i + 1, n, carry))
+        <<     movePtr(digit)
+        << ">->]<<";
+
+    return ops.str();
+}
+
+std::string BFGenerator::borrowDecr(int const reg, int const i, int const n, int const borrow)
+{
+    // Decrements digit i of the register. When it was zero, the next digit is
+    // decremented, or the borrow-cell incremented when this was the most significant one.
+    int const digit = reg + 3 * i;
+    
+    std::ostringstream ops;
+    if (i != n - 1 || borrow != -1)
+    {
+        ops << incr(digit + 1)
+            << movePtr(digit)
+            << "[>-]>[<"
+            <<     ((i == n - 1) ? incr(borrow) : borrowDecr(reg, i + 1, n, borrow))
+            <<     movePtr(digit)
+            << ">->]<<";
+    }
+
+    ops << decr(digit);
+    return ops.str();
+}
+
+std::string BFGenerator::addToRegister(int const reg, int const n, int const src, int const m, int const stride,
+                                       int const carry, bool const subtract)
+{
+    // Adds (or subtracts) the m digits of src, which are stride cells apart, to the
+    // register one unit at a time. The most significant digit goes first, such that
+    // a register can be added to itself to double it.
+    int const count = getTemp(reg, src);
+
+    std::ostringstream ops;
+    for (int i = m - 1; i >= 0; --i)
+    {
+        ops << assign(count, src + stride * i)
+            << "["
+            <<     decr(count)
+            <<     (subtract ? borrowDecr(reg, i, n, carry) : carryIncr(reg, i, n, carry))
+            <<     movePtr(count)
+            << "]";
+    }
+
+    return ops.str();
+}
+
+std::string BFGenerator::wideAdd(int const lhs, int const rhs, int const result, int const n)
+{
+    validateAddr(lhs, rhs, result);
+    
+    int const reg = getTempBlock(3 * n, lhs, rhs, result);
+    std::ostringstream ops;
+    ops << loadRegister(reg, n, lhs, n)
+        << addToRegister(reg, n, rhs, n, 1, -1, false)
+        << storeRegister(reg, n, result);
+
+    return ops.str();
+}
+
+std::string BFGenerator::wideSubtract(int const lhs, int const rhs, int const result, int const n)
+{
+    validateAddr(lhs, rhs, result);
+    
+    int const reg = getTempBlock(3 * n, lhs, rhs, result);
+    std::ostringstream ops;
+    ops << loadRegister(reg, n, lhs, n)
+        << addToRegister(reg, n, rhs, n, 1, -1, true)
+        << storeRegister(reg, n, result);
+
+    return ops.str();
+}
+
+std::string BFGenerator::wideEqual(int const lhs, int const rhs, int const result, int const n)
+{
+    // lhs and rhs are equal when all digits of their difference are zero
+    validateAddr(lhs, rhs, result);
+    
+    int const reg = getTempBlock(3 * n, lhs, rhs, result);
+    std::ostringstream ops;
+    ops << loadRegister(reg, n, lhs, n)
+        << addToRegister(reg, n, rhs, n, 1, -1, true)
+        << setToValue(result, 1);
+
+    for (int i = 0; i != n; ++i)
+    {
+        ops << movePtr(reg + 3 * i)
+            << "["
+            <<     setToValue(result, 0)
+            <<     setToValue(reg + 3 * i, 0)
+            << "]";
+    }
+
+    return ops.str();
+}
+
+std::string BFGenerator::wideLess(int const lhs, int const rhs, int const result, int const n)
+{
+    // lhs < rhs when subtracting rhs from lhs borrows beyond the most significant digit
+    validateAddr(lhs, rhs, result);
+    
+    int const reg = getTempBlock(3 * n, lhs, rhs, result);
+    std::ostringstream ops;
+    ops << setToValue(result, 0)
+        << loadRegister(reg, n, lhs, n)
+        << addToRegister(reg, n, rhs, n, 1, result, true)
+        << storeRegister(reg, n, -1);
+
+    return ops.str();
+}
+
+std::string BFGenerator::wideMultiply(int const lhs, int const rhs, int const result, int const n, int const bits)
+{
+    // Shift-and-add, starting at the most significant bit of rhs: the product is
+    // doubled for every bit, and lhs is added to it when the bit is set. The bits
+    // are shifted out of a copy of rhs by doubling it, which leaves it zero.
+    validateAddr(lhs, rhs, result);
+    
+    int const block = getTempBlock(6 * n + 2, lhs, rhs, result);
+    int const prod  = block;
+    int const mult  = block + 3 * n;
+    int const bit   = block + 6 * n;
+    int const count = block + 6 * n + 1;
+
+    std::ostringstream ops;
+    ops << setToValue(prod, 0, 3 * n)
+        << loadRegister(mult, n, rhs, n)
+        << setToValue(bit, 0)
+        << setToValue(count, bits)
+        << "["
+        <<     addToRegister(prod, n, prod, n, 3, -1, false)
+        <<     addToRegister(mult, n, mult, n, 3, bit, false)
+        <<     movePtr(bit)
+        <<     "["
+        <<         addToRegister(prod, n, lhs, n, 1, -1, false)
+        <<         setToValue(bit, 0)
+        <<     "]"
+        <<     decr(count)
+        << "]"
+        << storeRegister(prod, n, result);
+
+    return ops.str();
+}
+
+std::string BFGenerator::wideDivmod(int const num, int const denom, int const divResult, int const modResult,
+                                    int const n, int const bits)
+{
+    // Restoring long division: the bits of num are shifted into the remainder one at a
+    // time (most significant first), after which denom is subtracted from it. If this
+    // borrows, denom is added back; otherwise, the quotient-bit is set. The quotient is
+    // built up in the register that num is shifted out of. Division by zero results in
+    // a quotient with all bits set and a remainder equal to num.
+    validateAddr(num, denom);
+    
+    int const block = getTempBlock(6 * n + 6, num, denom);
+    int const quot  = block;
+    int const rem   = block + 3 * n;
+    int const bit   = block + 6 * n + 3;
+    int const flag  = block + 6 * n + 4;
+    int const count = block + 6 * n + 5;
+
+    std::ostringstream ops;
+    ops << loadRegister(quot, n, num, n)
+        << setToValue(rem, 0, 3 * (n + 1))
+        << setToValue(bit, 0)
+        << setToValue(flag, 0)
+        << setToValue(count, bits)
+        << "["
+        <<     addToRegister(quot, n, quot, n, 3, bit, false)
+        <<     addToRegister(rem, n + 1, rem, n + 1, 3, -1, false)
+        <<     movePtr(bit)
+        <<     "["
+        <<         incr(rem)
+        <<         decr(bit)
+        <<     "]"
+        <<     addToRegister(rem, n + 1, denom, n, 1, bit, true)
+        <<     setToValue(flag, 1)
+        <<     movePtr(bit)
+        <<     "["
+        <<         addToRegister(rem, n + 1, denom, n, 1, -1, false)
+        <<         setToValue(flag, 0)
+        <<         setToValue(bit, 0)
+        <<     "]"
+        <<     movePtr(flag)
+        <<     "["
+        <<         incr(quot)
+        <<         decr(flag)
+        <<     "]"
+        <<     decr(count)
+        << "]"
+        << storeRegister(quot, n, divResult)
+        << storeRegister(rem, n, modResult);
+
+    return ops.str();
+}
+
+std::string BFGenerator::widePrintDecimal(int const value, int const n, int const bits, int const digits)
+{
+    // The decimal digits are built up by doubling them for every bit of the value
+    // (most significant first, shifted out of the register by doubling it) and adding
+    // the bit to the least significant digit. Digits that exceed 9 carry into the next.
+    validateAddr(value);
+    
+    int const reg   = getTempBlock(3 * n + 2, value);
+    int const bit   = reg + 3 * n;
+    int const count = reg + 3 * n + 1;
+    int const block = getTempBlock(digits + 3, value);
+    int const tmp1  = block + digits + 1;
+    int const tmp2  = block + digits + 2;
+
+    std::ostringstream ops;
+    ops << loadRegister(reg, n, value, n)
+        << setToValue(block, 0, digits + 3)
+        << setToValue(bit, 0)
+        << setToValue(count, bits)
+        << "["
+        <<     addToRegister(reg, n, reg, n, 3, bit, false);
+
+    for (int i = 0; i != digits; ++i)
+    {
+        int const digit = block + i;
+        ops << movePtr(digit)
+            << "["
+            <<     incr(tmp1)
+            <<     decr(digit)
+            << "]"
+            << movePtr(tmp1)
+            << "["
+            <<     incr(digit)
+            <<     incr(digit)
+            <<     decr(tmp1)
+            << "]"
+            << movePtr(bit)
+            << "["
+            <<     incr(digit)
+            <<     decr(bit)
+            << "]"
+            << greaterOrEqualConst(digit, 10, bit)
+            << assign(tmp2, bit)
+            << "["
+            <<     addConst(digit, -10)
+            <<     setToValue(tmp2, 0)
+            << "]";
+    }
+
+    ops <<     decr(count)
+        << "]"
+        << printDigits(block, digits);
+
+    return ops.str();
+}
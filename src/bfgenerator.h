@@ -4,22 +4,45 @@
 #include <iostream>
 #include <functional>
 #include <map>
+#include <vector>
 
 class BFGenerator
 {
-    size_t                  d_pointer{0};
-    std::function<int()>    f_getTemp;
-    std::function<int(int)> f_getTempBlock;
-    std::function<int()>    f_getMemSize;
+public:
+    enum class BitOp
+        {
+         AND,
+         OR,
+         XOR
+        };
+
+private:
+    static constexpr unsigned long MAX_UNARY_CONST{0xffff}; // larger constants are added in a loop
+
+    size_t                       d_pointer{0};
+    std::function<int(int)>      f_getTemp;
+    std::function<int(int, int)> f_getTempBlock;
+    std::function<int()>         f_getMemSize;
 
     std::map<int, int> d_profile;
+    std::map<std::pair<int, int>, int> d_transitions;
+
+    // Undo-log of profile-updates ({from, to}), only recorded while a checkpoint is active
+    int                              d_checkpoints{0};
+    std::vector<std::pair<int, int>> d_profileLog;
     
 public:
+    struct Checkpoint
+    {
+        size_t pointer;
+        size_t profileLogSize;
+    };
+    
     size_t getPointerIndex() const
     {
         return d_pointer;
     }
-    
+
     template <typename GetTemp>
     void setTempRequestFn(GetTemp &&getTemp)
     {
@@ -41,44 +64,135 @@ public:
     std::string movePtr(int const addr);
     std::string scan(int const addr);
     std::string print(int const addr);
+    std::string printConstants(int const cell, std::vector<int> const &deltas);
+    std::string printUntilZero(int const start, int const n);
+    std::string printDecimal(int const value, int const digits);
+    std::string scanDecimal(int const result);
     std::string random(int const addr);
-    std::string fetchElement(int const arrStart, int const arrSize, int const index, int const ret);
-    std::string setToValue(int const addr, int const val);
-    std::string setToValue(int const start, int const val, size_t const n);
+    std::string fetchElement(int const arrStart, int const arrSize, int const index, int const ret,
+                             bool const hasHeader = false);
+    std::string lookupConst(int const index, int const ret, std::vector<int> const &deltas,
+                            bool const consumeIndex = false);
+    std::string setToValue(int const addr, long const val);
+    std::string setToValue(int const start, long const val, size_t const n);
     std::string setToValuePlus(int const addr, int const val);
     std::string setToValuePlus(int const addr, int const val, size_t const n);
     std::string assign(int const lhs, int const rhs);
-    std::string assignElement(int const arrStart, int const arrSize, int const index, int const val);
-    std::string addTo(int const target, int const rhs);
-    std::string addConst(int const target, int const amount);
+    std::string move(int const lhs, int const rhs);
+    std::string assignElement(int const arrStart, int const arrSize, int const index, int const val,
+                              bool const hasHeader = false);
+    std::string fetchElement(int const arrStart, std::vector<int> const &dims,
+                             std::vector<int> const &indices, int const ret);
+    std::string assignElement(int const arrStart, std::vector<int> const &dims,
+                              std::vector<int> const &indices, int const val);
+    std::string copyBlock(int const dest, int const src, int const n);
+    std::string fillBlock(int const dest, int const value, int const n);
+    std::string compareBlock(int const lhs, int const rhs, int const n, int const result);
+    std::string compareCell(int const lhs, int const rhs, int const result);
+    std::string copyCounted(int const dest, int const src, int const count, bool const walkSrc);
+    std::string fillCounted(int const dest, int const value, int const count);
+    std::string compareCounted(int const lhs, int const rhs, int const count, int const result);
+    std::string rotateOut(int const arrStart);
+    std::string rotateIn(int const arrStart, int const arrSize);
+    std::string addTo(int const target, int const rhs, bool const consumeRhs = false);
+    std::string addConst(int const target, long const amount);
     std::string incr(int const target);
     std::string decr(int const target);
     std::string safeDecr(int const target, int const underflow);
-    std::string subtractFrom(int const target, int const rhs);
+    std::string subtractFrom(int const target, int const rhs, bool const consumeRhs = false);
     std::string multiply(int const lhs, int const rhs, int const result);
     std::string multiplyBy(int const target, int const rhs);
+    std::string multiplyConst(int const lhs, long const factor, int const result);
+    std::string multiplyByConst(int const target, long const factor);
     std::string power(int const lhs, int const rhs, int const result);
     std::string powerBy(int const lhs, int const rhs);
     std::string divmod(int const num, int const denom, int const divResult, int const modResult);
+    std::string divmodConst(int const num, int const denom, int const divResult, int const modResult);
     std::string equal(int const lhs, int const rhs, int const result);
     std::string notEqual(int const lhs, int const rhs, int const result);
     std::string greater(int const lhs, int const rhs, int const result);
     std::string less(int const lhs, int const rhs, int const result);
     std::string greaterOrEqual(int const lhs, int const rhs, int const result);
     std::string lessOrEqual(int const lhs, int const rhs, int const result);
+    std::string equalConst(int const lhs, long const value, int const result);
+    std::string notEqualConst(int const lhs, long const value, int const result);
+    std::string isZero(int const block);
+    std::string lessConst(int const lhs, long const bound, int const result);
+    std::string greaterOrEqualConst(int const lhs, long const bound, int const result);
     std::string logicalNot(int const operand);
     std::string logicalNot(int const operand, int const result);
+    std::string booleanNot(int const operand, int const result, bool const consumeOperand = false);
     std::string logicalAnd(int const lhs, int const rhs, int const result);
     std::string logicalAnd(int const lhs, int const rhs);
     std::string logicalOr(int const lhs, int const rhs, int const result);
     std::string logicalOr(int const lhs, int const rhs);
+    std::string bitwise(int const lhs, int const rhs, int const result, BitOp const op);
+    std::string shiftLeft(int const lhs, int const rhs, int const result);
+    std::string shiftRight(int const lhs, int const rhs, int const result);
+    std::string wideAdd(int const lhs, int const rhs, int const result, int const n);
+    std::string wideSubtract(int const lhs, int const rhs, int const result, int const n);
+    std::string wideMultiply(int const lhs, int const rhs, int const result, int const n, int const bits);
+    std::string wideDivmod(int const num, int const denom, int const divResult, int const modResult,
+                           int const n, int const bits);
+    std::string wideEqual(int const lhs, int const rhs, int const result, int const n);
+    std::string wideLess(int const lhs, int const rhs, int const result, int const n);
+    std::string widePrintDecimal(int const value, int const n, int const bits, int const digits);
+
+    Checkpoint checkpoint();
+    void rollback(Checkpoint const &cp);
+    void commit(Checkpoint const &cp);
+    bool visited(Checkpoint const &cp, int const first, int const last) const;
 
     inline std::map<int, int> const &profile() const
     {
         return d_profile;
     }
+
+    inline std::map<std::pair<int, int>, int> const &transitions() const
+    {
+        return d_transitions;
+    }
     
 private:
+    std::string fetchElementWithHeader(int const arrStart, int const index, int const ret);
+    std::string assignElementWithHeader(int const arrStart, int const index, int const val);
+    static std::string walkPacketRight(int const packetSize, std::vector<int> const &dims);
+    static std::string walkPacketLeft(int const packetSize, std::vector<int> const &dims);
+    static std::string stepPacketRight(int const packetSize);
+    static std::string walkCounted(int const packetSize, std::string const &op);
+    static std::string transfer(int const from, std::vector<int> const &to);
+    static std::string moves(int const n);
+    std::string compareConst(int const lhs, long const value, int const result, bool const equal);
+    std::string countDownConst(int const lhs, long const bound, int const result, bool const less);
+    std::string halve(int const block);
+    std::string combineBits(int const lhsBit, int const rhsBit, int const bit, int const tmp, BitOp const op);
+    std::string printDigits(int const block, int const digits);
+    std::string loadRegister(int const reg, int const n, int const src, int const m);
+    std::string storeRegister(int const reg, int const n, int const dest);
+    std::string carryIncr(int const reg, int const i, int const n, int const carry);
+    std::string borrowDecr(int const reg, int const i, int const n, int const borrow);
+    std::string addToRegister(int const reg, int const n, int const src, int const m, int const stride,
+                              int const carry, bool const subtract);
+
+    // Request temps close to the operands of a kernel and the current
+    // pointer-position, to keep pointer-movement between them to a minimum.
+    template <typename ... Addr>
+    int getTemp(Addr ... operands)
+    {
+        return f_getTemp(nearestTo(operands ...));
+    }
+
+    template <typename ... Addr>
+    int getTempBlock(int const sz, Addr ... operands)
+    {
+        return f_getTempBlock(sz, nearestTo(operands ...));
+    }
+
+    template <typename ... Addr>
+    int nearestTo(Addr ... operands) const
+    {
+        return (static_cast<int>(d_pointer) + ... + operands) / static_cast<int>(1 + sizeof ... (operands));
+    }
     
     template <typename ... Rest>
     void validateAddr__(std::string const &function, int first, Rest&& ... rest) const
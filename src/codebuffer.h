@@ -0,0 +1,37 @@
+#ifndef CODEBUFFER_H
+#define CODEBUFFER_H
+
+#include <string>
+
+// Append-only buffer for the generated BF-code. Unlike an ostringstream,
+// it can be truncated back to an earlier size without copying its contents,
+// which is what a rollback of the compiler-state requires.
+
+class CodeBuffer
+{
+    std::string d_code;
+
+public:
+    CodeBuffer &operator<<(std::string const &code)
+    {
+        d_code += code;
+        return *this;
+    }
+
+    size_t size() const
+    {
+        return d_code.size();
+    }
+
+    void truncate(size_t const sz)
+    {
+        d_code.resize(sz);
+    }
+
+    std::string const &str() const
+    {
+        return d_code;
+    }
+};
+
+#endif //CODEBUFFER_H
@@ -3,18 +3,19 @@
 namespace _MaxInt
 {
     template <typename T>
-    constexpr size_t _getMax()
+    constexpr unsigned long _getMax()
     {
-        return (static_cast<size_t>(1) << (8 * sizeof(T))) - 1;
+        return std::numeric_limits<T>::max();
     }
     
-    static size_t get(Compiler::CellType c)
+    static unsigned long get(Compiler::CellType c)
     {
         switch (c)
         {
         case Compiler::CellType::INT8:  return _getMax<uint8_t>();
         case Compiler::CellType::INT16: return _getMax<uint16_t>();
-        case Compiler::CellType::INT32: return _getMax<uint32_t>();;
+        case Compiler::CellType::INT32: return _getMax<uint32_t>();
+        case Compiler::CellType::INT64: return _getMax<uint64_t>();
         }
         throw -1;
     }
@@ -22,7 +23,8 @@ namespace _MaxInt
 
 Compiler::Compiler(Options const &opt):
     MAX_INT(_MaxInt::get(opt.cellType)),
-    MAX_ARRAY_SIZE(MAX_INT - 5),
+    MAX_RANGE(static_cast<long>(std::min<unsigned long>(MAX_INT, std::numeric_limits<long>::max()))),
+    MAX_ARRAY_SIZE(MAX_RANGE - 5),
     MAX_LOOP_UNROLL_ITERATIONS(opt.maxUnrollIterations),
     d_sourceFile(opt.bfxFile),
     d_cellType(opt.cellType),
@@ -44,44 +46,59 @@ Compiler::Compiler(Options const &opt):
     
     d_included.push_back(fileWithoutPath(opt.bfxFile));
     
-    d_bfGen.setTempRequestFn([this](){
-                                 return allocateTemp();
+    d_bfGen.setTempRequestFn([this](int const near){
+                                 return allocateTemp(1, near);
                              });
     
-    d_bfGen.setTempBlockRequestFn([this](int const sz){
-                                      return allocateTempBlock(sz);
+    d_bfGen.setTempBlockRequestFn([this](int const sz, int const near){
+                                      return allocateTempBlock(sz, near);
                                   });
     
     d_bfGen.setMemSizeRequestFn([this](){
                                     return d_memory.size();
                                 });
+
+    for (std::string const &file: opt.layoutProfiles)
+        compilerErrorIf(!d_layout.load(file), "Could not open layout-profile: ", file, ".");
+    d_layout.computeLayout();
 }
 
 Compiler::State Compiler::save()
 {
+    // Memory, BF-generator and code-buffer only record the changes made after this
+    // checkpoint; the state has to be either restored or committed.
     return {
-            .memory         = d_memory,
-            .scope          = d_scope,
-            .bfGen          = d_bfGen,
-            .buffer         = d_codeBuffer.str(),
-            .constEval      = d_constEvalEnabled,
-            .loopUnrolling  = d_loopUnrolling,
-            .boundsChecking = d_boundsCheckingEnabled,
-            .bcrMap         = d_bcrMap,
+            .memory           = d_memory.checkpoint(),
+            .scope            = d_scope,
+            .bfGen            = d_bfGen.checkpoint(),
+            .buffer           = d_codeBuffer.size(),
+            .constEval        = d_constEvalEnabled,
+            .loopUnrolling    = d_loopUnrolling,
+            .boundsChecking   = d_boundsCheckingEnabled,
+            .bcrMap           = d_bcrMap,
+            .localVariables   = d_localVariables,
+            .deferredLiterals = d_deferredLiterals
     };
 }
 
 void Compiler::restore(State &&state)
 {
-    d_memory                       = std::move(state.memory);
+    d_memory.rollback(state.memory);
+    d_bfGen.rollback(state.bfGen);
+    d_codeBuffer.truncate(state.buffer);
     d_scope                        = std::move(state.scope);
-    d_bfGen                        = std::move(state.bfGen);
     d_bcrMap                       = std::move(state.bcrMap);
+    d_localVariables               = std::move(state.localVariables);
+    d_deferredLiterals             = std::move(state.deferredLiterals);
     d_constEvalEnabled             = state.constEval;
     d_loopUnrolling                = state.loopUnrolling;
     d_boundsCheckingEnabled        = state.boundsChecking;
-    d_codeBuffer.str(state.buffer);
-    d_codeBuffer.seekp(0, std::ios_base::end);
+}
+
+void Compiler::commit(State const &state)
+{
+    d_memory.commit(state.memory);
+    d_bfGen.commit(state.bfGen);
 }
 
 void Compiler::disableBoundChecking()
@@ -97,33 +114,147 @@ void Compiler::enableBoundChecking()
 
 int Compiler::lex()
 {
-    int token = d_scanner.lex();
+    Token const token = nextToken();
+    ++d_tokenIndex;
 
-    switch (token)
+    switch (token.id)
     {
+    case FUNCTION:
+        {
+            d_parsedFunction = ParsedFunction{};
+            break;
+        }
+    case FOR:
+    case WHILE:
+        {
+            d_parsedFunction.loopStarts.push_back(d_tokenIndex);
+            break;
+        }
+    case SWITCH:
+        {
+            d_parsedFunction.switchStarts.push_back(d_tokenIndex);
+            break;
+        }
+    case BREAK:
+    case CONTINUE:
+        {
+            d_parsedFunction.jumps.push_back(d_tokenIndex);
+            break;
+        }
+    case RETURN:
+        {
+            d_parsedFunction.returns.push_back(d_tokenIndex);
+            break;
+        }
     case IDENT:
+        {
+            d_parsedFunction.occurrences[token.matched].push_back(d_tokenIndex);
+            d_val_.assign<Tag_::STRING>(token.matched);
+            break;
+        }
     case STR:
         {
-            d_val_.assign<Tag_::STRING>(d_scanner.matched());
+            d_val_.assign<Tag_::STRING>(token.matched);
             break;
         }
     case NUM:
         {
-            d_val_.assign<Tag_::INT>(std::stoi(d_scanner.matched()));
+            d_val_.assign<Tag_::INT>(std::stol(token.matched));
             break;
         }
     case CHR:
         {
-            d_val_.assign<Tag_::CHAR>(d_scanner.matched()[0]);
+            d_val_.assign<Tag_::CHAR>(token.matched[0]);
             break;
         }
     default:
         break;
     }
 
+    return token.id;
+}
+
+Compiler::Token Compiler::nextToken()
+{
+    if (peekToken(0).id == '[')
+        rewriteArrayDeclaration();
+    else if (peekToken(0).id == IDENT && peekToken(1).id == '[')
+        rewriteStructArrayAccess();
+
+    Token const token = d_tokens.front();
+    d_tokens.pop_front();
     return token;
 }
 
+Compiler::Token const &Compiler::peekToken(size_t const n)
+{
+    // The scanner is not consulted again once the end of the input was reached
+    while (d_tokens.size() <= n)
+    {
+        int const id = (!d_tokens.empty() && d_tokens.back().id == 0) ? 0 : d_scanner.lex();
+        d_tokens.push_back(Token{id, d_scanner.matched()});
+    }
+
+    return d_tokens[n];
+}
+
+void Compiler::rewriteArrayDeclaration()
+{
+    // [16] Snake segs  ->  [Snake[16]] segs
+    // [H][W] grid      ->  [[H][W]] grid
+    // where the type-names are resolved by declaredType(). The sizes may be numbers or
+    // constants.
+    size_t end = 0;
+    while (peekToken(end).id == '[' &&
+           (peekToken(end + 1).id == NUM || peekToken(end + 1).id == IDENT) &&
+           peekToken(end + 2).id == ']')
+        end += 3;
+
+    if (end == 0 || peekToken(end).id != IDENT)
+        return;
+
+    std::string sizes;
+    for (size_t idx = 0; idx != end; idx += 3)
+        sizes += '[' + d_tokens[idx + 1].matched + ']';
+
+    if (end == 3 && peekToken(4).id == IDENT)
+        d_tokens[1] = Token{IDENT, d_tokens[3].matched + sizes};
+    else if (end > 3)
+        d_tokens[1] = Token{IDENT, sizes};
+    else
+        return;
+
+    d_tokens.erase(d_tokens.begin() + 3, d_tokens.begin() + end + (end == 3));
+}
+
+void Compiler::rewriteStructArrayAccess()
+{
+    // segs[i].x.y  ->  segs.x.y[i]: in the struct-of-arrays layout, each field of the
+    // element-struct is an array that is indexed directly.
+    size_t close = 1;
+    for (int depth = 0; ; ++close)
+    {
+        int const id = peekToken(close).id;
+        if (id == 0)
+            return;
+        if (id == '[')
+            ++depth;
+        else if (id == ']' && --depth == 0)
+            break;
+    }
+
+    size_t end = close + 1;
+    while (peekToken(end).id == '.' && peekToken(end + 1).id == IDENT)
+        end += 2;
+
+    if (end == close + 1)
+        return;
+
+    std::vector<Token> const fields(d_tokens.begin() + close + 1, d_tokens.begin() + end);
+    d_tokens.erase(d_tokens.begin() + close + 1, d_tokens.begin() + end);
+    d_tokens.insert(d_tokens.begin() + 1, fields.begin(), fields.end());
+}
+
 std::string Compiler::fileWithoutPath(std::string const &file)
 {
     size_t const pos = file.find_last_of("/\\");
@@ -161,6 +292,9 @@ void Compiler::pushStream(std::string const &file)
 
 bool Compiler::setConstEval(bool const enable)
 {
+    // Constant evaluation is disabled and enabled around each runtime branch or loop
+    forgetExpressions();
+    
     static int count = 0;
     if (enable)
     {
@@ -172,7 +306,11 @@ bool Compiler::setConstEval(bool const enable)
     {
         ++count;
         if (not d_constEvalEnabled)
+        {
+            // Deferred literals have to be written before the nested branch or loop
+            writeDeferredLiterals();
             return false;
+        }
 
         // Sync all variables that are currently in scope.
         std::vector<int> scopeCells = d_memory.cellsInScope(d_scope.current());
@@ -232,6 +370,15 @@ void Compiler::writeProfile() const
     std::ofstream file(d_profileFile);
     compilerErrorIf(!file, "Could not open file for profile: ", d_profileFile, ".");
 
+    // Pointer travel is counted in the code that is written, which includes the moves
+    // made inside the kernels (not just those between cells).
+    std::string const code = cancelOppositeCommands(d_codeBuffer.str());
+    long const travel = std::count_if(code.begin(), code.end(),
+                                      [](char const c)
+                                      {
+                                          return c == '<' || c == '>';
+                                      });
+
     file << "Profile for " << d_sourceFile << ":\n"
          << "    cell-type:        " << d_cellType << '\n'
          << "    optimization:     " << (d_constEvalEnabled ? "O1" : "O0") << '\n'
@@ -239,15 +386,47 @@ void Compiler::writeProfile() const
          << "    max unroll:       " << MAX_LOOP_UNROLL_ITERATIONS << '\n'
          << "    random extension: " << (d_randomExtensionEnabled ? "enabled" : "disabled") << '\n'
          << '\n'
-         << "Number of BF operations generated: " << d_codeBuffer.str().size() << '\n'
+         << "Number of BF operations generated: " << d_codeBuffer.size() << '\n'
          << "Number of cells required:          " << d_memory.cellsRequired() << '\n'
+         << "Peak number of cells in use:       " << d_memory.peakCellsInUse() << '\n'
+         << "Total pointer travel:              " << travel << '\n'
          << '\n'
          << "+---------+---------+\n"
          << "| address | #visits |\n"
          << "+---------+---------+\n";
     
-    for (auto const &pr: d_bfGen.profile())
+    auto const &profile = d_bfGen.profile();
+    for (auto const &pr: profile)
         file << pr.first << ": " << pr.second << '\n';
+
+    // Cells occupied by each of the variables and struct-fields, which can be fed back
+    // to the compiler (--layout-profile) together with this or a runtime profile.
+    file << '\n'
+         << "+----------+---------+------+---------+\n"
+         << "| variable | address | size | #visits |\n"
+         << "+----------+---------+------+---------+\n";
+
+    for (auto const &[key, cells]: d_layoutCells)
+    {
+        for (auto const &[addr, size]: cells)
+        {
+            int visits = 0;
+            for (int i = 0; i != size; ++i)
+            {
+                auto const it = profile.find(addr + i);
+                visits += (it != profile.end()) ? it->second : 0;
+            }
+            file << key << ": " << addr << ' ' << size << ' ' << visits << '\n';
+        }
+    }
+
+    file << '\n'
+         << "+------------+--------+\n"
+         << "| transition | #moves |\n"
+         << "+------------+--------+\n";
+
+    for (auto const &[move, count]: d_bfGen.transitions())
+        file << move.first << '-' << move.second << ": " << count << '\n';
 }
 
 void Compiler::write()
@@ -320,11 +499,90 @@ void Compiler::error()
               << d_scanner.filename() << '\n';
 }
 
+Instruction Compiler::addLoop(Instruction const &loop)
+{
+    auto &starts = d_parsedFunction.loopStarts;
+    if (starts.empty())
+        return loop;
+
+    // The parser may already have read the token following the loop, which might
+    // itself start a new loop.
+    auto const startIt = (starts.back() == d_tokenIndex && starts.size() > 1) ? starts.end() - 2 : starts.end() - 1;
+    int const start = *startIt;
+    int const end = d_tokenIndex;
+    d_parsedFunction.loops.push_back({start, end});
+    starts.erase(startIt);
+
+    // Break and continue belong to the innermost loop they occur in (which is reduced
+    // first); return affects all enclosing loops. A loop without any of these doesn't
+    // need flags of its own.
+    auto const inLoop = [=](int const pos)
+                        {
+                            return pos > start && pos < end;
+                        };
+
+    auto &jumps = d_parsedFunction.jumps;
+    auto const claimed = std::remove_if(jumps.begin(), jumps.end(), inLoop);
+    bool const usesBcr = (claimed != jumps.end()) ||
+        std::any_of(d_parsedFunction.returns.begin(), d_parsedFunction.returns.end(), inLoop);
+    jumps.erase(claimed, jumps.end());
+
+    return [=, this]()
+           {
+               bool const enclosing = d_loopUsesBcr;
+               d_loopUsesBcr = usesBcr;
+               int const ret = loop();
+               d_loopUsesBcr = enclosing;
+               return ret;
+           };
+}
+
+void Compiler::addSwitch()
+{
+    // When lowered to an if-else ladder, the selector and case-values are evaluated
+    // after the bodies of the preceding cases. For the liveness of the identifiers
+    // involved, a switch-statement is therefore treated like a loop.
+    auto &starts = d_parsedFunction.switchStarts;
+    if (starts.empty())
+        return;
+
+    // The parser may already have read the token following the switch, which might
+    // itself start a new switch.
+    auto const startIt = (starts.back() == d_tokenIndex && starts.size() > 1) ? starts.end() - 2 : starts.end() - 1;
+    d_parsedFunction.loops.push_back({*startIt, d_tokenIndex});
+    starts.erase(startIt);
+}
+
 void Compiler::addFunction(BFXFunction const &bfxFunc)
 {
     compilerErrorIf(!validateFunction(bfxFunc), "Duplicate parameters used in the definition of function \"",
             bfxFunc.name(), "\".");
 
+    // An identifier is used up to its last occurrence, or up to the end of the outermost
+    // loop it occurs in (the loop-condition is evaluated again after the body). Identifiers
+    // are matched by name only, which is conservative when names are shadowed. The return
+    // variable is live until the end of the function.
+    auto &lastUse = d_lastUse[bfxFunc.mangled()];
+    for (auto const &[ident, positions]: d_parsedFunction.occurrences)
+    {
+        if (ident == bfxFunc.returnVariable())
+            continue;
+
+        int last = positions.back();
+        for (auto const &[begin, end]: d_parsedFunction.loops)
+        {
+            auto const it = std::lower_bound(positions.begin(), positions.end(), begin);
+            if (it != positions.end() && *it <= end)
+                last = std::max(last, end);
+        }
+        lastUse[ident] = last;
+    }
+
+    // The loops have claimed their break and continue statements. A function that
+    // contains no return statements (or stray jumps) doesn't need flags of its own.
+    if (!d_parsedFunction.returns.empty() || !d_parsedFunction.jumps.empty())
+        d_bcrFunctions.insert(bfxFunc.mangled());
+
     auto result = d_functionMap.insert({bfxFunc.mangled(), bfxFunc});
     compilerErrorIf(!result.second,
                     "Redefinition of function \"", bfxFunc.name(), "\" with ", bfxFunc.params().size(),
@@ -354,8 +612,13 @@ void Compiler::addStruct(std::string const &name,
                 "Maximum array size (", MAX_ARRAY_SIZE, ") exceeded in struct definition (got ", sz, ").");
     }
 
-    // All OK, add to typesystem
-    bool const added = TypeSystem::add(name, fields);
+    // All OK, add to typesystem (with its fields placed in the order suggested by the
+    // layout-profile, if any)
+    std::vector<std::string> fieldNames;
+    for (auto const &pr: fields)
+        fieldNames.push_back(pr.first);
+
+    bool const added = TypeSystem::add(name, fields, d_layout.fieldOrder(name, fieldNames));
     compilerErrorIf(!added, "Struct ", name, " previously defined.");
 }
 
@@ -379,19 +642,35 @@ void Compiler::addGlobals(std::vector<std::pair<std::string, TypeSystem::Type>>
     {
         auto const &[ident, type] = var;
         compilerErrorIf(type.size() <= 0, "Global declaration of \"", ident, "\" has invalid size specification.");
-        d_memory.allocate(ident, "", type);
+        allocateNamed(ident, "", type, "");
     }
 }
 
-void Compiler::addConstant(std::string const &ident, int const num)
+void Compiler::addConstant(std::string const &ident, long const num)
 {
-    compilerWarningIf(num > MAX_INT, "use of value ", num, " exceeds limit of ", MAX_INT, ".");
+    compilerWarningIf(num > MAX_RANGE, "use of value ", num, " exceeds limit of ", MAX_INT, ".");
+    compilerErrorIf(ident == "u16" || ident == "u32",
+            "Cannot define constant ", ident, ": this name is reserved for the wide integer type.");
     auto result = d_constMap.insert({ident, num});
-    compilerErrorIf(!result.second,
+    compilerErrorIf(!result.second || isConstTable(ident),
+            "Redefinition of constant ", ident, " is not allowed.");
+}
+
+void Compiler::addConstTable(std::string const &ident, int const sz, std::vector<long> const &values)
+{
+    compilerErrorIf(ident == "u16" || ident == "u32",
+            "Cannot define constant ", ident, ": this name is reserved for the wide integer type.");
+    compilerErrorIf(sz <= 0 || sz > MAX_ARRAY_SIZE,
+            "Invalid size (", sz, ") of constant table ", ident, "; must lie between 1 and ", MAX_ARRAY_SIZE, ".");
+    compilerErrorIf((int)values.size() != sz,
+            "Constant table ", ident, " of size ", sz, " is initialized with ", values.size(), " values.");
+
+    auto result = d_constTables.insert({ident, std::vector<int>(values.begin(), values.end())});
+    compilerErrorIf(!result.second || isCompileTimeConstant(ident),
             "Redefinition of constant ", ident, " is not allowed.");
 }
 
-int Compiler::compileTimeConstant(std::string const &ident) const
+long Compiler::compileTimeConstant(std::string const &ident) const
 {
     compilerErrorIf(!isCompileTimeConstant(ident),
             ident, " is being used as a const but was not defined as such.");
@@ -404,9 +683,82 @@ bool Compiler::isCompileTimeConstant(std::string const &ident) const
     return d_constMap.find(ident) != d_constMap.end();
 }
 
+bool Compiler::isConstTable(std::string const &ident) const
+{
+    return d_constTables.find(ident) != d_constTables.end();
+}
+
+TypeSystem::Type Compiler::declaredType(std::string const &ident) const
+{
+    // [u16] and [u32] declare integers of 16 and 32 bits (these names can't be constants).
+    // Arrays of structs are named Snake[16] by the lexer, multi-dimensional arrays [H][W].
+    auto const sizeOf = [&](std::string const &size) -> int
+                        {
+                            return std::isdigit(size[0]) ? std::stoi(size) : compileTimeConstant(size);
+                        };
+    
+    if (ident[0] == '[')
+    {
+        std::vector<int> dims;
+        for (size_t open = 0; open != std::string::npos; open = ident.find('[', open + 1))
+        {
+            int const dim = sizeOf(ident.substr(open + 1, ident.find(']', open) - open - 1));
+            compilerErrorIf(dim <= 0 || dim > MAX_ARRAY_SIZE,
+                            "Invalid dimension (", dim, ") of multi-dimensional array; each dimension "
+                            "must lie between 1 and ", MAX_ARRAY_SIZE, ".");
+            dims.push_back(dim);
+        }
+        return TypeSystem::Type(dims);
+    }
+    
+    size_t const bracket = ident.find('[');
+    if (bracket != std::string::npos)
+    {
+        std::string const size = ident.substr(bracket + 1, ident.size() - bracket - 2);
+        return structArrayType(ident.substr(0, bracket), sizeOf(size));
+    }
+    
+    if (ident == "u16")
+        return wideType(16);
+    if (ident == "u32")
+        return wideType(32);
+
+    return TypeSystem::Type(compileTimeConstant(ident));
+}
+
+TypeSystem::Type Compiler::structArrayType(std::string const &structName, int const n) const
+{
+    // An array of structs is laid out as a struct holding an array for each of the
+    // fields of its element-type (recursively for nested structs), such that an element
+    // of a field is fetched from a single array, without moving whole structs.
+    TypeSystem::Type const element(structName);
+    compilerErrorIf(!element.defined(), "Unknown struct \"", structName, "\" in declaration of array of structs.");
+    compilerErrorIf(n <= 0 || n > MAX_ARRAY_SIZE,
+                    "Invalid size (", n, ") of array of structs of type \"", structName, "\".");
+
+    std::string const name = structName + '[' + std::to_string(n) + ']';
+    if (TypeSystem::Type(name).defined())
+        return TypeSystem::Type(name);
+
+    std::vector<std::pair<std::string, TypeSystem::Type>> fields;
+    std::vector<std::string> fieldNames;
+    for (auto const &f: element.fields())
+    {
+        compilerErrorIf(!f.type.isStructType() && f.type.size() != 1,
+                        "Field \"", f.name, "\" of struct \"", structName, "\" is not a single cell; "
+                        "arrays of structs can only hold single cells and structs.");
+
+        fields.push_back({f.name, f.type.isStructType() ? structArrayType(f.type.name(), n) : TypeSystem::Type(n)});
+        fieldNames.push_back(f.name);
+    }
+
+    TypeSystem::add(name, fields, d_layout.fieldOrder(name, fieldNames));
+    return TypeSystem::Type(name);
+}
+
 int Compiler::allocate(std::string const &ident, TypeSystem::Type type)
 {
-    int const addr = d_memory.allocate(ident, d_scope.current(), type);
+    int const addr = allocateNamed(ident, d_scope.current(), type, d_scope.function());
 
     if (!d_loopUnrolling)
     {
@@ -420,31 +772,124 @@ int Compiler::allocate(std::string const &ident, TypeSystem::Type type)
     return addr;
 }
 
-int Compiler::addressOf(std::string const &ident)
+int Compiler::allocateNamed(std::string const &ident, std::string const &scope, TypeSystem::Type type,
+                            std::string const &function)
+{
+    // Place the variable next to the live variable it was visited together with most
+    // often according to the layout-profile. Otherwise, use the first free cell(s).
+    std::string const key = LayoutProfile::variableKey(ident, function);
+    int near = -1;
+    for (std::string const &partner: d_layout.partners(key))
+    {
+        auto const it = d_liveVariables.find(partner);
+        if (it == d_liveVariables.end())
+            continue;
+
+        auto const &[partnerAddr, partnerIdent] = it->second;
+        if (d_memory.identifier(partnerAddr) == partnerIdent)
+        {
+            near = partnerAddr + d_memory.sizeOf(partnerAddr);
+            break;
+        }
+    }
+    
+    int const addr = d_memory.allocate(ident, scope, type, near);
+    if (addr >= 0)
+    {
+        d_liveVariables[key] = {addr, ident};
+        recordLayout(key, addr, type);
+        trackLiveness(ident, addr);
+    }
+
+    return addr;
+}
+
+void Compiler::recordLayout(std::string const &key, int const addr, TypeSystem::Type type)
+{
+    d_layoutCells[key].insert({addr, type.size()});
+    if (!type.isStructType())
+        return;
+
+    for (auto const &f: type.fields())
+        recordLayout(LayoutProfile::fieldKey(type.name(), f.name), addr + f.offset, f.type);
+}
+
+void Compiler::trackLiveness(std::string const &ident, int const addr)
+{
+    std::string const scope = d_memory.scope(addr);
+    std::string const function = scope.substr(0, scope.find("::"));
+
+    auto const table = d_lastUse.find(function);
+    if (table == d_lastUse.end())
+        return;
+    
+    auto const it = table->second.find(ident);
+    if (it != table->second.end())
+        d_localVariables.push_back({function, ident, scope, addr, it->second});
+}
+
+void Compiler::freeDeadVariables(int const token)
+{
+    // Release the variables of the current function that are not used beyond the
+    // statement that ended at this token. Variables that have been released by
+    // leaving their scope, or that still have an alias pointing into them, are
+    // skipped.
+    std::string const function = d_scope.function();
+    std::erase_if(d_localVariables,
+                  [&](LocalVariable const &var)
+                  {
+                      if (var.function != function || var.lastUse >= token)
+                          return false;
+
+                      bool const valid = d_memory.identifier(var.addr) == var.ident &&
+                          d_memory.scope(var.addr) == var.scope;
+                      if (!valid)
+                          return true;
+                      if (d_memory.aliased(var.addr))
+                          return false;
+
+                      d_memory.freeVariable(var.addr);
+                      return true;
+                  });
+}
+
+int Compiler::addressOf(std::string const &ident, bool const passOn)
 {
     int addr = d_memory.find(ident, d_scope.current());
     addr = (addr != -1) ? addr : d_memory.find(ident, "");
     compilerErrorIf(addr < 0, "Variable \"", ident, "\" not declared in this scope.");
+
+    // A deferred string literal has to be on the tape before it is used, unless it is
+    // passed on as is
+    if (!passOn)
+        writeDeferredLiterals(addr);
+
     return addr;
 }
 
-int Compiler::allocateTemp(TypeSystem::Type type)
+// When given an address, temps are placed as close as possible to it.
+// Otherwise, the first free cell(s) will be used.
+
+int Compiler::allocateTemp(TypeSystem::Type type, int const near)
 {
-    return d_memory.getTemp(d_scope.function(), type);
+    return d_memory.getTemp(d_scope.function(), type, near);
 }
 
-int Compiler::allocateTemp(int const sz)
+int Compiler::allocateTemp(int const sz, int const near)
 {
-    return d_memory.getTemp(d_scope.function(), sz);
+    return allocateTemp(TypeSystem::Type(sz), near);
 }
 
-int Compiler::allocateTempBlock(int const sz)
+int Compiler::allocateTempBlock(int const sz, int const near)
 {
-    return d_memory.getTempBlock(d_scope.function(), sz);
+    return d_memory.getTempBlock(d_scope.function(), sz, near);
 }
 
 int Compiler::sizeOfOperator(std::string const &ident)
 {
+    if (isConstTable(ident))
+        return constVal(d_constTables.at(ident).size());
+
     int const sz = d_memory.sizeOf(ident, d_scope.current());
     compilerErrorIf(sz == 0, "Variable \"", ident ,"\" not declared in this scope.");
 
@@ -472,16 +917,15 @@ int Compiler::staticAssert(Instruction const &check, std::string const &msg)
     return -1;
 }
 
-int Compiler::statement(Instruction const &instr)
+int Compiler::statement(Instruction const &instr, int const token)
 {
-    if (d_bcrEnabled)
+    if (bcrActive())
     {
         int const continueFlag = getCurrentContinueFlag();
         int const breakFlag = getCurrentBreakFlag();
 
         Instruction const condition = [&, this](){ return logicalAnd(continueFlag, breakFlag); };
-        Instruction const elseBody = [](){ return -1; };
-        ifStatement(condition, instr, elseBody, false);
+        ifStatement(condition, instr, Instruction{}, false);
     }
     else
     {
@@ -489,11 +933,62 @@ int Compiler::statement(Instruction const &instr)
     }
     
     d_memory.freeTemps(d_scope.current());
+    freeDeadVariables(token);
+    pruneExpressions();
     return -1;
 }
 
 int Compiler::call(std::string const &name, std::vector<Instruction> const &args)
 {
+    // Builtins that are called like regular functions
+    static std::map<std::string, NullaryFunction> const nullaryBuiltins{
+        {"__scand", &Compiler::scanDecimal}
+    };
+    
+    static std::map<std::string, UnaryFunction> const unaryBuiltins{
+        {"__prints", &Compiler::printString},
+        {"__printd", &Compiler::printDecimal}
+    };
+    
+    static std::map<std::string, TernaryFunction> const ternaryBuiltins{
+        {"__memcpy", &Compiler::copyCells},
+        {"__memset", &Compiler::fillCells},
+        {"__memcmp", &Compiler::compareCells}
+    };
+
+    auto const nullary = nullaryBuiltins.find(name);
+    if (nullary != nullaryBuiltins.end())
+    {
+        compilerErrorIf(args.size() != 0,
+                        "Builtin function \"", name, "\" expects no arguments, but got ", args.size(), ".");
+        return (this->*(nullary->second))();
+    }
+    
+    auto const unary = unaryBuiltins.find(name);
+    if (unary != unaryBuiltins.end())
+    {
+        compilerErrorIf(args.size() != 1,
+                        "Builtin function \"", name, "\" expects 1 argument, but got ", args.size(), ".");
+        return (this->*(unary->second))(args[0]);
+    }
+    
+    auto const ternary = ternaryBuiltins.find(name);
+    if (ternary != ternaryBuiltins.end())
+    {
+        compilerErrorIf(args.size() != 3,
+                        "Builtin function \"", name, "\" expects 3 arguments, but got ", args.size(), ".");
+        return (this->*(ternary->second))(args[0], args[1], args[2]);
+    }
+    
+    // A function-call is never part of a common subexpression; its body is not even
+    // compiled while probing.
+    if (d_probing)
+    {
+        int const tmp = allocateTemp();
+        d_memory.setValueUnknown(tmp);
+        return tmp;
+    }
+    
     // Check if the function exists
     std::string const mangled = BFXFunction::mangle(name, args.size());
 
@@ -509,19 +1004,29 @@ int Compiler::call(std::string const &name, std::vector<Instruction> const &args
     bool returnVariableIsReferenceParameter = false;
     for (size_t idx = 0; idx != args.size(); ++idx)
     {
+        // Check if the parameter is passed by value or reference
+        auto const &[paramIdent, paramType] = params[idx]; 
+
         // Evaluate argument that's passed in and get its size
-        int const argAddr = args[idx]();
+        int const argAddr = (paramType == BFXFunction::ParameterType::Reference) ? passLiteral(args[idx])
+                                                                                 : args[idx]();
         compilerErrorIf(argAddr < 0,
                 "Invalid argument argument to function \"", func.name(),
                 "\": the expression passed as argument ", idx, " returns void.");
-
-        // Check if the parameter is passed by value or reference
-        auto const &[paramIdent, paramType] = params[idx]; 
         if (paramType == BFXFunction::ParameterType::Value)
         {
-            // Allocate local variable for the function of the correct size
-            // and copy argument to this location
-            int const paramAddr = d_memory.allocate(paramIdent, func.mangled(), d_memory.type(argAddr));
+            // A temporary argument is moved into the function by renaming it to the
+            // parameter. Otherwise, allocate local variable for the function of the
+            // correct size and copy argument to this location
+            if (d_memory.isTemp(argAddr) && !isShared(argAddr))
+            {
+                d_memory.rename(argAddr, paramIdent, func.mangled());
+                trackLiveness(paramIdent, argAddr);
+                continue;
+            }
+            
+            int const paramAddr = allocateNamed(paramIdent, func.mangled(), d_memory.type(argAddr),
+                                                func.mangled());
             assign(paramAddr, argAddr);
         }
         else // Reference
@@ -533,10 +1038,13 @@ int Compiler::call(std::string const &name, std::vector<Instruction> const &args
         }
     }
 
-    // Execute body of the function
+    // Execute body of the function. Its runtime branches don't affect the bcr-flags of
+    // the caller, so they don't keep the caller's loops from being unrolled either.
+    int const branches = d_runtimeBranches;
     enterScope(func.mangled());
     func.body()();
     exitScope(func.mangled());
+    d_runtimeBranches = branches;
 
     // Move return variable to local scope before cleaning up (if non-void)
     int ret = -1;
@@ -559,16 +1067,19 @@ int Compiler::call(std::string const &name, std::vector<Instruction> const &args
     return ret;
 }
 
-int Compiler::constVal(int const num)
+int Compiler::constVal(long const num)
 {
-    compilerWarningIf(num > MAX_INT, "use of value ", num, " exceeds limit of ", MAX_INT, ".");
+    // Values that don't fit in a single cell become wide integers
+    if (num > MAX_RANGE)
+        return wideLiteral(num);
     
     int const tmp = allocateTemp();
     constEvalSetToValue(tmp, num);
 
-    if (!d_constEvalEnabled)
+    if (!d_constEvalEnabled && !d_probing)
         runtimeSetToValue(tmp, num);
 
+    d_memory.markLiteral(tmp);
     return tmp;
 }
 
@@ -582,7 +1093,8 @@ int Compiler::declareVariable(std::string const &ident, TypeSystem::Type type)
     compilerErrorIf(sz < 0,
             "Size must be specified in declaration without initialization of variable ", ident);
 
-    compilerErrorIf(type.isIntType() && sz > MAX_ARRAY_SIZE,
+    // The dimensions of a multi-dimensional array are checked separately
+    compilerErrorIf(type.isIntType() && type.dimensions().empty() && sz > MAX_ARRAY_SIZE,
                 "Maximum array size (", MAX_ARRAY_SIZE, ") exceeded (got ", sz, ").");
 
     return allocate(ident, type);
@@ -592,12 +1104,13 @@ int Compiler::initializeExpression(std::string const &ident, TypeSystem::Type ty
 {
     // Check validity of arguments:
     // 1. Size must not equal 0. -1 is okay; this signals that the size has to be deduced.
-    // 2. If it's an intType, its size cannot exceed the MAX_ARRAY_SIZE.
+    // 2. If it's an intType, its size cannot exceed the MAX_ARRAY_SIZE (unless it has
+    //    multiple dimensions).
     // 3. The type needs te be previously defined, in case of user-defined struct-type.
     
     int const sz = type.size();
     compilerErrorIf(sz == 0, "Cannot declare variable \"", ident, "\" of size 0.");
-    compilerErrorIf(type.isIntType() && sz > MAX_ARRAY_SIZE,
+    compilerErrorIf(type.isIntType() && type.dimensions().empty() && sz > MAX_ARRAY_SIZE,
                     "Maximum array size (", MAX_ARRAY_SIZE, ") exceeded (got ", sz, ").");
     compilerErrorIf(!type.defined(), "Variable \'", ident, "\' declared with unknown type.");
 
@@ -633,15 +1146,16 @@ int Compiler::initializeExpression(std::string const &ident, TypeSystem::Type ty
     // the middle of loop-unrolling.
     
     TypeSystem::Type rhsType = d_memory.type(rhs);
-    if (d_memory.isTemp(rhs) && (sz == -1 || type == rhsType) && !d_loopUnrolling)
+    if (d_memory.isTemp(rhs) && !isShared(rhs) && (sz == -1 || type == rhsType) && !d_loopUnrolling)
     {
         // In this situation, we can simply rename the temporary variable that resulted
         // from evaluating rhs to the declared variable.
         
         d_memory.rename(rhs, ident, d_scope.current());
+        trackLiveness(ident, rhs);
         return rhs;
     }
-    else if (type == rhsType || (type.isIntType() && rhsType.isIntType()))
+    else if (type == rhsType || (!type.isStructType() && !rhsType.isStructType()))
     {
         // rhs is not a temp, so we need to copy the result into a newly allocated
         // variable.
@@ -665,117 +1179,831 @@ void Compiler::sync(int const addr)
         runtimeSetToValue(addr, d_memory.value(addr));
 }
 
-int Compiler::wrapValue(int val)
+int Compiler::passLiteral(AddressOrInstruction const &arg)
 {
-    val %= (MAX_INT + 1);
-    if (val < 0)
-        val += MAX_INT + 1;
-
-    return val;
+    // Evaluates an argument that may be a deferred string literal, or a variable
+    // referring to one. Only the instruction that is evaluated directly can pass it on.
+    int const enclosing = d_literalDepth;
+    d_literalDepth = d_instructionDepth + 1;
+    int const addr = arg;
+    d_literalDepth = enclosing;
+    return addr;
 }
 
-void Compiler::constEvalSetToValue(int const addr, int const val)
+void Compiler::writeDeferredLiterals(int const addr)
 {
-    int const newVal = wrapValue(val);
-    d_memory.setSync(addr, false);
-    d_memory.value(addr) = newVal;
+    // Writes the deferred literals in the given variable (or all of them) to the tape.
+    // Cells that were written or freed in the meantime have a different version.
+    if (d_deferredLiterals.empty())
+        return;
+
+    int const end = (addr == -1) ? -1 : addr + d_memory.sizeOf(addr);
+    std::erase_if(d_deferredLiterals, [&](std::pair<int, int> const &cell)
+                                      {
+                                          auto const [cellAddr, version] = cell;
+                                          if (d_memory.version(cellAddr) != version)
+                                              return true;
+                                          if (addr != -1 && (cellAddr < addr || cellAddr >= end))
+                                              return false;
+
+                                          runtimeSetToValue(cellAddr, d_memory.value(cellAddr));
+                                          return true;
+                                      });
 }
 
-void Compiler::runtimeSetToValue(int const addr, int const val)
+void Compiler::printConstants(std::vector<int> const &chars)
 {
-    int newVal = wrapValue(val);
-    d_codeBuffer << d_bfGen.setToValue(addr, newVal);
-    d_memory.value(addr) = newVal;
-    d_memory.setSync(addr, true);
+    // Prints known characters from a single temp, which is stepped from each
+    // character to the next.
+    if (chars.empty())
+        return;
+
+    std::vector<int> deltas;
+    int prev = 0;
+    for (int const ch: chars)
+    {
+        deltas.push_back(signedValue(ch - prev));
+        prev = ch;
+    }
+
+    int const cell = allocateTemp();
+    d_codeBuffer << d_bfGen.printConstants(cell, deltas);
+    d_memory.setValueUnknown(cell);
 }
 
-void Compiler::runtimeAssign(int const lhs, int const rhs)
+long Compiler::wrapValue(long const val) const
 {
-    d_codeBuffer << d_bfGen.assign(lhs, rhs);
-    d_memory.setValueUnknown(lhs);
+    // The number of values in a cell is a power of 2, so wrapping is a mask. On 64-bit
+    // cells, values from 2^63 are held in their two's complement representation.
+    return static_cast<long>(static_cast<unsigned long>(val) & MAX_INT);
 }
-    
-int Compiler::assign(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
+
+long Compiler::signedValue(long const val) const
 {
-    compilerErrorIf(lhs < 0 || rhs < 0, "Use of void expression in assignment.");
-    
-    int const leftSize = d_memory.sizeOf(lhs);
-    int const rightSize = d_memory.sizeOf(rhs);
-    auto const leftType = d_memory.type(lhs);
-    auto const rightType = d_memory.type(rhs);
+    // Constants are added using the shortest sequence of increments or decrements
+    unsigned long const wrapped = static_cast<unsigned long>(val) & MAX_INT;
+    return static_cast<long>((wrapped > MAX_INT / 2 + 1) ? (wrapped | ~MAX_INT) : wrapped);
+}
 
-    compilerErrorIf((leftType.isStructType() || rightType.isStructType()) && !(leftType == rightType),
-                    "Incompatible types in assignment: ", leftType.name(), " and ", rightType.name(), ".");
+bool Compiler::isConstant(int const addr) const
+{
+    // When constant evaluation is disabled (in runtime loops), the known values of
+    // variables can't be relied upon, but those of literals can.
+    return d_constEvalEnabled ? d_memory.valueKnown(addr) : d_memory.isLiteral(addr);
+}
 
-    compilerErrorIf(leftSize != rightSize && leftSize != 1 && rightSize != 1,
-                    "Assignment to array of size ", leftSize,
-                    " with object of incompatible size ", rightSize, ".");
-    
-    if (leftSize > 1 && rightSize == 1)
-    {
-        // Fill array with value
-        if (d_constEvalEnabled && d_memory.valueKnown(rhs))
-        {
-            for (int i = 0; i != leftSize; ++i)
-                constEvalSetToValue(lhs + i, d_memory.value(rhs));
-        }
-        else
-        {
-            for (int i = 0; i != leftSize; ++i)
-                runtimeAssign(lhs + i, rhs);
-        }
-    }
-    else if (leftSize == rightSize)
-    {
-        // Same size -> copy
-        if (d_constEvalEnabled)
-        {
-            for (int i = 0; i != leftSize; ++i)
-            {
-                if (d_memory.valueKnown(rhs + i))
-                    constEvalSetToValue(lhs + i, d_memory.value(rhs + i));
-                else
-                    runtimeAssign(lhs + i, rhs + i);
-            }
-        }
-        else
-        {
-            for (int i = 0; i != leftSize; ++i)
-                runtimeAssign(lhs + i, rhs + i);
-        }
-    }
-    else if (leftSize == 1)
-    {
-        if (d_constEvalEnabled && d_memory.valueKnown(rhs))
-            constEvalSetToValue(lhs, d_memory.value(rhs));
-        else
-            runtimeAssign(lhs, rhs);
-    }    
-    else
+bool Compiler::isDeadTemp(AddressOrInstruction const &operand)
+{
+    // The temporary result of a subexpression is only used by the operation it is
+    // passed to, which may therefore consume it. Its expression can then no longer
+    // be reused.
+    if (!isTempResult(operand))
+        return false;
+
+    auto const held = d_expressions.held.find(operand);
+    if (held != d_expressions.held.end())
     {
-        assert(false && "all other cases should have been caught by compiler errors");
+        auto const available = d_expressions.available.find(held->second.first);
+        if (available != d_expressions.available.end() && available->second.first == operand)
+            d_expressions.available.erase(available);
+        
+        d_expressions.held.erase(held);
     }
 
-    return lhs;
+    return true;
 }
 
-int Compiler::fetch(std::string const &ident)
+bool Compiler::isTempResult(AddressOrInstruction const &operand) const
 {
-    if (isCompileTimeConstant(ident))
-        return constVal(compileTimeConstant(ident));
-    
-    int const addr = addressOf(ident);
-    return addr;
+    return operand.isExpression() && d_memory.isTemp(operand) && !isShared(operand);
 }
 
-int Compiler::fetchField(std::vector<std::string> const &expr)
+bool Compiler::isShared(int const addr) const
 {
-    assert(expr.size() > 1 && "Got field with less than 2 elements");
-    
-    int const addr = addressOf(expr[0]);
-    compilerErrorIf(addr < 0, "Unknown variable \"", expr[0], "\".");
-
-    return fetchFieldImpl(expr, addr, 0);
+    // A temporary that was handed out as the result of a common subexpression may still
+    // be referred to by the expression that computed it.
+    auto const it = d_expressions.shared.find(addr);
+    return it != d_expressions.shared.end() && it->second == d_memory.version(addr);
+}
+
+Compiler::Range Compiler::rangeOf(AddressOrInstruction const &operand) const
+{
+    // Bounds on the value of an operand, which are part of constant evaluation. Like
+    // known values, the ranges of variables can't be relied upon in runtime loops,
+    // except for those pinned to a loop-counter. The range of the result of a
+    // subexpression holds wherever it is used.
+    if (!d_constEvalAllowed)
+        return {0, MAX_RANGE};
+
+    if (isConstant(operand) && d_memory.value(operand) >= 0)
+        return {d_memory.value(operand), d_memory.value(operand)};
+
+    auto const [lower, upper] = d_memory.range(operand);
+    bool const reliable = d_constEvalEnabled || isTempResult(operand) || d_memory.rangePinned(operand);
+    if (!reliable || upper == -1)
+        return {0, MAX_RANGE};
+
+    return {lower, upper};
+}
+
+void Compiler::narrowRange(int const addr, Range const &range)
+{
+    // Outside of constant evaluation, only the ranges of temporaries are recorded
+    auto const [lower, upper] = range;
+    if (!d_constEvalAllowed || (!d_constEvalEnabled && !d_memory.isTemp(addr)) || isConstant(addr))
+        return;
+
+    if (lower < 0 || lower > upper || upper >= MAX_RANGE || upper > std::numeric_limits<int>::max())
+        return;
+
+    d_memory.setRange(addr, lower, upper);
+}
+
+int Compiler::withRange(int const result, Range const &range)
+{
+    narrowRange(result, range);
+    return result;
+}
+
+int Compiler::lessByRange(Range const &lhs, Range const &rhs)
+{
+    // 1 or 0 when lhs < rhs follows from the ranges of the operands, -1 otherwise
+    if (lhs.second < rhs.first)
+        return 1;
+    if (lhs.first >= rhs.second)
+        return 0;
+    return -1;
+}
+
+int Compiler::equalByRange(Range const &lhs, Range const &rhs)
+{
+    if (lhs.second < rhs.first || rhs.second < lhs.first)
+        return 0;
+    if (lhs.first == lhs.second && rhs.first == rhs.second)
+        return 1;
+    return -1;
+}
+
+std::string Compiler::valueNumber(int const addr) const
+{
+    // Identifies the value in a cell: constants by their value, temporaries by the
+    // expression they hold and other cells by their address and version.
+    if (addr < 0 || d_memory.sizeOf(addr) != 1)
+        return "";
+    if (isConstant(addr))
+        return std::to_string(static_cast<unsigned long>(d_memory.value(addr)));
+    if (!d_memory.isTemp(addr))
+    {
+        std::ostringstream number;
+        number << '@' << addr << '.' << d_memory.version(addr);
+        return number.str();
+    }
+
+    std::string const key = heldExpression(addr);
+    return key.empty() ? "" : ("(" + key + ")");
+}
+
+std::string Compiler::probeValueNumber(AddressOrInstruction const &operand)
+{
+    // While probing, the arithmetic and comparisons only determine the value-number of
+    // their result without generating code. The operand has a value-number when it can
+    // be evaluated this way without generating other code or changing any variable.
+    if (!operand.isExpression())
+        return valueNumber(operand);
+    
+    State state = save();
+    d_probing = true;
+    int const addr = operand.peek();
+    bool const pure = d_codeBuffer.size() == state.buffer && !d_memory.modifiedSince(state.memory);
+    std::string const number = pure ? valueNumber(addr) : "";
+    d_probing = false;
+    restore(std::move(state));
+    return number;
+}
+
+std::pair<std::string, int> Compiler::reuseExpression(std::string const &op, AddressOrInstruction const &lhs,
+                                                      AddressOrInstruction const &rhs, bool const commutative)
+{
+    // Returns the key of a binary expression and a cell that still holds its result, or
+    // -1 when it has to be evaluated. While probing, a temporary standing in for the
+    // result is returned instead. Expressions that are folded at compiletime are skipped.
+    if (!d_constEvalAllowed)
+        return {"", -1};
+
+    std::string lhsNumber = d_probing ? valueNumber(lhs) : probeValueNumber(lhs);
+    std::string rhsNumber = d_probing ? valueNumber(rhs) : probeValueNumber(rhs);
+    auto const constant = [](std::string const &number)
+                          {
+                              return !number.empty() && std::isdigit(number[0]);
+                          };
+
+    if (d_constEvalEnabled && constant(lhsNumber) && constant(rhsNumber))
+        return {"", -1};
+
+    if (lhsNumber.empty() || rhsNumber.empty())
+    {
+        if (!d_probing)
+            return {"", -1};
+
+        int const tmp = allocateTemp();
+        d_memory.setValueUnknown(tmp);
+        return {"", tmp};
+    }
+
+    if (commutative && rhsNumber < lhsNumber)
+        std::swap(lhsNumber, rhsNumber);
+
+    std::string const key = op + "(" + lhsNumber + "," + rhsNumber + ")";
+    if (d_probing)
+    {
+        int const tmp = allocateTemp();
+        d_memory.setValueUnknown(tmp);
+        return {key, recordExpression(key, tmp)};
+    }
+
+    auto const it = d_expressions.available.find(key);
+    if (it == d_expressions.available.end() || d_memory.version(it->second.first) != it->second.second)
+    {
+        if (it != d_expressions.available.end())
+            d_expressions.available.erase(it);
+        if (d_invariants != nullptr)
+            d_invariants->insert({key, Invariant{op, lhsNumber, rhsNumber}});
+        return {key, -1};
+    }
+
+    int const holder = it->second.first;
+    int const version = it->second.second;
+
+    if (d_memory.isTemp(holder))
+        d_expressions.shared[holder] = version;
+
+    return {key, holder};
+}
+
+int Compiler::recordExpression(std::string const &key, int const result)
+{
+    if (key.empty() || result < 0 || isConstant(result) || !d_memory.isTemp(result))
+        return result;
+
+    int const version = d_memory.version(result);
+    d_expressions.held[result] = {key, version};
+    if (!d_probing)
+        d_expressions.available[key] = {result, version};
+
+    return result;
+}
+
+void Compiler::holdExpression(int const holder, std::string const &key)
+{
+    // Called after the result of an expression has been assigned to a variable
+    if (!key.empty() && !d_probing && !d_memory.isTemp(holder))
+        d_expressions.available[key] = {holder, d_memory.version(holder)};
+}
+
+std::string Compiler::heldExpression(int const addr) const
+{
+    auto const it = d_expressions.held.find(addr);
+    if (it == d_expressions.held.end() || it->second.second != d_memory.version(addr))
+        return "";
+
+    return it->second.first;
+}
+
+void Compiler::forgetExpressions()
+{
+    // Results computed before a runtime loop-body or branch cannot be relied upon inside
+    // it (the loop may have changed them, the other branch may not have computed them)
+    // and those computed inside it cannot be relied upon after it. Reused temporaries
+    // remain marked, because they may still be referred to.
+    if (d_probing)
+        return;
+
+    d_expressions.available.clear();
+    d_expressions.held.clear();
+    for (auto const &[key, entry]: d_expressions.hoisted)
+    {
+        d_expressions.available[key] = entry;
+        d_expressions.held[entry.first] = {key, entry.second};
+    }
+}
+
+void Compiler::pruneExpressions()
+{
+    auto const stale = [this](int const addr, int const version)
+                       {
+                           return d_memory.version(addr) != version;
+                       };
+
+    std::erase_if(d_expressions.available, [&](auto const &entry)
+                                           {
+                                               return stale(entry.second.first, entry.second.second);
+                                           });
+    std::erase_if(d_expressions.held, [&](auto const &entry)
+                                      {
+                                          return stale(entry.first, entry.second.second);
+                                      });
+    std::erase_if(d_expressions.shared, [&](auto const &entry)
+                                        {
+                                            return stale(entry.first, entry.second);
+                                        });
+}
+
+void Compiler::hoistInvariants(Instruction const &iteration)
+{
+    // Compiles a single iteration of a runtime loop to find the expressions it evaluates
+    // and the cells it writes to, and then discards it. Expressions of constants and of
+    // cells that are not written anywhere in the loop are evaluated once, in front of it.
+    // References share the address of the cell they refer to, so writes through an
+    // alias count as writes to that cell.
+    if (!d_constEvalAllowed || d_probing || d_invariants != nullptr)
+        return;
+
+    Invariants candidates;
+    Expressions const expressions = d_expressions;
+    State state = save();
+    d_invariants = &candidates;
+    forgetExpressions();
+    iteration();
+    d_invariants = nullptr;
+    std::set<int> const written = d_memory.writtenSince(state.memory);
+    restore(std::move(state));
+    d_expressions = expressions;
+
+    // Only those results that are cheaper to copy than to compute are worth a cell
+    // throughout the loop: comparisons, quotients and products of two variables.
+    // Their operands are hoisted along with them.
+    auto const constant = [](std::string const &number)
+                          {
+                              return std::isdigit(number[0]);
+                          };
+    
+    for (auto const &[key, candidate]: candidates)
+    {
+        bool const worthwhile = (candidate.op == "*") ? !constant(candidate.lhs) && !constant(candidate.rhs)
+                                                      : (candidate.op != "+" && candidate.op != "-");
+        
+        if (worthwhile && isInvariant("(" + key + ")", candidates, written))
+            hoistExpression(key, candidates);
+    }
+}
+
+void Compiler::enterRuntimeLoop()
+{
+    // The body of a runtime loop is a runtime branch (see forStatement())
+    ++d_runtimeBranches;
+}
+
+bool Compiler::isInvariant(std::string const &number, Invariants const &candidates, std::set<int> const &written) const
+{
+    if (std::isdigit(number[0]))
+        return true;
+
+    if (number[0] == '@')
+    {
+        size_t const dot = number.find('.');
+        int const addr = std::stoi(number.substr(1, dot - 1));
+        int const version = std::stoi(number.substr(dot + 1));
+        return !written.contains(addr) && d_memory.version(addr) == version;
+    }
+
+    auto const it = candidates.find(number.substr(1, number.size() - 2));
+    if (it == candidates.end())
+        return false;
+
+    // Division by zero would not terminate, and the loop may be guarding against it
+    auto const &[op, lhs, rhs] = it->second;
+    if ((op == "/" || op == "%") && (!std::isdigit(rhs[0]) || std::stoul(rhs) == 0))
+        return false;
+
+    return isInvariant(lhs, candidates, written) && isInvariant(rhs, candidates, written);
+}
+
+int Compiler::hoistExpression(std::string const &key, Invariants const &candidates)
+{
+    static std::map<std::string, BinaryFunction> const operations{
+        {"+",  &Compiler::add},
+        {"-",  &Compiler::subtract},
+        {"*",  &Compiler::multiply},
+        {"/",  &Compiler::divide},
+        {"%",  &Compiler::modulo},
+        {"==", &Compiler::equal},
+        {"!=", &Compiler::notEqual},
+        {"<",  &Compiler::less},
+        {"<=", &Compiler::lessOrEqual}
+    };
+
+    auto const hoisted = d_expressions.hoisted.find(key);
+    if (hoisted != d_expressions.hoisted.end())
+        return hoisted->second.first;
+
+    auto const operand = [&](std::string const &number) -> int
+                         {
+                             if (std::isdigit(number[0]))
+                                 return constVal(std::stoul(number));
+                             if (number[0] == '@')
+                                 return std::stoi(number.substr(1, number.find('.') - 1));
+
+                             return hoistExpression(number.substr(1, number.size() - 2), candidates);
+                         };
+
+    auto const &[op, lhs, rhs] = candidates.at(key);
+    int const lhsAddr = operand(lhs);
+    int const rhsAddr = operand(rhs);
+    int const result = (this->*operations.at(op))(lhsAddr, rhsAddr);
+    auto const available = d_expressions.available.find(key);
+    if (available == d_expressions.available.end() || available->second.first != result)
+        return result;
+
+    // The result may not be consumed by any of the expressions that reuse it
+    if (d_memory.isTemp(result))
+        d_expressions.shared[result] = available->second.second;
+    
+    d_expressions.hoisted[key] = available->second;
+    return result;
+}
+
+void Compiler::constEvalSetToValue(int const addr, long const val)
+{
+    long const newVal = wrapValue(val);
+    d_memory.setSync(addr, false);
+    d_memory.setValue(addr, newVal);
+}
+
+void Compiler::runtimeSetToValue(int const addr, long const val)
+{
+    long const newVal = wrapValue(val);
+    d_codeBuffer << d_bfGen.setToValue(addr, newVal);
+    d_memory.setValue(addr, newVal);
+    d_memory.setSync(addr, true);
+}
+
+void Compiler::runtimeAssign(int const lhs, int const rhs)
+{
+    d_codeBuffer << d_bfGen.assign(lhs, rhs);
+    d_memory.setValueUnknown(lhs);
+}
+
+void Compiler::runtimeMove(int const lhs, int const rhs)
+{
+    d_codeBuffer << d_bfGen.move(lhs, rhs);
+    d_memory.setValueUnknown(lhs);
+    d_memory.setValueUnknown(rhs);
+}
+    
+int Compiler::assign(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
+{
+    compilerErrorIf(lhs < 0 || rhs < 0, "Use of void expression in assignment.");
+    
+    int const leftSize = d_memory.sizeOf(lhs);
+    int const rightSize = d_memory.sizeOf(rhs);
+    auto const leftType = d_memory.type(lhs);
+    auto const rightType = d_memory.type(rhs);
+
+    compilerErrorIf((leftType.isStructType() || rightType.isStructType()) && !(leftType == rightType),
+                    "Incompatible types in assignment: ", leftType.name(), " and ", rightType.name(), ".");
+
+    // Integers of different widths are zero-extended or truncated to the type of lhs
+    if (leftType.isWideType() && !(leftType == rightType))
+        return assign(lhs, convert(rhs, leftType));
+
+    compilerWarningIf(rightType.isWideType() && leftSize == 1 && d_memory.isLiteral(rhs) && wideValue(rhs) > MAX_INT,
+                      "use of value ", wideValue(rhs), " exceeds limit of ", MAX_INT, ".");
+
+    compilerErrorIf(leftSize != rightSize && leftSize != 1 && rightSize != 1,
+                    "Assignment to array of size ", leftSize,
+                    " with object of incompatible size ", rightSize, ".");
+    
+    if (leftSize > 1 && rightSize == 1)
+    {
+        // Fill array with value
+        if (d_constEvalEnabled && d_memory.valueKnown(rhs))
+        {
+            for (int i = 0; i != leftSize; ++i)
+                constEvalSetToValue(lhs + i, d_memory.value(rhs));
+        }
+        else
+        {
+            runtimeFill(lhs, rhs, leftSize);
+        }
+    }
+    else if (leftSize == rightSize)
+    {
+        // Same size -> copy (or move, when rhs is not used afterwards). A variable
+        // that is assigned the result of an expression now holds that expression.
+        Range const range = rangeOf(rhs);
+        std::string const expression = heldExpression(rhs);
+        assignBlock(lhs, rhs, leftSize, lhs != rhs && isDeadTemp(rhs));
+        if (leftSize == 1)
+        {
+            narrowRange(lhs, range);
+            holdExpression(lhs, expression);
+        }
+    }
+    else if (leftSize == 1)
+    {
+        if (d_constEvalEnabled && d_memory.valueKnown(rhs))
+            constEvalSetToValue(lhs, d_memory.value(rhs));
+        else if (lhs != rhs && isDeadTemp(rhs))
+            runtimeMove(lhs, rhs);
+        else
+            runtimeAssign(lhs, rhs);
+    }    
+    else
+    {
+        assert(false && "all other cases should have been caught by compiler errors");
+    }
+
+    return lhs;
+}
+
+void Compiler::assignBlock(int const lhs, int const rhs, int const n, bool const consumeRhs)
+{
+    // Known values are copied at compile-time. When there are none, an array is
+    // copied by the BF-generator in a single pass that doesn't need temporaries,
+    // unless it can simply be moved cell by cell.
+    bool anyKnown = false;
+    for (int i = 0; d_constEvalEnabled && i != n; ++i)
+        anyKnown = anyKnown || d_memory.valueKnown(rhs + i);
+
+    if (!anyKnown && !consumeRhs && n > 1 && lhs != rhs && d_memory.hasArrayHeader(rhs))
+    {
+        d_codeBuffer << d_bfGen.copyBlock(lhs, rhs, n);
+        for (int i = 0; i != n; ++i)
+            d_memory.setValueUnknown(lhs + i);
+        return;
+    }
+    
+    for (int i = 0; i != n; ++i)
+    {
+        if (d_constEvalEnabled && d_memory.valueKnown(rhs + i))
+            constEvalSetToValue(lhs + i, d_memory.value(rhs + i));
+        else if (consumeRhs)
+            runtimeMove(lhs + i, rhs + i);
+        else
+            runtimeAssign(lhs + i, rhs + i);
+    }
+}
+
+void Compiler::runtimeFill(int const lhs, int const rhs, int const n)
+{
+    // The value can't be part of the block that is cleared before filling it
+    int value = rhs;
+    if (rhs >= lhs && rhs < lhs + n)
+    {
+        value = allocateTemp();
+        runtimeAssign(value, rhs);
+    }
+
+    if (d_constEvalEnabled)
+        sync(value);
+
+    d_codeBuffer << d_bfGen.fillBlock(lhs, value, n);
+    for (int i = 0; i != n; ++i)
+        d_memory.setValueUnknown(lhs + i);
+}
+
+int Compiler::runtimeCount(AddressOrInstruction const &count, int const limit)
+{
+    // A count that is only known at runtime is limited to the number of cells of the
+    // operands, such that the BF-kernels never walk beyond the end of an array.
+    int result = count;
+    if (rangeOf(count).second > limit)
+        result = subtract(count, multiply(greater(count, constVal(limit)), subtract(count, constVal(limit))));
+
+    if (d_constEvalEnabled)
+        sync(result);
+
+    return result;
+}
+
+void Compiler::runtimeCountedCells(int const count, int const limit, std::function<void(int const)> const &op)
+{
+    // Applies op to the first count cells (at most limit), where count is only known at
+    // runtime. Each cell is guarded by an in-place zero-test of the remaining count. This
+    // is only used when neither operand has an array-header to walk through (e.g. structs).
+    int const tmp = allocateTempBlock(4);
+    int const remaining = tmp + 0;
+    int const done = tmp + 1;
+    int const flag = tmp + 3;
+    
+    d_codeBuffer << d_bfGen.assign(remaining, count);
+    for (int i = 0; i != limit; ++i)
+    {
+        d_codeBuffer << d_bfGen.isZero(remaining)
+                     << d_bfGen.setToValue(flag, 1)
+                     << d_bfGen.movePtr(done)
+                     << "["
+                     <<     d_bfGen.setToValue(flag, 0)
+                     <<     d_bfGen.setToValue(done, 0)
+                     << "]"
+                     << d_bfGen.movePtr(flag)
+                     << "[";
+        op(i);
+        d_codeBuffer <<     d_bfGen.decr(remaining)
+                     <<     d_bfGen.setToValue(flag, 0)
+                     << "]";
+    }
+}
+
+int Compiler::copyCells(AddressOrInstruction const &dest, AddressOrInstruction const &src,
+                        AddressOrInstruction const &count)
+{
+    compilerErrorIf(dest < 0 || src < 0 || count < 0, "Use of void-expression in call to __memcpy.");
+
+    int const limit = std::min(d_memory.sizeOf(dest), d_memory.sizeOf(src));
+    if (isConstant(count))
+    {
+        int const n = d_memory.value(count);
+        compilerErrorIf(n > limit, "Number of cells passed to __memcpy (", n, ") exceeds the size of its arguments.");
+        if (dest != src)
+            assignBlock(dest, src, n);
+
+        return dest;
+    }
+
+    // Copying an array onto itself is a no-op; assign() would clear it first
+    if (dest == src)
+        return dest;
+
+    // Cells beyond the count keep their value, so dest has to be synced as well
+    for (int i = 0; d_constEvalEnabled && i != limit; ++i)
+    {
+        sync(src + i);
+        sync(dest + i);
+    }
+
+    int const n = runtimeCount(count, limit);
+    if (d_memory.hasArrayHeader(src) || d_memory.hasArrayHeader(dest))
+    {
+        d_codeBuffer << d_bfGen.copyCounted(dest, src, n, d_memory.hasArrayHeader(src));
+    }
+    else
+    {
+        runtimeCountedCells(n, limit, [&](int const i)
+                                      {
+                                          d_codeBuffer << d_bfGen.assign(dest + i, src + i);
+                                      });
+    }
+    
+    for (int i = 0; i != limit; ++i)
+        d_memory.setValueUnknown(dest + i);
+
+    return dest;
+}
+
+int Compiler::fillCells(AddressOrInstruction const &dest, AddressOrInstruction const &value,
+                        AddressOrInstruction const &count)
+{
+    compilerErrorIf(dest < 0 || value < 0 || count < 0, "Use of void-expression in call to __memset.");
+
+    int const limit = d_memory.sizeOf(dest);
+    if (isConstant(count))
+    {
+        int const n = d_memory.value(count);
+        compilerErrorIf(n > limit, "Number of cells passed to __memset (", n, ") exceeds the size of its argument.");
+        if (isConstant(value))
+        {
+            for (int i = 0; i != n; ++i)
+            {
+                if (d_constEvalEnabled)
+                    constEvalSetToValue(dest + i, d_memory.value(value));
+                else
+                {
+                    // Like any runtime write to a variable, the value is not known
+                    // beyond the enclosing branch or loop
+                    d_codeBuffer << d_bfGen.setToValue(dest + i, wrapValue(d_memory.value(value)));
+                    d_memory.setValueUnknown(dest + i);
+                }
+            }
+        }
+        else if (n > 0)
+        {
+            runtimeFill(dest, value, n);
+        }
+
+        return dest;
+    }
+
+    if (d_constEvalEnabled)
+        sync(value);
+
+    // The value can't be part of the block that is overwritten while filling it
+    int fill = value;
+    if (value >= dest && value < dest + limit)
+    {
+        fill = allocateTemp();
+        runtimeAssign(fill, value);
+    }
+
+    for (int i = 0; d_constEvalEnabled && i != limit; ++i)
+        sync(dest + i);
+
+    int const n = runtimeCount(count, limit);
+    if (d_memory.hasArrayHeader(dest))
+    {
+        d_codeBuffer << d_bfGen.fillCounted(dest, fill, n);
+    }
+    else
+    {
+        runtimeCountedCells(n, limit, [&](int const i)
+                                      {
+                                          d_codeBuffer << d_bfGen.assign(dest + i, fill);
+                                      });
+    }
+
+    for (int i = 0; i != limit; ++i)
+        d_memory.setValueUnknown(dest + i);
+
+    return dest;
+}
+
+int Compiler::compareCells(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs,
+                           AddressOrInstruction const &count)
+{
+    // Results in 1 when the first count cells of lhs and rhs are equal, 0 otherwise
+    compilerErrorIf(lhs < 0 || rhs < 0 || count < 0, "Use of void-expression in call to __memcmp.");
+
+    int const limit = std::min(d_memory.sizeOf(lhs), d_memory.sizeOf(rhs));
+    bool const constCount = isConstant(count);
+    int const n = constCount ? d_memory.value(count) : limit;
+    compilerErrorIf(n > limit, "Number of cells passed to __memcmp (", n, ") exceeds the size of its arguments.");
+
+    int const result = allocateTemp();
+    if (lhs == rhs)
+        return constantResult(result, 1);
+    
+    if (d_constEvalEnabled && constCount)
+    {
+        bool allKnown = true;
+        bool equal = true;
+        for (int i = 0; i != n; ++i)
+        {
+            allKnown = allKnown && d_memory.valueKnown(lhs + i) && d_memory.valueKnown(rhs + i);
+            equal = equal && allKnown && d_memory.value(lhs + i) == d_memory.value(rhs + i);
+        }
+
+        if (allKnown)
+            return constantResult(result, equal);
+    }
+
+    for (int i = 0; d_constEvalEnabled && i != n; ++i)
+    {
+        sync(lhs + i);
+        sync(rhs + i);
+    }
+    
+    d_codeBuffer << d_bfGen.setToValue(result, 1);
+    if (!constCount && (d_memory.hasArrayHeader(lhs) || d_memory.hasArrayHeader(rhs)))
+    {
+        // Equality is symmetric, so the operands can be swapped to walk into rhs
+        bool const swap = !d_memory.hasArrayHeader(lhs);
+        int const n = runtimeCount(count, limit);
+        d_codeBuffer << d_bfGen.compareCounted(swap ? rhs : lhs, swap ? lhs : rhs, n, result);
+    }
+    else if (!constCount)
+    {
+        int const n = runtimeCount(count, limit);
+        runtimeCountedCells(n, limit, [&](int const i)
+                                      {
+                                          d_codeBuffer << d_bfGen.compareCell(lhs + i, rhs + i, result);
+                                      });
+    }
+    else if (n > 1 && (d_memory.hasArrayHeader(rhs) || d_memory.hasArrayHeader(lhs)))
+    {
+        // Equality is symmetric, so the operands can be swapped to use the header of lhs
+        bool const swap = !d_memory.hasArrayHeader(rhs);
+        d_codeBuffer << d_bfGen.compareBlock(swap ? rhs : lhs, swap ? lhs : rhs, n, result);
+    }
+    else
+    {
+        for (int i = 0; i != n; ++i)
+            d_codeBuffer << d_bfGen.compareCell(lhs + i, rhs + i, result);
+    }
+
+    d_memory.setValueUnknown(result);
+    return result;
+}
+
+int Compiler::fetch(std::string const &ident)
+{
+    if (isCompileTimeConstant(ident))
+        return constVal(compileTimeConstant(ident));
+
+    if (isConstTable(ident))
+        return constTable(ident);
+    
+    int const addr = addressOf(ident, d_instructionDepth == d_literalDepth);
+    return addr;
+}
+
+int Compiler::fetchField(std::vector<std::string> const &expr)
+{
+    assert(expr.size() > 1 && "Got field with less than 2 elements");
+    
+    int const addr = addressOf(expr[0]);
+    compilerErrorIf(addr < 0, "Unknown variable \"", expr[0], "\".");
+
+    return fetchFieldImpl(expr, addr, 0);
 }
 
 int Compiler::fetchFieldImpl(std::vector<std::string> const &expr, int const baseAddr, size_t const baseIdx)
@@ -843,12 +2071,22 @@ int Compiler::arrayFromString(std::string const &str)
     compilerErrorIf(sz > MAX_ARRAY_SIZE,
             "Maximum array size (", MAX_ARRAY_SIZE, ") exceeded (got ", sz, ").");
 
+    // In runtime code, the literal is only written to the tape right away when it
+    // can't be passed on (see passLiteral()).
+    bool const defer = !d_constEvalEnabled && d_instructionDepth == d_literalDepth;
     int const start = allocateTemp(sz);
     for (int idx = 0; idx != sz; ++idx)
     {
         constEvalSetToValue(start + idx, str[idx]);
-        if (!d_constEvalEnabled)
+        if (d_constEvalEnabled)
+            continue;
+
+        if (!defer)
             runtimeSetToValue(start + idx, str[idx]);
+
+        d_memory.markLiteral(start + idx);
+        if (defer)
+            d_deferredLiterals.push_back({start + idx, d_memory.version(start + idx)});
     }
 
     return start;
@@ -885,12 +2123,259 @@ int Compiler::anonymousStructObject(std::string const name, std::vector<Instruct
 
 int Compiler::fetchElement(AddressOrInstruction const &arr, AddressOrInstruction const &index)
 {
+    int const indexAddr = index;
+    if (std::string const table = indexedTable(indexedOperand(arr)); !table.empty())
+        return lookupTable(table, indexAddr);
+
+    SubArray const sub = subscript(arr, indexAddr);
+    if (sub.array == -1)
+        return fetchFlatElement(arr, index);
+
+    if (sub.indices.size() < d_memory.type(sub.array).dimensions().size())
+        return subArray(sub);
+
+    return fetchMultiElement(sub.array, sub.indices);
+}
+
+int Compiler::assignElement(AddressOrInstruction const &arr, AddressOrInstruction const &index, AddressOrInstruction const &rhs)
+{
+    int const indexAddr = index;
+    std::string const table = indexedTable(indexedOperand(arr));
+    compilerErrorIf(!table.empty(), "Cannot assign to an element of constant table ", table, ".");
+
+    SubArray const sub = subscript(arr, indexAddr);
+    if (sub.array == -1)
+        return assignFlatElement(arr, index, rhs);
+
+    compilerErrorIf(sub.indices.size() < d_memory.type(sub.array).dimensions().size(),
+                    "Cannot assign to a row of multi-dimensional array \"", d_memory.identifier(sub.array),
+                    "\"; specify an index for each of its dimensions.");
+
+    return assignMultiElement(sub.array, sub.indices, rhs);
+}
+
+Compiler::SubArray Compiler::subscript(int const arr, int const index) const
+{
+    // Indexing a multi-dimensional array yields a sub-array, which only collects the
+    // index: the element is accessed once an index is known for each dimension.
+    // Returns {-1} when arr is a flat array.
+    auto const it = d_subArrays.find(arr);
+    if (it != d_subArrays.end() && it->second.version == d_memory.version(arr))
+    {
+        SubArray sub = it->second;
+        sub.indices.push_back(index);
+        return sub;
+    }
+
+    if (d_memory.type(arr).dimensions().size() > 1)
+        return SubArray{arr, {index}, 0};
+
+    return SubArray{-1, {}, 0};
+}
+
+int Compiler::subArray(SubArray sub)
+{
+    int const tmp = allocateTemp();
+    sub.version = d_memory.version(tmp);
+    d_subArrays[tmp] = sub;
+    return tmp;
+}
+
+int Compiler::indexedOperand(AddressOrInstruction const &arr)
+{
+    // Evaluates the operand of the index-operator. A constant table is only passed on
+    // as a handle when it's the operand itself (see constTable()).
+    int const enclosing = d_tableDepth;
+    d_tableDepth = d_instructionDepth + 1;
+    int const addr = arr;
+    d_tableDepth = enclosing;
+    return addr;
+}
+
+std::string Compiler::indexedTable(int const arr) const
+{
+    // Returns the name of the constant table represented by arr, if any
+    auto const it = d_tableHandles.find(arr);
+    return (it != d_tableHandles.end() && it->second.second == d_memory.version(arr)) ? it->second.first : "";
+}
+
+int Compiler::constTable(std::string const &ident)
+{
+    // A constant table that is indexed is represented by a handle, its elements are
+    // never allocated. Anywhere else, the table is copied to a temporary array, like
+    // a string literal.
+    if (d_instructionDepth == d_tableDepth)
+    {
+        int const handle = allocateTemp();
+        d_tableHandles[handle] = {ident, d_memory.version(handle)};
+        return handle;
+    }
+
+    std::vector<int> const &values = d_constTables.at(ident);
+    int const sz = values.size();
+    int const start = allocateTemp(sz);
+    for (int idx = 0; idx != sz; ++idx)
+    {
+        constEvalSetToValue(start + idx, values[idx]);
+        if (!d_constEvalEnabled)
+            runtimeSetToValue(start + idx, values[idx]);
+    }
+
+    return start;
+}
+
+int Compiler::lookupTable(std::string const &ident, AddressOrInstruction const &index)
+{
+    // The value is selected from the constant table at compiletime when the index is
+    // known. Otherwise, the index is counted down to add the constants that build up
+    // the selected value in the result (see BFGenerator::lookupConst()). Only the part
+    // of the table within the range of the index is visited; an index beyond the end
+    // of the table yields 0.
+    std::vector<int> const &table = d_constTables.at(ident);
+    int const sz = table.size();
+    Range const range = rangeOf(index);
+    compilerWarningIf(d_boundsCheckingEnabled && range.first >= sz,
+                      "Array index (", (range.first == range.second ? "" : "at least "), range.first,
+                      ") out of bounds: sizeof(", ident, ") = ", sz, ".");
+
+    if (isConstant(index))
+    {
+        int const idx = d_memory.value(index);
+        return constVal(idx < sz ? table[idx] : 0);
+    }
+
+    std::vector<int> values(table.begin(), table.begin() + std::min<long>(sz, range.second + 1));
+    if (range.second >= sz)
+        values.push_back(0);
+
+    auto const [lowest, highest] = std::minmax_element(values.begin(), values.end());
+    if (*lowest == *highest)
+        return constVal(values[0]);
+
+    // Values that do not fit a cell wrap around when selected at runtime
+    bool const fits = *highest <= MAX_RANGE;
+    compilerWarningIf(!fits, "use of value ", *highest, " exceeds limit of ", MAX_INT, ".");
+
+    std::vector<int> deltas;
+    int prev = 0;
+    for (int const value: values)
+    {
+        deltas.push_back(signedValue(value - prev));
+        prev = value;
+    }
+
+    if (d_constEvalEnabled)
+        sync(index);
+    
+    int const ret = allocateTemp();
+    d_codeBuffer << d_bfGen.lookupConst(index, ret, deltas, isDeadTemp(index));
+    d_memory.setValueUnknown(ret);
+    return fits ? withRange(ret, {*lowest, *highest}) : ret;
+}
+
+std::pair<bool, int> Compiler::checkIndices(int const arr, std::vector<int> const &indices)
+{
+    // Returns whether all indices are known and, if so, the offset of the element
+    std::vector<int> const dims = d_memory.type(arr).dimensions();
+    bool known = true;
+    int offset = 0;
+    for (size_t idx = 0; idx != indices.size(); ++idx)
+    {
+        Range const range = rangeOf(indices[idx]);
+        compilerWarningIf(d_boundsCheckingEnabled && range.first >= dims[idx],
+                          "Array index (", (range.first == range.second ? "" : "at least "), range.first,
+                          ") out of bounds: dimension ", idx + 1, " of ", d_memory.identifier(arr),
+                          " has size ", dims[idx], ".");
+
+        known = known && d_memory.valueKnown(indices[idx]);
+        offset = offset * dims[idx] + d_memory.value(indices[idx]);
+    }
+
+    return {known, offset};
+}
+
+int Compiler::flatIndex(std::vector<int> const &dims, std::vector<int> const &indices)
+{
+    // Arrays without scratch-cells (struct-fields) are indexed by their flattened index,
+    // which is bounded by the maximum array size like any other field.
+    int result = indices[0];
+    for (size_t idx = 1; idx != indices.size(); ++idx)
+        result = add(multiply(result, constVal(dims[idx])), indices[idx]);
+
+    return result;
+}
+
+int Compiler::fetchMultiElement(int const arr, std::vector<int> const &indices)
+{
+    auto const [known, offset] = checkIndices(arr, indices);
+    if (d_constEvalEnabled && known)
+        return arr + offset;
+
+    std::vector<int> const dims = d_memory.type(arr).dimensions();
+    if (!d_memory.hasArrayHeader(arr))
+        return fetchFlatElement(arr, flatIndex(dims, indices));
+
+    if (d_constEvalEnabled)
+    {
+        for (int const index: indices)
+            sync(index);
+        for (int i = 0; i != d_memory.sizeOf(arr); ++i)
+            sync(arr + i);
+    }
+
+    int const ret = allocateTemp();
+    d_codeBuffer << d_bfGen.fetchElement(arr, dims, indices, ret);
+    d_memory.setValueUnknown(ret);
+    return ret;
+}
+
+int Compiler::assignMultiElement(int const arr, std::vector<int> const &indices, AddressOrInstruction const &rhs)
+{
+    auto const [known, offset] = checkIndices(arr, indices);
+    if (d_constEvalEnabled && known)
+        return assign(arr + offset, rhs);
+
+    std::vector<int> const dims = d_memory.type(arr).dimensions();
+    if (!d_memory.hasArrayHeader(arr))
+        return assignFlatElement(arr, flatIndex(dims, indices), rhs);
+
+    int const sz = d_memory.sizeOf(arr);
+    if (d_constEvalEnabled)
+    {
+        for (int const index: indices)
+            sync(index);
+        sync(rhs);
+        for (int i = 0; i != sz; ++i)
+            sync(arr + i);
+    }
+
+    d_codeBuffer << d_bfGen.assignElement(arr, dims, indices, rhs);
+    for (int i = 0; i != sz; ++i)
+        d_memory.setValueUnknown(arr + i);
+
+    return rhs;
+}
+
+int Compiler::fetchFlatElement(AddressOrInstruction const &arr, AddressOrInstruction const &index)
+{
+    compilerErrorIf(d_memory.type(arr).isStructType() && d_memory.type(arr).name().find('[') != std::string::npos,
+                    "Elements of array of structs \"", d_memory.identifier(arr),
+                    "\" can only be accessed through their fields, e.g. ",
+                    d_memory.identifier(arr), "[i].field.");
+
     int const indexValue = d_memory.value(index);
     int const sz = d_memory.sizeOf(arr);
     compilerWarningIf(d_boundsCheckingEnabled && indexValue >= sz,
               "Array index (", indexValue, ") out of bounds: sizeof(",
               d_memory.identifier(arr), ") = ", sz, ".");
 
+    // Only the elements within the range of the index are visited
+    Range const range = rangeOf(index);
+    compilerWarningIf(d_boundsCheckingEnabled && indexValue < sz && range.first >= sz,
+              "Array index (at least ", range.first, ") out of bounds: sizeof(",
+              d_memory.identifier(arr), ") = ", sz, ".");
+    int const span = std::min<long>(sz, range.second + 1);
+
     if (d_constEvalEnabled && d_memory.valueKnown(index))
     {
         return arr + d_memory.value(index);
@@ -905,19 +2390,30 @@ int Compiler::fetchElement(AddressOrInstruction const &arr, AddressOrInstruction
         }
         
         int const ret = allocateTemp();
-        d_codeBuffer << d_bfGen.fetchElement(arr, sz, index, ret);
+        d_codeBuffer << d_bfGen.fetchElement(arr, span, index, ret, d_memory.hasArrayHeader(arr));
         d_memory.setValueUnknown(ret);
         return ret;
     }
 }
 
-int Compiler::assignElement(AddressOrInstruction const &arr, AddressOrInstruction const &index, AddressOrInstruction const &rhs)
+int Compiler::assignFlatElement(AddressOrInstruction const &arr, AddressOrInstruction const &index, AddressOrInstruction const &rhs)
 {
+    compilerErrorIf(d_memory.type(arr).isStructType() && d_memory.type(arr).name().find('[') != std::string::npos,
+                    "Elements of array of structs \"", d_memory.identifier(arr),
+                    "\" can only be accessed through their fields, e.g. ",
+                    d_memory.identifier(arr), "[i].field.");
+
     int const indexValue = d_memory.value(index);
     int const sz = d_memory.sizeOf(arr);
     compilerWarningIf(d_boundsCheckingEnabled && indexValue >= sz,
               "Array index (", indexValue, ") out of bounds: sizeof(",
               d_memory.identifier(arr), ") = ", sz, ".");
+
+    Range const range = rangeOf(index);
+    compilerWarningIf(d_boundsCheckingEnabled && indexValue < sz && range.first >= sz,
+              "Array index (at least ", range.first, ") out of bounds: sizeof(",
+              d_memory.identifier(arr), ") = ", sz, ".");
+    int const span = std::min<long>(sz, range.second + 1);
     
     if (d_constEvalEnabled && d_memory.valueKnown(index) && d_memory.valueKnown(rhs))
     {
@@ -950,7 +2446,7 @@ int Compiler::assignElement(AddressOrInstruction const &arr, AddressOrInstructio
                 sync(arr + i);
         }
         
-        d_codeBuffer << d_bfGen.assignElement(arr, sz, index, rhs);
+        d_codeBuffer << d_bfGen.assignElement(arr, span, index, rhs, d_memory.hasArrayHeader(arr));
         for (int i = 0; i != sz; ++i)
             d_memory.setValueUnknown(arr + i);
 
@@ -990,20 +2486,98 @@ int Compiler::scanCell()
     return addr;
 }
 
-int Compiler::printCell(AddressOrInstruction const &target)
+int Compiler::printCell(AddressOrInstruction const &target)
+{
+    
+    if (d_constEvalEnabled)
+        sync(target);
+    
+    d_codeBuffer << d_bfGen.print(target);
+    return target;
+}
+
+int Compiler::printString(AddressOrInstruction const &str)
+{
+    int const addr = passLiteral(str);
+    compilerErrorIf(addr < 0, "Use of void expression in call to \"__prints\".");
+    compilerErrorIf(!d_memory.type(addr).isIntType(), "Cannot print a struct as a string.");
+
+    // Leading characters that are known at compile-time are printed by stepping a single
+    // cell from one character to the next; the string itself is never written to memory.
+    // Whatever remains is printed at runtime, up to the first zero.
+    int const sz = d_memory.sizeOf(addr);
+    std::vector<int> chars;
+    int idx = 0;
+    while (idx != sz && isConstant(addr + idx) && d_memory.value(addr + idx) != 0)
+        chars.push_back(d_memory.value(addr + idx++));
+
+    printConstants(chars);
+    if (idx == sz || isConstant(addr + idx))
+        return -1;
+    
+    if (d_constEvalEnabled)
+    {
+        for (int i = idx; i != sz; ++i)
+            sync(addr + i);
+    }
+    
+    d_codeBuffer << d_bfGen.printUntilZero(addr + idx, sz - idx);
+    return -1;
+}
+
+int Compiler::printDecimal(AddressOrInstruction const &value)
+{
+    compilerErrorIf(value < 0, "Use of void expression in call to \"__printd\".");
+
+    if (isWide(value))
+    {
+        int const n = d_memory.sizeOf(value);
+        if (isWideConstant(value))
+        {
+            std::string const str = std::to_string(wideValue(value));
+            printConstants(std::vector<int>(str.begin(), str.end()));
+            return -1;
+        }
+
+        for (int i = 0; d_constEvalEnabled && i != n; ++i)
+            sync(value + i);
+
+        int const bits = n * cellBits();
+        int const digits = std::to_string((1UL << bits) - 1).size();
+        d_codeBuffer << d_bfGen.widePrintDecimal(value, n, bits, digits);
+        return -1;
+    }
+
+    if (isConstant(value))
+    {
+        std::string const str = std::to_string(static_cast<unsigned long>(d_memory.value(value)));
+        printConstants(std::vector<int>(str.begin(), str.end()));
+        return -1;
+    }
+
+    if (d_constEvalEnabled)
+        sync(value);
+
+    // Enough digits to print the largest value that fits in a cell
+    int const digits = std::to_string(MAX_INT).size();
+    d_codeBuffer << d_bfGen.printDecimal(value, digits);
+    return -1;
+}
+
+int Compiler::scanDecimal()
 {
-    
-    if (d_constEvalEnabled)
-        sync(target);
-    
-    d_codeBuffer << d_bfGen.print(target);
-    return target;
+    int const result = allocateTemp();
+    d_codeBuffer << d_bfGen.scanDecimal(result);
+    d_memory.setValueUnknown(result);
+    return result;
 }
 
 int Compiler::randomCell()
 {
+    // Warnings are suppressed while probing or looking for invariants (the code is
+    // evaluated again afterwards), so the warning is only latched once it is printed.
     static bool warned = false;
-    if (!d_randomExtensionEnabled && !warned)
+    if (!d_randomExtensionEnabled && !warned && !d_probing && d_invariants == nullptr)
     {
         compilerWarning("Random number generation is implemented using the non-standard 'Random Brainf*ck' extension (https://esolangs.org/wiki/Random_Brainfuck). Your interpreter must support the '?'-symbol.\nThis warning can be supressed with the --random flag.");
         warned = true;
@@ -1018,11 +2592,14 @@ int Compiler::randomCell()
 int Compiler::preIncrement(AddressOrInstruction const &target)
 {
     compilerErrorIf(target < 0, "Cannot increment void-expression.");
+
+    if (isWide(target))
+        return assign(target, wideArithmetic(target, constVal(1), WideOp::ADD));
     
     auto bf   = [&, this](){
                     d_codeBuffer << d_bfGen.incr(target);
                 };
-    auto func = [](int x){ return ++x; };
+    auto func = [](unsigned long x){ return ++x; };
     
     return eval<0b0>(bf, func, target, target);
 }
@@ -1031,12 +2608,19 @@ int Compiler::postIncrement(AddressOrInstruction const &target)
 {
     compilerErrorIf(target < 0, "Cannot increment void-expression.");
 
+    if (isWide(target))
+    {
+        int const old = assign(allocateTemp(d_memory.type(target)), target);
+        assign(target, wideArithmetic(target, constVal(1), WideOp::ADD));
+        return old;
+    }
+
     int const tmp = allocateTemp();
     auto bf   = [&, this](){
                     d_codeBuffer << d_bfGen.assign(tmp, target)
                                  << d_bfGen.incr(target);
                 };
-    auto func = [](int &x){ return x++; };
+    auto func = [](long &x){ return x++; };
 
     return eval<0b1>(bf, func, tmp, target);
 }
@@ -1045,10 +2629,13 @@ int Compiler::preDecrement(AddressOrInstruction const &target)
 {
     compilerErrorIf(target < 0, "Cannot decrement void-expression.");
 
+    if (isWide(target))
+        return assign(target, wideArithmetic(target, constVal(1), WideOp::SUBTRACT));
+
     auto bf   = [&, this](){
                     d_codeBuffer << d_bfGen.decr(target);
                 };
-    auto func = [](int x){ return --x; };
+    auto func = [](unsigned long x){ return --x; };
     
     return eval<0b0>(bf, func, target, target);
 }
@@ -1058,12 +2645,19 @@ int Compiler::postDecrement(AddressOrInstruction const &target)
 {
     compilerErrorIf(target < 0, "Cannot decrement void-expression.");
 
+    if (isWide(target))
+    {
+        int const old = assign(allocateTemp(d_memory.type(target)), target);
+        assign(target, wideArithmetic(target, constVal(1), WideOp::SUBTRACT));
+        return old;
+    }
+
     int const tmp = allocateTemp();
     auto bf   = [&, this](){
                     d_codeBuffer << d_bfGen.assign(tmp, target)
                                  << d_bfGen.incr(target);
                 };
-    auto func = [](int &x){ return x--; };
+    auto func = [](long &x){ return x--; };
 
     return eval<0b1>(bf, func, tmp, target);
 }
@@ -1072,11 +2666,21 @@ int Compiler::addTo(AddressOrInstruction const &lhs, AddressOrInstruction const
 {
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in addition.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return assign(lhs, wideArithmetic(lhs, rhs, WideOp::ADD));
+
+    if (isConstant(rhs) && !isConstant(lhs))
+    {
+        d_codeBuffer << d_bfGen.addConst(lhs, signedValue(d_memory.value(rhs)));
+        d_memory.setValueUnknown(lhs);
+        return lhs;
+    }
+
     auto bf  = [&, this](){
-                   d_codeBuffer << d_bfGen.addTo(lhs, rhs);
+                   d_codeBuffer << d_bfGen.addTo(lhs, rhs, lhs != rhs && isDeadTemp(rhs));
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x + y;
                 };
 
@@ -1085,30 +2689,76 @@ int Compiler::addTo(AddressOrInstruction const &lhs, AddressOrInstruction const
 
 int Compiler::add(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
+    auto const [key, cached] = reuseExpression("+", lhs, rhs, true);
+    if (cached != -1)
+        return cached;
+
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in addition.");
 
-    int const ret = allocateTemp();
+    if (isWide(lhs) || isWide(rhs))
+        return wideArithmetic(lhs, rhs, WideOp::ADD);
+
+    Range const lhsRange = rangeOf(lhs);
+    Range const rhsRange = rangeOf(rhs);
+    Range const sum{lhsRange.first + rhsRange.first, lhsRange.second + rhsRange.second};
+
+    // The sum is accumulated in-place when one of the operands is a temporary that
+    // is not needed afterwards. Literals are excluded, because their value is relied
+    // upon even when constant evaluation is disabled.
+    auto const reusable = [&, this](AddressOrInstruction const &operand){
+                              return isDeadTemp(operand) && !d_memory.isLiteral(operand);
+                          };
+    
+    if (isConstant(lhs) != isConstant(rhs))
+    {
+        AddressOrInstruction const &var = isConstant(lhs) ? rhs : lhs;
+        long const value = d_memory.value(isConstant(lhs) ? lhs : rhs);
+        int const ret = reusable(var) ? static_cast<int>(var) : allocateTemp();
+        if (ret != var)
+            d_codeBuffer << d_bfGen.assign(ret, var);
+        
+        d_codeBuffer << d_bfGen.addConst(ret, signedValue(value));
+        d_memory.setValueUnknown(ret);
+        return recordExpression(key, withRange(ret, sum));
+    }
+
+    bool const swap = !reusable(lhs) && reusable(rhs);
+    AddressOrInstruction const &first = swap ? rhs : lhs;
+    AddressOrInstruction const &second = swap ? lhs : rhs;
+    int const ret = reusable(first) ? static_cast<int>(first) : allocateTemp();
+    
     auto bf  = [&, this](){
-                   d_codeBuffer << d_bfGen.assign(ret, lhs)
-                                << d_bfGen.addTo(ret, rhs);
+                   if (ret != first)
+                       d_codeBuffer << d_bfGen.assign(ret, first);
+                   d_codeBuffer << d_bfGen.addTo(ret, second, ret != second && isDeadTemp(second));
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x + y;
                 };
 
-    return eval<0b00>(bf, func, ret, lhs, rhs);
+    return recordExpression(key, withRange(eval<0b00>(bf, func, ret, lhs, rhs), sum));
 }
 
 int Compiler::subtractFrom(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in subtraction.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return assign(lhs, wideArithmetic(lhs, rhs, WideOp::SUBTRACT));
+
+    if (isConstant(rhs) && !isConstant(lhs))
+    {
+        d_codeBuffer << d_bfGen.addConst(lhs, signedValue(-d_memory.value(rhs)));
+        d_memory.setValueUnknown(lhs);
+        return lhs;
+    }
+
     auto bf  = [&, this](){
-                   d_codeBuffer << d_bfGen.subtractFrom(lhs, rhs);
+                   d_codeBuffer << d_bfGen.subtractFrom(lhs, rhs, lhs != rhs && isDeadTemp(rhs));
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x - y;
                 };
 
@@ -1118,30 +2768,64 @@ int Compiler::subtractFrom(AddressOrInstruction const &lhs, AddressOrInstruction
 
 int Compiler::subtract(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
+    auto const [key, cached] = reuseExpression("-", lhs, rhs, false);
+    if (cached != -1)
+        return cached;
+
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in subtraction.");
 
-    int const ret = allocateTemp();
+    if (isWide(lhs) || isWide(rhs))
+        return wideArithmetic(lhs, rhs, WideOp::SUBTRACT);
+
+    Range const lhsRange = rangeOf(lhs);
+    Range const rhsRange = rangeOf(rhs);
+    Range const difference{lhsRange.first - rhsRange.second, lhsRange.second - rhsRange.first};
+
+    // A temporary lhs that is not needed afterwards holds the difference in-place
+    int const ret = (isDeadTemp(lhs) && !d_memory.isLiteral(lhs)) ? static_cast<int>(lhs) : allocateTemp();
+    if (isConstant(rhs) && !isConstant(lhs))
+    {
+        if (ret != lhs)
+            d_codeBuffer << d_bfGen.assign(ret, lhs);
+        
+        d_codeBuffer << d_bfGen.addConst(ret, signedValue(-d_memory.value(rhs)));
+        d_memory.setValueUnknown(ret);
+        return recordExpression(key, withRange(ret, difference));
+    }
+    
     auto bf  = [&, this](){
-                   d_codeBuffer << d_bfGen.assign(ret, lhs)
-                                << d_bfGen.subtractFrom(ret, rhs);
+                   if (ret != lhs)
+                       d_codeBuffer << d_bfGen.assign(ret, lhs);
+                   d_codeBuffer << d_bfGen.subtractFrom(ret, rhs, ret != rhs && isDeadTemp(rhs));
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x - y;
                 };
 
-    return eval<0b00>(bf, func, ret, lhs, rhs);
+    return recordExpression(key, withRange(eval<0b00>(bf, func, ret, lhs, rhs), difference));
     
 }
 
 int Compiler::multiplyBy(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in multiplication.");
+
+    if (isWide(lhs) || isWide(rhs))
+        return assign(lhs, wideArithmetic(lhs, rhs, WideOp::MULTIPLY));
+
+    if (isConstant(rhs) && !isConstant(lhs))
+    {
+        d_codeBuffer << d_bfGen.multiplyByConst(lhs, signedValue(d_memory.value(rhs)));
+        d_memory.setValueUnknown(lhs);
+        return lhs;
+    }
+    
     auto bf  = [&, this](){
                    d_codeBuffer << d_bfGen.multiplyBy(lhs, rhs);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x * y;
                 };
 
@@ -1151,31 +2835,54 @@ int Compiler::multiplyBy(AddressOrInstruction const &lhs, AddressOrInstruction c
 
 int Compiler::multiply(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
+    auto const [key, cached] = reuseExpression("*", lhs, rhs, true);
+    if (cached != -1)
+        return cached;
+
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in multiplication.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return wideArithmetic(lhs, rhs, WideOp::MULTIPLY);
+
     int const ret = allocateTemp();
+    Range const lhsRange = rangeOf(lhs);
+    Range const rhsRange = rangeOf(rhs);
+    Range product{0, MAX_RANGE};
+    if (lhsRange.second <= MAX_RANGE / std::max(rhsRange.second, 1L))
+        product = {lhsRange.first * rhsRange.first, lhsRange.second * rhsRange.second};
+    
+    if (isConstant(lhs) != isConstant(rhs))
+    {
+        int const var = isConstant(lhs) ? rhs : lhs;
+        long const factor = d_memory.value(isConstant(lhs) ? lhs : rhs);
+        d_codeBuffer << d_bfGen.multiplyConst(var, signedValue(factor), ret);
+        d_memory.setValueUnknown(ret);
+        return recordExpression(key, withRange(ret, product));
+    }
+    
     auto bf  = [&, this](){
                    d_codeBuffer << d_bfGen.multiply(lhs, rhs, ret);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x * y;
                 };
 
-    return eval<0b00>(bf, func, ret, lhs, rhs);
+    return recordExpression(key, withRange(eval<0b00>(bf, func, ret, lhs, rhs), product));
     
 }
 
 int Compiler::power(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in division.");
+    compilerErrorIf(isWide(lhs) || isWide(rhs), "Exponentiation is not supported on wide integers.");
 
     int const ret = allocateTemp();
     auto bf = [&, this](){
                   d_codeBuffer << d_bfGen.power(lhs, rhs, ret);
               };
 
-    auto func = [](int x, int y){
+    auto func = [](long x, long y){
                     return std::pow(x, y);
                 };
 
@@ -1185,12 +2892,13 @@ int Compiler::power(AddressOrInstruction const &lhs, AddressOrInstruction const
 int Compiler::powerBy(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in division.");
+    compilerErrorIf(isWide(lhs) || isWide(rhs), "Exponentiation is not supported on wide integers.");
 
     auto bf = [&, this](){
                   d_codeBuffer << d_bfGen.powerBy(lhs, rhs);
               };
 
-    auto func = [](int x, int y){
+    auto func = [](long x, long y){
                     return std::pow(x, y);
                 };
 
@@ -1200,25 +2908,60 @@ int Compiler::powerBy(AddressOrInstruction const &lhs, AddressOrInstruction cons
 
 int Compiler::divide(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
+    auto const [key, cached] = reuseExpression("/", lhs, rhs, false);
+    if (cached != -1)
+        return cached;
+
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in division.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return wideDivision(lhs, rhs).first;
+
+    // A numerator that is always smaller than the denominator results in 0
     int const ret = allocateTemp();
+    Range const num = rangeOf(lhs);
+    Range const denom = rangeOf(rhs);
+    if (num.second < denom.first)
+        return recordExpression(key, constantResult(ret, 0));
+
+    Range const quotient = (denom.first > 0) ? Range{num.first / denom.second, num.second / denom.first}
+                                             : Range{0, MAX_RANGE};
+    if (constDenominator(lhs, rhs))
+    {
+        divModPairConst(lhs, d_memory.value(rhs), ret, allocateTemp());
+        return recordExpression(key, withRange(ret, quotient));
+    }
+    
     auto bf  = [&, this](){
                    int const dummy = allocateTemp();
                    divModPair(lhs, rhs, ret, dummy);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x / y;
                 };
 
-    return eval<0b00>(bf, func, ret, lhs, rhs);
+    return recordExpression(key, withRange(eval<0b00>(bf, func, ret, lhs, rhs), quotient));
 }
 
 int Compiler::divideBy(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in division.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return assign(lhs, wideDivision(lhs, rhs).first);
+
+    Range const num = rangeOf(lhs);
+    if (num.second < rangeOf(rhs).first)
+        return constantResult(lhs, 0);
+    
+    if (constDenominator(lhs, rhs))
+    {
+        int const div = allocateTemp();
+        divModPairConst(lhs, d_memory.value(rhs), div, allocateTemp());
+        return assign(lhs, div);
+    }
+    
     auto bf  = [&, this](){
                    int const div = allocateTemp();
                    int const dummy = allocateTemp();
@@ -1226,7 +2969,7 @@ int Compiler::divideBy(AddressOrInstruction const &lhs, AddressOrInstruction con
                    assign(lhs, div);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x / y;
                 };
 
@@ -1236,25 +2979,59 @@ int Compiler::divideBy(AddressOrInstruction const &lhs, AddressOrInstruction con
 
 int Compiler::modulo(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
+    auto const [key, cached] = reuseExpression("%", lhs, rhs, false);
+    if (cached != -1)
+        return cached;
+
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in modulo-operation.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return wideDivision(lhs, rhs).second;
+
+    // A numerator that is always smaller than the denominator is its own remainder
     int const ret = allocateTemp();
+    Range const num = rangeOf(lhs);
+    Range const denom = rangeOf(rhs);
+    if (num.second < denom.first)
+        return recordExpression(key, assign(ret, lhs));
+
+    Range const remainder{0, std::min(num.second, denom.second - 1)};
+    if (constDenominator(lhs, rhs))
+    {
+        divModPairConst(lhs, d_memory.value(rhs), allocateTemp(), ret);
+        return recordExpression(key, withRange(ret, remainder));
+    }
+    
     auto bf  = [&, this](){
                    int const dummy = allocateTemp();
                    divModPair(lhs, rhs, dummy, ret);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x % y;
                 };
 
-    return eval<0b00>(bf, func, ret, lhs, rhs);
+    return recordExpression(key, withRange(eval<0b00>(bf, func, ret, lhs, rhs), remainder));
 }
 
 int Compiler::moduloBy(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in modulo-operation.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return assign(lhs, wideDivision(lhs, rhs).second);
+
+    Range const num = rangeOf(lhs);
+    if (num.second < rangeOf(rhs).first)
+        return lhs;
+    
+    if (constDenominator(lhs, rhs))
+    {
+        int const mod = allocateTemp();
+        divModPairConst(lhs, d_memory.value(rhs), allocateTemp(), mod);
+        return assign(lhs, mod);
+    }
+    
     auto bf  = [&, this](){
                    int const mod = allocateTemp();
                    int const dummy = allocateTemp();
@@ -1262,7 +3039,7 @@ int Compiler::moduloBy(AddressOrInstruction const &lhs, AddressOrInstruction con
                    assign(lhs, mod);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x % y;
                 };
 
@@ -1275,17 +3052,32 @@ int Compiler::divMod(AddressOrInstruction const &lhs, AddressOrInstruction const
 {
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in divmod-operation.");
 
+    if (isWide(lhs) || isWide(rhs))
+    {
+        auto const [div, mod] = wideDivision(lhs, rhs);
+        assign(lhs, div);
+        return mod;
+    }
+
     int const mod = allocateTemp();
+    if (constDenominator(lhs, rhs))
+    {
+        int const div = allocateTemp();
+        divModPairConst(lhs, d_memory.value(rhs), div, mod);
+        assign(lhs, div);
+        return mod;
+    }
+    
     auto bf  = [&, this](){
                    int const div = allocateTemp();
                    divModPair(lhs, rhs, div, mod);
                    assign(lhs, div);
                };
 
-    auto func = [](int &x, int y){
-                    int ret = x % y; 
-                    x /= y;
-                    return ret;
+    auto func = [](long &x, unsigned long y){
+                    unsigned long const ux = x;
+                    x = ux / y;
+                    return ux % y;
                 };
 
     return eval<0b10>(bf, func, mod, lhs, rhs);
@@ -1296,17 +3088,32 @@ int Compiler::modDiv(AddressOrInstruction const &lhs, AddressOrInstruction const
 {
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in moddiv-operation.");
 
+    if (isWide(lhs) || isWide(rhs))
+    {
+        auto const [div, mod] = wideDivision(lhs, rhs);
+        assign(lhs, mod);
+        return div;
+    }
+
     int const div = allocateTemp();
+    if (constDenominator(lhs, rhs))
+    {
+        int const mod = allocateTemp();
+        divModPairConst(lhs, d_memory.value(rhs), div, mod);
+        assign(lhs, mod);
+        return div;
+    }
+    
     auto bf  = [&, this](){
                    int const mod = allocateTemp();
                    divModPair(lhs, rhs, div, mod);
                    assign(lhs, mod);
                };
 
-    auto func = [](int &x, int y){
-                    int ret = x / y; 
-                    x %= y;
-                    return ret;
+    auto func = [](long &x, unsigned long y){
+                    unsigned long const ux = x;
+                    x = ux % y;
+                    return ux / y;
                 };
 
     return eval<0b10>(bf, func, div, lhs, rhs);
@@ -1319,105 +3126,497 @@ void Compiler::divModPair(AddressOrInstruction const &num, AddressOrInstruction
     d_memory.setValueUnknown(modResult);
 }
 
+bool Compiler::constDenominator(int const num, int const denom) const
+{
+    // Division by zero, and by values that don't fit the constant kernel, is left
+    // to the general algorithm
+    long const value = d_memory.value(denom);
+    return isConstant(denom) && !isConstant(num) && value > 0 && value <= std::numeric_limits<int>::max();
+}
+
+void Compiler::divModPairConst(int const num, int const denom, int const divResult, int const modResult)
+{
+    d_codeBuffer << d_bfGen.divmodConst(num, denom, divResult, modResult);
+    d_memory.setValueUnknown(divResult);
+    d_memory.setValueUnknown(modResult);
+}
+
+bool Compiler::constComparand(int const lhs, int const rhs) const
+{
+    // On 64-bit cells, known values from 2^63 don't fit the (signed) bound of a
+    // constant comparison and are left to the general algorithm.
+    if (isConstant(lhs) == isConstant(rhs))
+        return false;
+
+    long const value = d_memory.value(isConstant(lhs) ? lhs : rhs);
+    return value >= 0 && value < std::numeric_limits<long>::max();
+}
+
+int Compiler::compareToConst(int const lhs, long const bound, bool const less, int const result)
+{
+    // result = (lhs < bound) if less is true, (lhs >= bound) otherwise. Bounds outside the
+    // range of the cell make the result known at compile-time.
+    if (bound <= 0 || bound > MAX_RANGE)
+        return constantResult(result, (bound > 0) == less);
+
+    d_codeBuffer << (less ? d_bfGen.lessConst(lhs, bound, result)
+                          : d_bfGen.greaterOrEqualConst(lhs, bound, result));
+    d_memory.setValueUnknown(result);
+    return withRange(result, {0, 1});
+}
+
+int Compiler::constantResult(int const result, long const value)
+{
+    if (d_constEvalEnabled)
+        constEvalSetToValue(result, value);
+    else
+        runtimeSetToValue(result, value);
+
+    return result;
+}
+
+int Compiler::booleanEqual(AddressOrInstruction const &var, bool const value, int const result)
+{
+    // Comparing a value that is known to be either 0 or 1 to one of these reduces to
+    // a copy or a negation. A temporary that is not needed afterwards is used as is.
+    if (value)
+        return withRange(isDeadTemp(var) ? static_cast<int>(var) : assign(result, var), {0, 1});
+
+    bool const consume = isDeadTemp(var);
+    d_codeBuffer << d_bfGen.booleanNot(var, result, consume);
+    d_memory.setValueUnknown(result);
+    if (consume)
+        d_memory.setValueUnknown(var);
+
+    return withRange(result, {0, 1});
+}
+
+int Compiler::cellBits() const
+{
+    int bits = 0;
+    for (unsigned long mask = MAX_INT; mask != 0; mask >>= 1)
+        ++bits;
+
+    return bits;
+}
+
+TypeSystem::Type Compiler::wideType(int const bits) const
+{
+    // An integer that does not fit in a single cell spans multiple cells, the least
+    // significant one first.
+    int const cells = (bits + cellBits() - 1) / cellBits();
+    if (cells == 1)
+        return TypeSystem::Type(1);
+
+    return TypeSystem::Type(std::string("u").append(std::to_string(bits)), cells);
+}
+
+bool Compiler::isWide(int const addr) const
+{
+    return addr >= 0 && d_memory.type(addr).isWideType();
+}
+
+bool Compiler::isWideConstant(int const addr) const
+{
+    for (int i = 0; i != d_memory.sizeOf(addr); ++i)
+        if (!isConstant(addr + i))
+            return false;
+
+    return true;
+}
+
+unsigned long Compiler::wideValue(int const addr) const
+{
+    unsigned long value = 0;
+    for (int i = d_memory.sizeOf(addr) - 1; i >= 0; --i)
+        value = (value << cellBits()) | d_memory.value(addr + i);
+
+    return value;
+}
+
+void Compiler::setWideValue(int const addr, unsigned long const value)
+{
+    for (int i = 0; i != d_memory.sizeOf(addr); ++i)
+        constEvalSetToValue(addr + i, (value >> (i * cellBits())) & MAX_INT);
+}
+
+int Compiler::wideLiteral(long const value)
+{
+    TypeSystem::Type const type = wideType((value > 0xffff) ? 32 : 16);
+    int const tmp = allocateTemp(type);
+    for (int i = 0; i != type.size(); ++i)
+    {
+        int const cell = (value >> (i * cellBits())) & MAX_INT;
+        constEvalSetToValue(tmp + i, cell);
+        if (!d_constEvalEnabled && !d_probing)
+            runtimeSetToValue(tmp + i, cell);
+
+        d_memory.markLiteral(tmp + i);
+    }
+
+    return tmp;
+}
+
+int Compiler::convert(int const addr, TypeSystem::Type const &type)
+{
+    // Zero-extends or truncates an integer to the given (wide) type
+    TypeSystem::Type const current = d_memory.type(addr);
+    if (current == type)
+        return addr;
+
+    compilerErrorIf(!current.isWideType() && !(current.isIntType() && current.size() == 1),
+                    "Cannot convert object of type \"", current.name(), "\" to ", type.name(), ".");
+
+    int const ret = allocateTemp(type);
+    int const n = std::min(current.size(), type.size());
+    assignBlock(ret, addr, n);
+    for (int i = n; i != type.size(); ++i)
+    {
+        if (d_constEvalEnabled)
+            constEvalSetToValue(ret + i, 0);
+        else
+            runtimeSetToValue(ret + i, 0);
+    }
+
+    return ret;
+}
+
+std::pair<int, int> Compiler::promote(int const lhs, int const rhs)
+{
+    // Both operands are converted to the widest of their types
+    bool const lhsWider = !isWide(rhs) || (isWide(lhs) && d_memory.sizeOf(lhs) >= d_memory.sizeOf(rhs));
+    TypeSystem::Type const type = d_memory.type(lhsWider ? lhs : rhs);
+    return {convert(lhs, type), convert(rhs, type)};
+}
+
+int Compiler::wideArithmetic(int const lhs, int const rhs, WideOp const op)
+{
+    // Like eval, the result is computed at compile-time when all cells of both operands
+    // are known. Comparisons result in a single cell.
+    auto const [x, y] = promote(lhs, rhs);
+    int const n = d_memory.sizeOf(x);
+    bool const comparison = (op == WideOp::EQUAL || op == WideOp::LESS);
+    int const ret = comparison ? allocateTemp() : allocateTemp(d_memory.type(x));
+
+    if (d_constEvalEnabled && isWideConstant(x) && isWideConstant(y))
+    {
+        unsigned long const a = wideValue(x);
+        unsigned long const b = wideValue(y);
+        unsigned long const modulus = 1UL << (n * cellBits());
+        switch (op)
+        {
+        case WideOp::ADD:      setWideValue(ret, (a + b) % modulus); break;
+        case WideOp::SUBTRACT: setWideValue(ret, (a + modulus - b) % modulus); break;
+        case WideOp::MULTIPLY: setWideValue(ret, (a * b) % modulus); break;
+        case WideOp::EQUAL:    return constantResult(ret, a == b);
+        case WideOp::LESS:     return constantResult(ret, a < b);
+        }
+        return ret;
+    }
+
+    for (int i = 0; d_constEvalEnabled && i != n; ++i)
+    {
+        sync(x + i);
+        sync(y + i);
+    }
+
+    switch (op)
+    {
+    case WideOp::ADD:      d_codeBuffer << d_bfGen.wideAdd(x, y, ret, n); break;
+    case WideOp::SUBTRACT: d_codeBuffer << d_bfGen.wideSubtract(x, y, ret, n); break;
+    case WideOp::MULTIPLY: d_codeBuffer << d_bfGen.wideMultiply(x, y, ret, n, n * cellBits()); break;
+    case WideOp::EQUAL:    d_codeBuffer << d_bfGen.wideEqual(x, y, ret, n); break;
+    case WideOp::LESS:     d_codeBuffer << d_bfGen.wideLess(x, y, ret, n); break;
+    }
+
+    if (comparison)
+    {
+        d_memory.setValueUnknown(ret);
+        return withRange(ret, {0, 1});
+    }
+    
+    for (int i = 0; i != n; ++i)
+        d_memory.setValueUnknown(ret + i);
+
+    return ret;
+}
+
+std::pair<int, int> Compiler::wideDivision(int const lhs, int const rhs)
+{
+    // Returns {quotient, remainder}. Division by zero results in a quotient with all
+    // bits set, and leaves the numerator as the remainder.
+    auto const [x, y] = promote(lhs, rhs);
+    int const n = d_memory.sizeOf(x);
+    int const div = allocateTemp(d_memory.type(x));
+    int const mod = allocateTemp(d_memory.type(x));
+
+    if (d_constEvalEnabled && isWideConstant(x) && isWideConstant(y))
+    {
+        unsigned long const a = wideValue(x);
+        unsigned long const b = wideValue(y);
+        setWideValue(div, (b == 0) ? (1UL << (n * cellBits())) - 1 : a / b);
+        setWideValue(mod, (b == 0) ? a : a % b);
+        return {div, mod};
+    }
+
+    for (int i = 0; d_constEvalEnabled && i != n; ++i)
+    {
+        sync(x + i);
+        sync(y + i);
+    }
+
+    d_codeBuffer << d_bfGen.wideDivmod(x, y, div, mod, n, n * cellBits());
+    for (int i = 0; i != n; ++i)
+    {
+        d_memory.setValueUnknown(div + i);
+        d_memory.setValueUnknown(mod + i);
+    }
+
+    return {div, mod};
+}
+
+int Compiler::truthValue(int const addr)
+{
+    // A wide integer is true when any of its cells is nonzero
+    return isWide(addr) ? notEqual(addr, constVal(0)) : addr;
+}
+
+Instruction Compiler::truthValue(Instruction const &condition)
+{
+    return [=, this](){
+               return truthValue(condition());
+           };
+}
+
 
 int Compiler::equal(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
+    auto const [key, cached] = reuseExpression("==", lhs, rhs, true);
+    if (cached != -1)
+        return cached;
+
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in comparison.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return wideArithmetic(lhs, rhs, WideOp::EQUAL);
+
     int const ret = allocateTemp();
+    Range const lhsRange = rangeOf(lhs);
+    Range const rhsRange = rangeOf(rhs);
+    int const known = equalByRange(lhsRange, rhsRange);
+    if (known != -1)
+        return recordExpression(key, constantResult(ret, known));
+    
+    if (isConstant(lhs) != isConstant(rhs))
+    {
+        AddressOrInstruction const &var = isConstant(lhs) ? rhs : lhs;
+        long const value = d_memory.value(isConstant(lhs) ? lhs : rhs);
+        if (rangeOf(var).second <= 1)
+            return recordExpression(key, booleanEqual(var, value == 1, ret));
+        
+        d_codeBuffer << d_bfGen.equalConst(var, signedValue(value), ret);
+        d_memory.setValueUnknown(ret);
+        return recordExpression(key, withRange(ret, {0, 1}));
+    }
+    
     auto bf  = [&, this](){
                    d_codeBuffer << d_bfGen.equal(lhs, rhs, ret);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x == y;
                 };
 
-    return eval<0b00>(bf, func, ret, lhs, rhs);
+    return recordExpression(key, withRange(eval<0b00>(bf, func, ret, lhs, rhs), {0, 1}));
     
 }
 
 int Compiler::notEqual(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
+    auto const [key, cached] = reuseExpression("!=", lhs, rhs, true);
+    if (cached != -1)
+        return cached;
+
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in comparison.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return logicalNot(wideArithmetic(lhs, rhs, WideOp::EQUAL));
+
     int const ret = allocateTemp();
+    Range const lhsRange = rangeOf(lhs);
+    Range const rhsRange = rangeOf(rhs);
+    int const known = equalByRange(lhsRange, rhsRange);
+    if (known != -1)
+        return recordExpression(key, constantResult(ret, 1 - known));
+    
+    if (isConstant(lhs) != isConstant(rhs))
+    {
+        AddressOrInstruction const &var = isConstant(lhs) ? rhs : lhs;
+        long const value = d_memory.value(isConstant(lhs) ? lhs : rhs);
+        if (rangeOf(var).second <= 1)
+            return recordExpression(key, booleanEqual(var, value == 0, ret));
+        
+        d_codeBuffer << d_bfGen.notEqualConst(var, signedValue(value), ret);
+        d_memory.setValueUnknown(ret);
+        return recordExpression(key, withRange(ret, {0, 1}));
+    }
+    
     auto bf  = [&, this](){
                    d_codeBuffer << d_bfGen.notEqual(lhs, rhs, ret);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x != y;
                 };
 
-    return eval<0b00>(bf, func, ret, lhs, rhs);
+    return recordExpression(key, withRange(eval<0b00>(bf, func, ret, lhs, rhs), {0, 1}));
     
 }
 
 int Compiler::less(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
+    auto const [key, cached] = reuseExpression("<", lhs, rhs, false);
+    if (cached != -1)
+        return cached;
+
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in comparison.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return wideArithmetic(lhs, rhs, WideOp::LESS);
+
     int const ret = allocateTemp();
+    Range const lhsRange = rangeOf(lhs);
+    Range const rhsRange = rangeOf(rhs);
+    int const known = lessByRange(lhsRange, rhsRange);
+    if (known != -1)
+        return recordExpression(key, constantResult(ret, known));
+    
+    if (constComparand(lhs, rhs))
+    {
+        int const result = isConstant(rhs) ? compareToConst(lhs, d_memory.value(rhs), true, ret)       // x < k
+                                           : compareToConst(rhs, d_memory.value(lhs) + 1L, false, ret); // k < x
+        return recordExpression(key, result);
+    }
+    
     auto bf  = [&, this](){
                    d_codeBuffer << d_bfGen.less(lhs, rhs, ret);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x < y;
                 };
 
-    return eval<0b00>(bf, func, ret, lhs, rhs);
+    return recordExpression(key, withRange(eval<0b00>(bf, func, ret, lhs, rhs), {0, 1}));
     
 }
 
 int Compiler::greater(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
+    auto const [key, cached] = reuseExpression("<", rhs, lhs, false);
+    if (cached != -1)
+        return cached;
+
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in comparison.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return wideArithmetic(rhs, lhs, WideOp::LESS);
+
     int const ret = allocateTemp();
+    Range const lhsRange = rangeOf(lhs);
+    Range const rhsRange = rangeOf(rhs);
+    int const known = lessByRange(rhsRange, lhsRange);
+    if (known != -1)
+        return recordExpression(key, constantResult(ret, known));
+    
+    if (constComparand(lhs, rhs))
+    {
+        int const result = isConstant(rhs) ? compareToConst(lhs, d_memory.value(rhs) + 1L, false, ret) // x > k
+                                           : compareToConst(rhs, d_memory.value(lhs), true, ret);       // k > x
+        return recordExpression(key, result);
+    }
+    
     auto bf  = [&, this](){
                    d_codeBuffer << d_bfGen.greater(lhs, rhs, ret);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x > y;
                 };
 
-    return eval<0b00>(bf, func, ret, lhs, rhs);
+    return recordExpression(key, withRange(eval<0b00>(bf, func, ret, lhs, rhs), {0, 1}));
     
 }
 
 int Compiler::lessOrEqual(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
+    auto const [key, cached] = reuseExpression("<=", lhs, rhs, false);
+    if (cached != -1)
+        return cached;
+
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in comparison.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return logicalNot(wideArithmetic(rhs, lhs, WideOp::LESS));
+
     int const ret = allocateTemp();
+    Range const lhsRange = rangeOf(lhs);
+    Range const rhsRange = rangeOf(rhs);
+    int const known = lessByRange(rhsRange, lhsRange);
+    if (known != -1)
+        return recordExpression(key, constantResult(ret, 1 - known));
+    
+    if (constComparand(lhs, rhs))
+    {
+        int const result = isConstant(rhs) ? compareToConst(lhs, d_memory.value(rhs) + 1L, true, ret)  // x <= k
+                                           : compareToConst(rhs, d_memory.value(lhs), false, ret);      // k <= x
+        return recordExpression(key, result);
+    }
+    
     auto bf  = [&, this](){
                    d_codeBuffer << d_bfGen.lessOrEqual(lhs, rhs, ret);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x <= y;
                 };
 
-    return eval<0b00>(bf, func, ret, lhs, rhs);
+    return recordExpression(key, withRange(eval<0b00>(bf, func, ret, lhs, rhs), {0, 1}));
 }
 
 int Compiler::greaterOrEqual(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
+    auto const [key, cached] = reuseExpression("<=", rhs, lhs, false);
+    if (cached != -1)
+        return cached;
+
     compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in comparison.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return logicalNot(wideArithmetic(lhs, rhs, WideOp::LESS));
+
     int const ret = allocateTemp();
+    Range const lhsRange = rangeOf(lhs);
+    Range const rhsRange = rangeOf(rhs);
+    int const known = lessByRange(lhsRange, rhsRange);
+    if (known != -1)
+        return recordExpression(key, constantResult(ret, 1 - known));
+    
+    if (constComparand(lhs, rhs))
+    {
+        int const result = isConstant(rhs) ? compareToConst(lhs, d_memory.value(rhs), false, ret)      // x >= k
+                                           : compareToConst(rhs, d_memory.value(lhs) + 1L, true, ret);  // k >= x
+        return recordExpression(key, result);
+    }
+    
     auto bf  = [&, this](){
                    d_codeBuffer << d_bfGen.greaterOrEqual(lhs, rhs, ret);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](unsigned long x, unsigned long y){
                     return x >= y;
                 };
 
-    return eval<0b00>(bf, func, ret, lhs, rhs);
+    return recordExpression(key, withRange(eval<0b00>(bf, func, ret, lhs, rhs), {0, 1}));
     
 }
 
@@ -1425,29 +3624,39 @@ int Compiler::logicalNot(AddressOrInstruction const &arg)
 {
     compilerErrorIf(arg < 0, "Use of void-expression in not-operation.");
 
+    if (isWide(arg))
+        return wideArithmetic(arg, constVal(0), WideOp::EQUAL);
+
     int const ret = allocateTemp();
+    if (!isConstant(arg) && rangeOf(arg).second <= 1)
+        return booleanEqual(arg, false, ret);
+    
     auto bf  = [&, this](){
                    d_codeBuffer << d_bfGen.logicalNot(arg, ret);
                };
 
-    auto func = [](int x){
+    auto func = [](long x){
                     return !x;
                 };
 
-    return eval<0b0>(bf, func, ret, arg);
+    return withRange(eval<0b0>(bf, func, ret, arg), {0, 1});
 }
 
 int Compiler::logicalAnd(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
 {
     compilerErrorIf(lhs < 0,  "Use of void-expression in and-operation.");
     compilerErrorIf(d_memory.value(lhs) && rhs < 0, "Use of void-expression in and-operation.");
+
+    if (isWide(lhs) || isWide(rhs))
+        return logicalAnd(truthValue(lhs), truthValue(rhs));
+
     
     int const ret = allocateTemp();
     auto bf  = [&, this](){
                    d_codeBuffer << d_bfGen.logicalAnd(lhs, rhs, ret);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](long x, long y){
                     return x && y;
                 };
 
@@ -1456,7 +3665,7 @@ int Compiler::logicalAnd(AddressOrInstruction const &lhs, AddressOrInstruction c
     // warning by disabling this check.
 
     disableBoundChecking();
-    int const result = eval<0b00>(bf, func, ret, lhs, rhs);
+    int const result = withRange(eval<0b00>(bf, func, ret, lhs, rhs), {0, 1});
     enableBoundChecking();
     return result;
 }
@@ -1466,12 +3675,15 @@ int Compiler::logicalOr(AddressOrInstruction const &lhs, AddressOrInstruction co
     compilerErrorIf(lhs < 0,  "Use of void-expression in or-operation.");
     compilerErrorIf(d_memory.value(lhs) && rhs < 0, "Use of void-expression in or-operation.");
 
+    if (isWide(lhs) || isWide(rhs))
+        return logicalOr(truthValue(lhs), truthValue(rhs));
+
     int const ret = allocateTemp();
     auto bf  = [&, this](){
                    d_codeBuffer << d_bfGen.logicalOr(lhs, rhs, ret);
                };
 
-    auto func = [](int x, int y){
+    auto func = [](long x, long y){
                     return x || y;
                 };
 
@@ -1480,11 +3692,219 @@ int Compiler::logicalOr(AddressOrInstruction const &lhs, AddressOrInstruction co
     // warning by disabling this check.
     
     disableBoundChecking(); 
-    int const result = eval<0b00>(bf, func, ret, lhs, rhs);
+    int const result = withRange(eval<0b00>(bf, func, ret, lhs, rhs), {0, 1});
     enableBoundChecking();
     return result;
 }
 
+int Compiler::shortCircuitAnd(Instruction const &lhs, Instruction const &rhs)
+{
+    int const lhsAddr = truthValue(lhs());
+    compilerErrorIf(lhsAddr < 0,  "Use of void-expression in and-operation.");
+
+    if (isConstant(lhsAddr))
+        return d_memory.value(lhsAddr) ? logicalAnd(lhsAddr, rhs) : constVal(0);
+
+    return shortCircuit(lhsAddr, rhs, true);
+}
+
+int Compiler::shortCircuitOr(Instruction const &lhs, Instruction const &rhs)
+{
+    int const lhsAddr = truthValue(lhs());
+    compilerErrorIf(lhsAddr < 0,  "Use of void-expression in or-operation.");
+
+    if (isConstant(lhsAddr))
+        return d_memory.value(lhsAddr) ? constVal(1) : logicalOr(lhsAddr, rhs);
+
+    return shortCircuit(lhsAddr, rhs, false);
+}
+
+int Compiler::shortCircuit(int const lhs, Instruction const &rhs, bool const isAnd)
+{
+    // The result is initialized to the value it has when the lhs determines the outcome.
+    // Only when it doesn't, the rhs is evaluated inside a conditional block (like the
+    // body of an if-statement) and determines the result.
+    
+    disableConstEval();
+
+    int const ret  = allocateTemp();
+    runtimeSetToValue(ret, isAnd ? 0 : 1);
+
+    int flag = allocateTemp();
+    if (isAnd)
+        assign(flag, lhs);
+    else
+        flag = logicalNot(lhs);
+
+    d_codeBuffer << d_bfGen.movePtr(flag)
+                 << "[";
+
+    int const rhsAddr = truthValue(rhs());
+    compilerErrorIf(rhsAddr < 0, "Use of void-expression in ", (isAnd ? "and" : "or"), "-operation.");
+
+    int const tmp = allocateTemp();
+    d_codeBuffer << d_bfGen.setToValue(ret, 0)
+                 << d_bfGen.assign(tmp, rhsAddr)
+                 << "["
+                 <<     d_bfGen.setToValue(ret, 1)
+                 <<     d_bfGen.setToValue(tmp, 0)
+                 << "]"
+                 << d_bfGen.setToValue(flag, 0)
+                 << "]";
+
+    d_memory.setValueUnknown(ret);
+    enableConstEval();
+    return withRange(ret, {0, 1});
+}
+
+int Compiler::bitwiseAnd(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
+{
+    compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in bitwise and-operation.");
+    return bitwise(lhs, rhs, BFGenerator::BitOp::AND);
+}
+
+int Compiler::bitwiseOr(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
+{
+    compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in bitwise or-operation.");
+    return bitwise(lhs, rhs, BFGenerator::BitOp::OR);
+}
+
+int Compiler::bitwiseXor(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
+{
+    compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in bitwise xor-operation.");
+    return bitwise(lhs, rhs, BFGenerator::BitOp::XOR);
+}
+
+int Compiler::bitwise(int const lhs, int const rhs, BFGenerator::BitOp const op)
+{
+    compilerErrorIf(isWide(lhs) || isWide(rhs), "Bitwise operations are not supported on wide integers.");
+
+    int const ret = allocateTemp();
+    if (isConstant(lhs) != isConstant(rhs))
+    {
+        int const var = isConstant(lhs) ? rhs : lhs;
+        long const value = wrapValue(d_memory.value(isConstant(lhs) ? lhs : rhs));
+        if (bitwiseConst(var, value, op, ret))
+            return ret;
+    }
+
+    auto bf  = [&, this](){
+                   d_codeBuffer << d_bfGen.bitwise(lhs, rhs, ret, op);
+               };
+
+    auto func = [op](unsigned long x, unsigned long y) -> unsigned long {
+                    switch (op)
+                    {
+                    case BFGenerator::BitOp::AND: return x & y;
+                    case BFGenerator::BitOp::OR:  return x | y;
+                    case BFGenerator::BitOp::XOR: return x ^ y;
+                    }
+                    return 0;
+                };
+
+    return eval<0b00>(bf, func, ret, lhs, rhs);
+}
+
+bool Compiler::bitwiseConst(int const var, long const value, BFGenerator::BitOp const op, int const result)
+{
+    // Operations with a constant that has all or none of its bits set reduce to
+    // a copy, a constant or a complement. Masking the lower bits is a modulo-operation.
+    using BitOp = BFGenerator::BitOp;
+    
+    if (value == 0)
+    {
+        if (op == BitOp::AND)
+            constantResult(result, 0);
+        else
+            assign(result, var);
+        return true;
+    }
+
+    if (value == wrapValue(-1))
+    {
+        if (op == BitOp::AND)
+            assign(result, var);
+        else if (op == BitOp::OR)
+            constantResult(result, -1);
+        else
+        {
+            // ~x == -x - 1
+            d_codeBuffer << d_bfGen.setToValue(result, 0)
+                         << d_bfGen.subtractFrom(result, var)
+                         << d_bfGen.decr(result);
+            d_memory.setValueUnknown(result);
+        }
+        return true;
+    }
+
+    bool const lowMask = ((value + 1) & value) == 0;
+    if (op == BitOp::AND && lowMask && value < MAX_CONST_KERNEL_POW2)
+    {
+        divModPairConst(var, value + 1, allocateTemp(), result);
+        return true;
+    }
+
+    return false;
+}
+
+int Compiler::shiftLeft(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
+{
+    compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in shift-operation.");
+    return shift(lhs, rhs, true);
+}
+
+int Compiler::shiftRight(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs)
+{
+    compilerErrorIf(lhs < 0 || rhs < 0, "Use of void-expression in shift-operation.");
+    return shift(lhs, rhs, false);
+}
+
+int Compiler::shift(int const lhs, int const rhs, bool const left)
+{
+    // Shifting by a known amount is a multiplication or division by a power of 2.
+    // Shifting by the cell-width or more always results in 0.
+    compilerErrorIf(isWide(lhs) || isWide(rhs), "Shift operations are not supported on wide integers.");
+
+    int const bits = cellBits();
+    int const ret = allocateTemp();
+    if (isConstant(rhs) && !isConstant(lhs))
+    {
+        int const amount = d_memory.value(rhs);
+        if (amount < 0 || amount >= bits)
+            return constantResult(ret, 0);
+        if (amount == 0)
+            return assign(ret, lhs);
+
+        long const factor = 1L << amount;
+        if (factor <= MAX_CONST_KERNEL_POW2)
+        {
+            if (left)
+            {
+                d_codeBuffer << d_bfGen.multiplyConst(lhs, signedValue(factor), ret);
+                d_memory.setValueUnknown(ret);
+            }
+            else
+                divModPairConst(lhs, factor, ret, allocateTemp());
+
+            return ret;
+        }
+    }
+
+    auto bf  = [&, this](){
+                   d_codeBuffer << (left ? d_bfGen.shiftLeft(lhs, rhs, ret)
+                                         : d_bfGen.shiftRight(lhs, rhs, ret));
+               };
+
+    auto func = [bits, left](unsigned long x, long y) -> unsigned long {
+                    if (y < 0 || y >= bits)
+                        return 0;
+
+                    return left ? (x << y) : (x >> y);
+                };
+
+    return eval<0b00>(bf, func, ret, lhs, rhs);
+}
+
 
 int Compiler::mergeInstructions(Instruction const &instr1, Instruction const &instr2)
 {
@@ -1497,13 +3917,16 @@ int Compiler::mergeInstructions(Instruction const &instr1, Instruction const &in
 void Compiler::enterScope(Scope::Type const type)
 {
     d_scope.push(type);
-    allocateBCRFlags(type != Scope::Type::If);
+    if (type == Scope::Type::If)
+        allocateBCRFlags(BcrFlags::INHERIT);
+    else
+        allocateBCRFlags(d_loopUsesBcr ? BcrFlags::ALLOCATE : BcrFlags::NONE);
 }
 
 void Compiler::enterScope(std::string const &name)
 {
     d_scope.push(name);
-    allocateBCRFlags(true);
+    allocateBCRFlags(d_bcrFunctions.contains(name) ? BcrFlags::ALLOCATE : BcrFlags::NONE);
 }
 
 void Compiler::exitScope(std::string const &name)
@@ -1534,15 +3957,17 @@ void Compiler::exitScope(std::string const &name)
     }
 }
 
-void Compiler::allocateBCRFlags(bool const alloc)
+void Compiler::allocateBCRFlags(BcrFlags const flags)
 {
     if (!d_bcrEnabled)
         return;
     
+    // Scopes without flags (functions and loops without break, continue or return) are
+    // registered with flag-addresses -1, which are inherited by their if-scopes.
     int breakFlag = -1;
     int continueFlag = -1;
 
-    if (alloc)
+    if (flags == BcrFlags::ALLOCATE)
     {
         breakFlag = allocate("__break_flag", TypeSystem::Type(1));
         continueFlag = allocate("__continue_flag", TypeSystem::Type(1));
@@ -1558,10 +3983,10 @@ void Compiler::allocateBCRFlags(bool const alloc)
             runtimeSetToValue(continueFlag, 1);
         }
     }
-    else
+    else if (flags == BcrFlags::INHERIT)
     {
         std::string const &enclosingScope = d_scope.enclosing();
-        assert(!enclosingScope.empty() && "calling allocateBCRFlags(false) without being in a subscope");
+        assert(!enclosingScope.empty() && "inheriting bcr-flags without being in a subscope");
 
         
         auto const it = d_bcrMap.find(enclosingScope);
@@ -1571,13 +3996,18 @@ void Compiler::allocateBCRFlags(bool const alloc)
         continueFlag = it->second.second;
     }
 
-    assert(breakFlag != -1 && "break-flag-address not assigned");
-    assert(continueFlag != -1 && "continue-flag-address not assigned");
+    assert((breakFlag != -1 || flags != BcrFlags::ALLOCATE) && "break-flag-address not assigned");
+    assert((continueFlag != -1 || flags != BcrFlags::ALLOCATE) && "continue-flag-address not assigned");
     
     auto const result = d_bcrMap.insert({d_scope.current(), {breakFlag, continueFlag}});
     assert(result.second && "flags already present for this scope");
 }
 
+bool Compiler::bcrActive() const
+{
+    return d_bcrEnabled && getCurrentBreakFlag() != -1;
+}
+
 int Compiler::getCurrentBreakFlag() const
 {
     assert(d_bcrEnabled && "calling getCurrentBreakFlag() with --no-bcr");
@@ -1603,12 +4033,14 @@ int Compiler::ifStatement(Instruction const &condition, Instruction const &ifBod
     int const conditionAddr = condition();
     compilerErrorIf(conditionAddr < 0, "Use of void-expression in if-condition.");
 
-    if (d_constEvalEnabled && d_memory.valueKnown(conditionAddr))
+    if (isConstant(conditionAddr))
     {
         if (scoped)
             enterScope(Scope::Type::If);
-        
-        (d_memory.value(conditionAddr) > 0 ? ifBody : elseBody)();
+
+        Instruction const &body = (d_memory.value(conditionAddr) > 0) ? ifBody : elseBody;
+        if (body)
+            body();
         
         if (scoped)
             exitScope();
@@ -1616,60 +4048,56 @@ int Compiler::ifStatement(Instruction const &condition, Instruction const &ifBod
         return -1;
     }
 
-    // Runtime evaluation
+    // Runtime evaluation: a temporary condition is consumed as the flag of the if-body,
+    // other conditions are copied first. The flag of the else-body starts at 1 and
+    // is cleared by the if-body, so the condition doesn't need to be negated. An
+    // empty elseBody means there is no else-branch at all.
     disableConstEval();
-    
-    int const ifFlag = allocateTemp();
-    assign(ifFlag, conditionAddr);
-    int const elseFlag = logicalNot(ifFlag);
 
+    int ifFlag = conditionAddr;
+    if (!d_memory.isTemp(conditionAddr) || d_memory.isLiteral(conditionAddr) || isShared(conditionAddr))
+    {
+        ifFlag = allocateTemp();
+        assign(ifFlag, conditionAddr);
+    }
 
-    d_codeBuffer << d_bfGen.movePtr(ifFlag)
-                 << "[";
+    int const elseFlag = elseBody ? allocateTemp() : -1;
+    if (elseBody)
+        d_codeBuffer << d_bfGen.setToValue(elseFlag, 1);
 
-    {
-        if (scoped)
-            enterScope(Scope::Type::If);
+    auto runBody = [&, this](Instruction const &body)
+                   {
+                       forgetExpressions();
+                       if (scoped)
+                           enterScope(Scope::Type::If);
 
-        ifBody();
+                       body();
 
-        if (scoped)
-            exitScope();
-    }
-    
-    d_codeBuffer << d_bfGen.setToValue(ifFlag, 0)
-                 << "]"
-                 << d_bfGen.movePtr(elseFlag)
-                 << "[";
+                       if (scoped)
+                           exitScope();
+                   };
 
-    {
-        if (scoped)
-            enterScope(Scope::Type::If);
-        
-        elseBody();
-        
-        if (scoped)
-            exitScope();
-    }
+    d_codeBuffer << d_bfGen.movePtr(ifFlag)
+                 << "[";
     
-    d_codeBuffer << d_bfGen.setToValue(elseFlag, 0)
-                 << "]";
+    runBody(ifBody);
+    if (elseBody)
+        d_codeBuffer << d_bfGen.setToValue(elseFlag, 0);
 
+    d_codeBuffer << d_bfGen.setToValue(ifFlag, 0)
+                 << "]";
 
-    if (d_bcrEnabled)
+    if (elseBody)
     {
-        // If/else might have changed bcr-flags --> mark values unknown
-        d_memory.setValueUnknown(getCurrentContinueFlag());
-        for (auto const &pr: d_bcrMap)
-        {
-            if (pr.first.find(d_scope.function()) == 0)
-            {
-                int const breakFlag = pr.second.first;
-                d_memory.setValueUnknown(breakFlag);
-            }
-        }
+        d_codeBuffer << d_bfGen.movePtr(elseFlag)
+                     << "[";
+        runBody(elseBody);
+        d_codeBuffer << d_bfGen.setToValue(elseFlag, 0)
+                     << "]";
     }
 
+    d_memory.setValueUnknown(ifFlag);
+    markBcrFlagsUnknown();
     enableConstEval();
     
     return -1;
@@ -1692,16 +4120,20 @@ int Compiler::forStatement(Instruction const &init, Instruction const &condition
         return forStatementRuntime(init, condition, increment, body);
     }
 
+    // A runtime branch in the body makes the break-flag, and thereby the condition,
+    // unknown. Loops without flags are not unrolled in that case either.
+    int const branches = d_runtimeBranches;
     int count = 0;
     while (d_memory.value(conditionAddr))
     {
         body();
         resetContinueFlag();
         increment();
-        conditionAddr = d_bcrEnabled ? logicalAnd(condition, getCurrentBreakFlag()) : condition();
+        conditionAddr = bcrActive() ? logicalAnd(condition, getCurrentBreakFlag()) : condition();
         ++d_loopUnrolling;
 
-        if (!d_memory.valueKnown(conditionAddr) || ++count > MAX_LOOP_UNROLL_ITERATIONS)
+        if (!d_memory.valueKnown(conditionAddr) || ++count > MAX_LOOP_UNROLL_ITERATIONS ||
+            (d_bcrEnabled && d_runtimeBranches != branches))
         {
             restore(std::move(state));
             return forStatementRuntime(init, condition, increment, body);
@@ -1709,15 +4141,20 @@ int Compiler::forStatement(Instruction const &init, Instruction const &condition
 
     }    
 
-    --d_loopUnrolling;
+    d_loopUnrolling = state.loopUnrolling;
     exitScope();
+    commit(state);
     
     return -1;
 }
 
 int Compiler::forStatementRuntime(Instruction const &init, Instruction const &condition,
-                                  Instruction const &increment, Instruction const &body)
+                                  Instruction const &increment, Instruction const &body,
+                                  bool const pinCounter)
 {
+    // The range of the loop-counter is pinned while compiling the body. If the body
+    // turns out to write to the counter, the loop is compiled again without it.
+    State state = save();
     int const flag = allocateTemp();
     enterScope(Scope::Type::For);
     disableConstEval();
@@ -1727,21 +4164,109 @@ int Compiler::forStatementRuntime(Instruction const &init, Instruction const &co
     compilerErrorIf(conditionAddr < 0, "Use of void-expression in for-condition.");
 
     d_codeBuffer << d_bfGen.assign(flag, conditionAddr);
-    d_codeBuffer << "[";
 
+    auto const [counter, lower, upper] = pinCounter ? loopCounterRange(condition, increment)
+                                                    : std::tuple<int, int, int>{-1, 0, 0};
+    if (counter != -1)
+        d_memory.pinRange(counter, lower, upper);
+
+    auto const hoisted = d_expressions.hoisted;
+    hoistInvariants([&]()
+                    {
+                        body();
+                        resetContinueFlag();
+                        increment();
+                        return bcrActive() ? logicalAnd(condition, getCurrentBreakFlag()) : condition();
+                    });
+    
+    enterRuntimeLoop();
+    d_codeBuffer << d_bfGen.movePtr(flag)
+                 << "[";
+    forgetExpressions();
     body();
+    if (counter != -1 && !d_memory.rangePinned(counter))
+    {
+        d_expressions.hoisted = hoisted;
+        enableConstEval();
+        restore(std::move(state));
+        return forStatementRuntime(init, condition, increment, body, false);
+    }
+
     resetContinueFlag();
     increment();
-    conditionAddr = d_bcrEnabled ? logicalAnd(condition, getCurrentBreakFlag()) : condition();
+    conditionAddr = bcrActive() ? logicalAnd(condition, getCurrentBreakFlag()) : condition();
                                
     d_codeBuffer << d_bfGen.assign(flag, conditionAddr)
                  << "]";
 
+    d_expressions.hoisted = hoisted;
     exitScope();
     enableConstEval();
+    commit(state);
     return -1;
 }
 
+std::tuple<int, int, int> Compiler::loopCounterRange(Instruction const &condition, Instruction const &increment)
+{
+    // The counter is the only variable declared in the init-statement, and should have
+    // a known initial value. The condition is evaluated for successive values of the
+    // counter (with all other cells unknown) until it becomes false, checking that the
+    // increment adds exactly 1 each time. Returns {counter, lower, upper}, or a counter
+    // of -1 when no such range can be found.
+    std::tuple<int, int, int> const none{-1, 0, 0};
+    if (!d_constEvalAllowed)
+        return none;
+    
+    int counter = -1;
+    for (int const addr: d_memory.cellsInScope(d_scope.current()))
+    {
+        if (d_memory.scope(addr) != d_scope.current() || d_memory.isTemp(addr))
+            continue;
+
+        if (counter != -1 || d_memory.sizeOf(addr) != 1 || !d_memory.valueKnown(addr))
+            return none;
+        
+        counter = addr;
+    }
+
+    if (counter == -1)
+        return none;
+
+    State state = save();
+    d_constEvalEnabled = true;
+    disableBoundChecking();
+    for (int addr = 0; addr != static_cast<int>(d_memory.cellsRequired()); ++addr)
+    {
+        if (addr != counter)
+            d_memory.setValueUnknown(addr);
+    }
+
+    int const start = d_memory.value(counter);
+    int last = -1;
+    for (int value = start; value - start != MAX_LOOP_ANALYSIS_ITERATIONS; ++value)
+    {
+        d_memory.setValue(counter, value);
+        int const conditionAddr = condition();
+        if (conditionAddr < 0 || !d_memory.valueKnown(conditionAddr) || d_memory.value(counter) != value)
+            break;
+
+        if (d_memory.value(conditionAddr) == 0)
+        {
+            last = value - 1;
+            break;
+        }
+
+        increment();
+        if (!d_memory.valueKnown(counter) || d_memory.value(counter) != value + 1)
+            break;
+
+        d_memory.freeTemps(d_scope.current());
+    }
+
+    restore(std::move(state));
+    return (last >= start) ? std::tuple<int, int, int>{counter, start, last} : none;
+}
+
 int Compiler::forRangeStatement(BFXFunction::Parameter const &param, Instruction const &array, Instruction const &body)
 {
     auto const &[ident, paramType] = param;
@@ -1779,8 +4304,9 @@ int Compiler::forRangeStatement(BFXFunction::Parameter const &param, Instruction
         }    
     }
     
-    --d_loopUnrolling;
+    d_loopUnrolling = state.loopUnrolling;
     exitScope();
+    commit(state);
     
     return -1;
 
@@ -1790,34 +4316,59 @@ int Compiler::forRangeStatementRuntime(BFXFunction::Parameter const &param, Inst
                                        
 {
     auto const &[ident, paramType] = param;
-    compilerWarningIf(paramType == BFXFunction::ParameterType::Reference,
-                      "Declaring ranged-for variable as reference has no effect in runtime loop.");
+    bool const reference = (paramType == BFXFunction::ParameterType::Reference);
     
+    disableConstEval();
+    int const arrayAddr = array();
+    compilerErrorIf(arrayAddr < 0, "Use of void-expression in for-initialization.");
+    int const nIter = d_memory.sizeOf(arrayAddr);
+    compilerErrorIf(nIter > MAX_ARRAY_SIZE,
+                    "Cannot iterate over all ", nIter, " elements of \"", d_memory.identifier(arrayAddr),
+                    "\" at runtime: the maximum array size (", MAX_ARRAY_SIZE, ") is exceeded.");
+
+    enterRuntimeLoop();
+    if (d_memory.hasArrayHeader(arrayAddr))
+    {
+        State state = save();
+        if (forRangeCursor(param, arrayAddr, body))
+        {
+            commit(state);
+            enableConstEval();
+            return -1;
+        }
+        restore(std::move(state));
+    }
+
+    // The body accesses the array itself, which therefore has to stay in place: each
+    // element is fetched by its index and, for references, stored back afterwards.
     int const tmp = allocateTempBlock(3);
     int const iterator = tmp + 0;
     int const flag = tmp + 1;
     int const finalIdx = tmp + 2;
     
-    disableConstEval();
-    int const arrayAddr = array();
-    int const nIter = d_memory.sizeOf(arrayAddr);
     enterScope(Scope::Type::For);
     int const elementAddr = declareVariable(ident, TypeSystem::Type(1));
-    compilerErrorIf(elementAddr < 0 || arrayAddr < 0, "Use of void-expression in for-initialization.");
+    compilerErrorIf(elementAddr < 0, "Use of void-expression in for-initialization.");
 
     d_codeBuffer << d_bfGen.setToValue(iterator, 0)
                  << d_bfGen.setToValue(finalIdx, nIter)
                  << d_bfGen.setToValue(flag, 1)
                  << "["
-                 <<    d_bfGen.fetchElement(arrayAddr, nIter, iterator, elementAddr);
+                 <<    d_bfGen.fetchElement(arrayAddr, nIter, iterator, elementAddr,
+                                                     d_memory.hasArrayHeader(arrayAddr));
 
+    forgetExpressions();
     body();
     resetContinueFlag();
+    if (reference)
+        d_codeBuffer << d_bfGen.assignElement(arrayAddr, nIter, iterator, elementAddr,
+                                              d_memory.hasArrayHeader(arrayAddr));
+
+    d_codeBuffer << d_bfGen.incr(iterator);
     int finalElementCheck = notEqual(iterator, finalIdx);
-    int conditionAddr = d_bcrEnabled ? logicalAnd(finalElementCheck, getCurrentBreakFlag()) : finalElementCheck;
+    int conditionAddr = bcrActive() ? logicalAnd(finalElementCheck, getCurrentBreakFlag()) : finalElementCheck;
     
-    d_codeBuffer <<    d_bfGen.incr(iterator)
-                 <<    d_bfGen.assign(flag, conditionAddr)
+    d_codeBuffer <<    d_bfGen.assign(flag, conditionAddr)
                  << "]";
     
     exitScope();
@@ -1825,6 +4376,77 @@ int Compiler::forRangeStatementRuntime(BFXFunction::Parameter const &param, Inst
     return -1;
 }
 
+bool Compiler::forRangeCursor(BFXFunction::Parameter const &param, int const arrayAddr,
+                              Instruction const &body)
+{
+    // The array is rotated through the last cell of its header: on each iteration the
+    // first element is moved into this slot, where the body finds it at a fixed address,
+    // and afterwards the array advances by one element while the slot is moved to the
+    // back. This is only possible when the body doesn't access the array otherwise.
+    auto const &[ident, paramType] = param;
+    bool const reference = (paramType == BFXFunction::ParameterType::Reference);
+    int const nIter = d_memory.sizeOf(arrayAddr);
+    int const slot = arrayAddr - 1;
+
+    // The number of remaining iterations is tested against zero in place, for which
+    // the counter needs two scratch-cells next to it.
+    int const tmp = allocateTempBlock(4);
+    int const counter = tmp + 0;
+    int const done = tmp + 1;
+    int const flag = tmp + 3;
+
+    enterScope(Scope::Type::For);
+    int const elementAddr = reference ? slot : declareVariable(ident, TypeSystem::Type(1));
+    if (reference)
+        d_memory.addAlias(slot, ident, d_scope.current());
+    
+    d_codeBuffer << d_bfGen.setToValue(counter, nIter)
+                 << d_bfGen.setToValue(flag, 1)
+                 << "["
+                 <<    d_bfGen.rotateOut(arrayAddr);
+    if (!reference)
+        d_codeBuffer << d_bfGen.assign(elementAddr, slot);
+    
+    BFGenerator::Checkpoint const cp = d_bfGen.checkpoint();
+    forgetExpressions();
+    body();
+    bool const accessed = d_bfGen.visited(cp, arrayAddr - d_memory.headerSize(arrayAddr), slot)
+        || d_bfGen.visited(cp, arrayAddr, arrayAddr + nIter);
+    d_bfGen.commit(cp);
+    if (accessed)
+        return false;
+
+    if (reference)
+        d_memory.removeAlias(slot, ident, d_scope.current());
+
+    resetContinueFlag();
+    d_codeBuffer << d_bfGen.rotateIn(arrayAddr, nIter)
+                 << d_bfGen.decr(counter)
+                 << d_bfGen.isZero(counter)
+                 << (bcrActive() ? d_bfGen.assign(flag, getCurrentBreakFlag()) : d_bfGen.setToValue(flag, 1))
+                 << d_bfGen.movePtr(done)
+                 << "["
+                 <<     d_bfGen.setToValue(flag, 0)
+                 <<     d_bfGen.setToValue(done, 0)
+                 << "]"
+                 << d_bfGen.movePtr(flag)
+                 << "]";
+
+    if (bcrActive())
+    {
+        // After a break, the remaining rotations bring the array back in order
+        d_codeBuffer << d_bfGen.movePtr(counter)
+                     << "["
+                     <<    d_bfGen.rotateOut(arrayAddr)
+                     <<    d_bfGen.rotateIn(arrayAddr, nIter)
+                     <<    d_bfGen.decr(counter)
+                     << "]";
+    }
+    
+    exitScope();
+    return true;
+}
+
 int Compiler::whileStatement(Instruction const &condition, Instruction const &body)
 {
     if (!d_constEvalEnabled)
@@ -1840,43 +4462,69 @@ int Compiler::whileStatement(Instruction const &condition, Instruction const &bo
         return whileStatementRuntime(condition, body);
     }
 
+    // See forStatement()
+    int const branches = d_runtimeBranches;
     int count = 0;
     while (d_memory.value(conditionAddr))
     {
         body();
         resetContinueFlag();
-        conditionAddr = d_bcrEnabled ? logicalAnd(condition, getCurrentBreakFlag()) : condition();
+        conditionAddr = bcrActive() ? logicalAnd(condition, getCurrentBreakFlag()) : condition();
         ++d_loopUnrolling;
         
-        if (!d_memory.valueKnown(conditionAddr) || (count++ > MAX_LOOP_UNROLL_ITERATIONS))
+        if (!d_memory.valueKnown(conditionAddr) || (count++ > MAX_LOOP_UNROLL_ITERATIONS) ||
+            (d_bcrEnabled && d_runtimeBranches != branches))
         {
             restore(std::move(state));
             return whileStatementRuntime(condition, body);
         }
     }
     
-    --d_loopUnrolling;
+    d_loopUnrolling = state.loopUnrolling;
     exitScope();
+    commit(state);
     return -1;    
 }
 
 int Compiler::whileStatementRuntime(Instruction const &condition, Instruction const &body)
 {
-    int const flag = condition();
-    compilerErrorIf(flag < 0, "Use of void-expression in while-condition.");
+    // A temporary condition is used as the flag of the loop, so it can't be a reused
+    // result. Other conditions are copied first, because the flag is overwritten at
+    // the end of every iteration.
+    forgetExpressions();
+    int const conditionAddr = condition();
+    compilerErrorIf(conditionAddr < 0, "Use of void-expression in while-condition.");
+
+    int flag = conditionAddr;
+    if (!d_memory.isTemp(conditionAddr) || d_memory.isLiteral(conditionAddr) || isShared(conditionAddr))
+    {
+        flag = allocateTemp();
+        assign(flag, conditionAddr);
+    }
 
     enterScope(Scope::Type::While);
     disableConstEval();
+
+    auto const hoisted = d_expressions.hoisted;
+    hoistInvariants([&]()
+                    {
+                        body();
+                        resetContinueFlag();
+                        return bcrActive() ? logicalAnd(condition, getCurrentBreakFlag()) : condition();
+                    });
     
+    enterRuntimeLoop();
     d_codeBuffer << d_bfGen.movePtr(flag)
                  << "[";
+    forgetExpressions();
     body();
     resetContinueFlag();
-    int conditionAddr = d_bcrEnabled ? logicalAnd(condition, getCurrentBreakFlag()) : condition();
+    int const nextConditionAddr = bcrActive() ? logicalAnd(condition, getCurrentBreakFlag()) : condition();
     
-    d_codeBuffer << d_bfGen.assign(flag, conditionAddr)
+    d_codeBuffer << d_bfGen.assign(flag, nextConditionAddr)
                  << "]";
 
+    d_expressions.hoisted = hoisted;
     exitScope();
     enableConstEval();
     return -1;
@@ -1886,6 +4534,32 @@ int Compiler::switchStatement(Instruction const &compareExpr,
                               std::vector<std::pair<Instruction, Instruction>> const &cases,
                               Instruction const &defaultCase)
 {
+    // When the selector is only known at runtime and all case-values are constants,
+    // the cases are dispatched by stepping a single copy of the selector down from one
+    // case-value to the next. Otherwise (or when wide integers are involved), the switch
+    // is lowered to an if-else ladder.
+    State state = save();
+    int const selector = compareExpr();
+    compilerErrorIf(selector < 0, "Use of void-expression in switch-statement.");
+
+    std::vector<std::pair<long, size_t>> labels; // {value, case index}
+    bool dispatch = !isConstant(selector) && !isWide(selector);
+    for (size_t idx = 0; dispatch && idx != cases.size(); ++idx)
+    {
+        int const addr = cases[idx].first();
+        dispatch = (addr >= 0) && isConstant(addr) && !isWide(addr);
+        if (dispatch)
+            labels.push_back({d_memory.value(addr), idx});
+    }
+
+    if (dispatch)
+    {
+        switchDispatch(selector, labels, cases, defaultCase);
+        commit(state);
+        return -1;
+    }
+    
+    restore(std::move(state));
     std::function<Instruction(size_t const)> ifElseLadder;
 
     ifElseLadder =
@@ -1906,11 +4580,98 @@ int Compiler::switchStatement(Instruction const &compareExpr,
     return ifElseLadder(0)();
 }
 
+void Compiler::switchDispatch(int const selector,
+                              std::vector<std::pair<long, size_t>> labels,
+                              std::vector<std::pair<Instruction, Instruction>> const &cases,
+                              Instruction const &defaultCase)
+{
+    // The copy of the selector is decremented to the next case-value before every
+    // zero-test. When it's nonzero, the next case is tried inside the loop; when it's
+    // zero, the loop is skipped and the case-body runs once the flag is still set.
+    // The default body runs in the innermost loop after clearing the selector:
+    //
+    //   sel -= v0 [ sel -= v1 - v0 [ ... [ sel = 0; default; flag = 0 ] ... ]
+    //               flag [ case 1; flag = 0 ] ]
+    //   flag [ case 0; flag = 0 ]
+    
+    std::stable_sort(labels.begin(), labels.end(),
+                     [](auto const &a, auto const &b)
+                     {
+                         return a.first < b.first;
+                     });
+    labels.erase(std::unique(labels.begin(), labels.end(),
+                             [](auto const &a, auto const &b)
+                             {
+                                 return a.first == b.first;
+                             }), labels.end());
+
+    disableConstEval();
+    int const sel = allocateTemp();
+    int const flag = allocateTemp();
+    d_codeBuffer << d_bfGen.assign(sel, selector)
+                 << d_bfGen.setToValue(flag, 1);
+
+    auto runBody = [&, this](Instruction const &body)
+                   {
+                       forgetExpressions();
+                       enterScope(Scope::Type::If);
+                       if (body)
+                           body();
+                       exitScope();
+                       d_codeBuffer << d_bfGen.setToValue(flag, 0);
+                   };
+
+    std::function<void(size_t const)> dispatchFrom;
+    dispatchFrom =
+        [&, this](size_t const idx)
+        {
+            if (idx == labels.size())
+            {
+                d_codeBuffer << d_bfGen.setToValue(sel, 0);
+                runBody(defaultCase);
+                return;
+            }
+
+            // Step down in whichever direction wraps around the shortest way
+            unsigned long const previous = (idx == 0) ? 0 : labels[idx - 1].first;
+            d_codeBuffer << d_bfGen.addConst(sel, signedValue(previous - labels[idx].first))
+                         << "[";
+            dispatchFrom(idx + 1);
+            d_codeBuffer << d_bfGen.movePtr(sel)
+                         << "]"
+                         << d_bfGen.movePtr(flag)
+                         << "[";
+            runBody(cases[labels[idx].second].second);
+            d_codeBuffer << "]";
+        };
+
+    dispatchFrom(0);
+    markBcrFlagsUnknown();
+    enableConstEval();
+}
+
+void Compiler::markBcrFlagsUnknown()
+{
+    ++d_runtimeBranches;
+    if (!bcrActive())
+        return;
+
+    // Runtime branches might have changed bcr-flags --> mark values unknown
+    d_memory.setValueUnknown(getCurrentContinueFlag());
+    for (auto const &pr: d_bcrMap)
+    {
+        int const breakFlag = pr.second.first;
+        if (breakFlag != -1 && pr.first.find(d_scope.function()) == 0)
+            d_memory.setValueUnknown(breakFlag);
+    }
+}
+
 int Compiler::breakStatement()
 {
     compilerErrorIf(!d_bcrEnabled, "break-statement not supported when compiling with --no-bcr");
     
     int const flag = getCurrentBreakFlag();
+    assert(flag != -1 && "break-flag missing in loop");
     if (d_constEvalEnabled)
         constEvalSetToValue(flag, 0);
     else
@@ -1924,6 +4685,7 @@ int Compiler::continueStatement()
     compilerErrorIf(!d_bcrEnabled, "continue-statement not supported when compiling with --no-bcr");
     
     int const flag = getCurrentContinueFlag();
+    assert(flag != -1 && "continue-flag missing in loop");
     if (d_constEvalEnabled)
         constEvalSetToValue(flag, 0);
     else
@@ -1934,10 +4696,11 @@ int Compiler::continueStatement()
 
 void Compiler::resetContinueFlag()
 {
-    if (!d_bcrEnabled)
+    if (!bcrActive())
         return;
     
     int const flag = getCurrentContinueFlag();
+    assert(flag != -1 && "continue-flag missing in loop");
     if (d_constEvalEnabled)
         constEvalSetToValue(flag, 1);
     else
@@ -1951,9 +4714,9 @@ int Compiler::returnStatement()
     std::string const func = d_scope.function();
     for (auto const &pr: d_bcrMap)
     {
-        if (pr.first.find(func) == 0)
+        int const breakFlag = pr.second.first;
+        if (breakFlag != -1 && pr.first.find(func) == 0)
         {
-            int const breakFlag = pr.second.first;
             if (d_constEvalEnabled)
                 constEvalSetToValue(breakFlag, 0);
             else
@@ -11,11 +11,17 @@
 
 #include <string>
 #include <map>
+#include <set>
+#include <deque>
+#include <array>
+#include <tuple>
 #include <sstream>
 #include "scanner.h"
+#include "codebuffer.h"
 #include "bfgenerator.h"
 #include "memory.h"
 #include "scope.h"
+#include "layoutprofile.h"
 
 class Compiler: public CompilerBase
 {
@@ -24,7 +30,8 @@ public:
         {
          INT8,
          INT16,
-         INT32
+         INT32,
+         INT64
         };
 
     struct Options
@@ -34,6 +41,7 @@ public:
         std::string               bfxFile;
         std::string               testFile;;
         std::string               profileFile;
+        std::vector<std::string>  layoutProfiles;
         std::ostream*             outStream{&std::cout};
         bool                      constEvalAllowed{true};
         bool                      randomEnabled{false};
@@ -45,10 +53,13 @@ public:
 
 private:
     static constexpr int TAPE_SIZE_INITIAL{30000};
+    static constexpr long MAX_CONST_KERNEL_POW2{256}; // largest power of 2 passed to a constant kernel
 
-    long const MAX_INT;
+    unsigned long const MAX_INT;
+    long const MAX_RANGE;       // largest bound of a range; MAX_INT may not fit a long
     long const MAX_ARRAY_SIZE;
     int  const MAX_LOOP_UNROLL_ITERATIONS{20};
+    static constexpr int MAX_LOOP_ANALYSIS_ITERATIONS{256}; // longest loop for which the counter-range is derived
 
     std::string const d_sourceFile;
     CellType const d_cellType;
@@ -59,12 +70,14 @@ private:
     BFGenerator d_bfGen;
 
     std::map<std::string, BFXFunction>         d_functionMap;
-    std::map<std::string, int>                 d_constMap;
+    std::map<std::string, long>                d_constMap;
+    std::map<std::string, std::vector<int>>    d_constTables;
     std::vector<std::string>                   d_includePaths;
     std::vector<std::string>                   d_included;
-    std::ostringstream                         d_codeBuffer;
+    CodeBuffer                                 d_codeBuffer;
 
     using BcrMapType = std::map<std::string, std::pair<int, int>>;
+    using Range = std::pair<long, long>; // {lower, upper}, inclusive
     BcrMapType d_bcrMap;
     
     enum class Stage
@@ -76,6 +89,14 @@ private:
         };
 
     Stage         d_stage{Stage::IDLE};
+
+    enum class BcrFlags
+        {
+         ALLOCATE,
+         INHERIT,
+         NONE
+        };
+    
     std::string   d_instructionFilename;
     int           d_instructionLineNr;
     bool          d_constEvalEnabled{true};
@@ -84,27 +105,138 @@ private:
     int           d_loopUnrolling{0};
     bool          d_boundsCheckingEnabled{true};
     bool const    d_bcrEnabled{true};
+    bool          d_loopUsesBcr{true};
+    int           d_runtimeBranches{0};
     bool const    d_includeWarningEnabled{true};
     bool const    d_assertWarningEnabled{true};
     std::ostream& d_outStream;
     std::string const d_profileFile;
 
+    // Layout derived from earlier profiles, the cells occupied by each variable and
+    // struct-field in this compilation (written to the profile) and the most recent
+    // address and identifier of each variable.
+    LayoutProfile d_layout;
+    std::map<std::string, std::set<std::pair<int, int>>> d_layoutCells;
+    std::map<std::string, std::pair<int, std::string>>   d_liveVariables;
+
     std::string const d_testFile;
     std::vector<std::string> d_testVector;
     std::ofstream d_testStream;
 
+    // Liveness analysis: while parsing a function, the token-positions at which each
+    // identifier occurs and the token-ranges of its loops are collected. From these,
+    // the position after which a local variable is no longer used is derived, such
+    // that its cells can be released before the end of its scope.
+    // The positions of break, continue and return are collected as well, to find out
+    // which loops need break/continue-flags of their own.
+    struct ParsedFunction
+    {
+        std::map<std::string, std::vector<int>> occurrences;
+        std::vector<int>                        loopStarts;
+        std::vector<int>                        switchStarts;
+        std::vector<std::pair<int, int>>        loops;   // includes switch-statements
+        std::vector<int>                        jumps;   // break and continue
+        std::vector<int>                        returns;
+    };
+
+    struct LocalVariable
+    {
+        std::string function;
+        std::string ident;
+        std::string scope;
+        int         addr;
+        int         lastUse;
+    };
+
+    // Tokens read ahead by the lexer, to rewrite the element-access of arrays of
+    // structs in terms of their struct-of-arrays layout
+    struct Token
+    {
+        int         id;
+        std::string matched;
+    };
+
+    std::deque<Token>                                 d_tokens;
+
+    // Multi-dimensional array that was indexed by fewer indices than it has dimensions,
+    // represented by a temporary (of the recorded version)
+    struct SubArray
+    {
+        int              array;
+        std::vector<int> indices;
+        int              version;
+    };
+
+    std::map<int, SubArray>                           d_subArrays;
+    int                                               d_tokenIndex{0};
+    ParsedFunction                                    d_parsedFunction;
+    std::map<std::string, std::map<std::string, int>> d_lastUse;
+    std::set<std::string>                             d_bcrFunctions;
+    std::vector<LocalVariable>                        d_localVariables;
+
+    // Common subexpression elimination: the cells holding the results of pure runtime
+    // expressions (keyed by their structure), the expressions held by temporaries and
+    // the temporaries that have been reused. Each entry records the version of its cell
+    // and is stale once the cell has been written to. Results that were hoisted out of
+    // the enclosing runtime loops remain available inside their bodies.
+    struct Expressions
+    {
+        std::map<std::string, std::pair<int, int>> available; // key -> {holder, version}
+        std::map<int, std::pair<std::string, int>> held;      // temp -> {key, version}
+        std::map<int, int>                         shared;    // temp -> version
+        std::map<std::string, std::pair<int, int>> hoisted;   // key -> {holder, version}
+    };
+
+    // Expression evaluated in a loop, by the value-numbers of its operands
+    struct Invariant
+    {
+        std::string op;
+        std::string lhs;
+        std::string rhs;
+    };
+
+    using Invariants = std::map<std::string, Invariant>;
+
+    Expressions d_expressions;
+    bool        d_probing{false};
+    Invariants *d_invariants{nullptr};
+
+    // In runtime code, a string literal that is passed directly to __prints or to a
+    // reference parameter is not written to the tape until it is used otherwise, or
+    // until a nested runtime branch or loop is entered (see passLiteral()). Its cells
+    // are recorded with their versions.
+    int                              d_instructionDepth{0};
+    int                              d_literalDepth{-1};
+    std::vector<std::pair<int, int>> d_deferredLiterals;
+
+    // A constant table that is indexed directly is represented by a temporary (of the
+    // recorded version) instead of a copy of its elements (see indexedOperand()).
+    int                                        d_tableDepth{-1};
+    std::map<int, std::pair<std::string, int>> d_tableHandles;
+
     struct State
     {
-        Memory memory;
+        Memory::Checkpoint memory;
         Scope  scope;
-        BFGenerator bfGen;
-        std::string buffer;
+        BFGenerator::Checkpoint bfGen;
+        size_t buffer;
         bool constEval;
         int loopUnrolling;
         bool boundsChecking;
         BcrMapType bcrMap;
+        std::vector<LocalVariable> localVariables;
+        std::vector<std::pair<int, int>> deferredLiterals;
     };
 
+    enum class WideOp
+        {
+         ADD,
+         SUBTRACT,
+         MULTIPLY,
+         EQUAL,
+         LESS
+        };
+
     enum class SubScopeType
         {
          FOR,
@@ -127,7 +259,8 @@ private:
     std::string fileWithoutPath(std::string const &file);
     void addFunction(BFXFunction const &bfxFunc);
     void addGlobals(std::vector<std::pair<std::string, TypeSystem::Type>> const &declarations);
-    void addConstant(std::string const &ident, int const num);
+    void addConstant(std::string const &ident, long const num);
+    void addConstTable(std::string const &ident, int const sz, std::vector<long> const &values);
     void addStruct(std::string const &name,
                    std::vector<std::pair<std::string, TypeSystem::Type>> const &fields);
     
@@ -135,18 +268,24 @@ private:
                  std::vector<std::tuple<std::string, std::string, std::string>> const &testBody);
     void writeTestList();
 
-    int  compileTimeConstant(std::string const &ident) const;
+    long compileTimeConstant(std::string const &ident) const;
     bool isCompileTimeConstant(std::string const &ident) const;
+    bool isConstTable(std::string const &ident) const;
+    TypeSystem::Type declaredType(std::string const &ident) const;
+    TypeSystem::Type structArrayType(std::string const &structName, int const n) const;
 
     State save();
     void restore(State &&state);
+    void commit(State const &state);
     void enterScope(Scope::Type const type);
     void enterScope(std::string const &name);
     void exitScope(std::string const &name = "");
-    void allocateBCRFlags(bool const alloc);
+    void allocateBCRFlags(BcrFlags const flags);
+    bool bcrActive() const;
     int getCurrentContinueFlag() const;
     int getCurrentBreakFlag() const;
     void resetContinueFlag();
+    void markBcrFlagsUnknown();
     
 
     bool setConstEval(bool const val);
@@ -155,20 +294,58 @@ private:
     void disableBoundChecking();
     void enableBoundChecking();
     void sync(int const addr);
-    int wrapValue(int val);
-    void constEvalSetToValue(int const addr, int const val);
-    void runtimeSetToValue(int const addr, int const val);
+    int passLiteral(AddressOrInstruction const &arg);
+    void writeDeferredLiterals(int const addr = -1);
+    long wrapValue(long const val) const;
+    long signedValue(long const val) const;
+    bool isConstant(int const addr) const;
+    bool isDeadTemp(AddressOrInstruction const &operand);
+    bool isTempResult(AddressOrInstruction const &operand) const;
+    bool isShared(int const addr) const;
+    std::string valueNumber(int const addr) const;
+    std::string probeValueNumber(AddressOrInstruction const &operand);
+    std::pair<std::string, int> reuseExpression(std::string const &op, AddressOrInstruction const &lhs,
+                                                AddressOrInstruction const &rhs, bool const commutative);
+    int recordExpression(std::string const &key, int const result);
+    void holdExpression(int const holder, std::string const &key);
+    std::string heldExpression(int const addr) const;
+    void forgetExpressions();
+    void pruneExpressions();
+    void hoistInvariants(Instruction const &iteration);
+    void enterRuntimeLoop();
+    bool isInvariant(std::string const &number, Invariants const &candidates, std::set<int> const &written) const;
+    int hoistExpression(std::string const &key, Invariants const &candidates);
+    Range rangeOf(AddressOrInstruction const &operand) const;
+    void narrowRange(int const addr, Range const &range);
+    int withRange(int const result, Range const &range);
+    static int lessByRange(Range const &lhs, Range const &rhs);
+    static int equalByRange(Range const &lhs, Range const &rhs);
+    void constEvalSetToValue(int const addr, long const val);
+    void runtimeSetToValue(int const addr, long const val);
     void runtimeAssign(int const lhs, int const rhs);
+    void runtimeMove(int const lhs, int const rhs);
+    void assignBlock(int const lhs, int const rhs, int const n, bool const consumeRhs = false);
+    void runtimeFill(int const lhs, int const rhs, int const n);
+    int runtimeCount(AddressOrInstruction const &count, int const limit);
+    void runtimeCountedCells(int const count, int const limit, std::function<void(int const)> const &op);
+    void printConstants(std::vector<int> const &chars);
     
     static bool validateFunction(BFXFunction const &bfxFunc);
     static std::string cancelOppositeCommands(std::string const &bf);
     
     // Memory management uitilities
     int allocate(std::string const &ident, TypeSystem::Type type);
-    int allocateTemp(TypeSystem::Type type);
-    int allocateTemp(int const sz = 1);
-    int allocateTempBlock(int const sz);
-    int addressOf(std::string const &ident);
+    int allocateNamed(std::string const &ident, std::string const &scope, TypeSystem::Type type,
+                      std::string const &function);
+    void recordLayout(std::string const &key, int const addr, TypeSystem::Type type);
+    Instruction addLoop(Instruction const &loop);
+    void addSwitch();
+    void trackLiveness(std::string const &ident, int const addr);
+    void freeDeadVariables(int const token);
+    int allocateTemp(TypeSystem::Type type, int const near = -1);
+    int allocateTemp(int const sz = 1, int const near = -1);
+    int allocateTempBlock(int const sz, int const near = -1);
+    int addressOf(std::string const &ident, bool const passOn = false);
     int staticAssert(Instruction const &check, std::string const &msg);
 
         // Instruction generator
@@ -179,7 +356,10 @@ private:
         return Instruction([=, this](){
                                setFilename(file);
                                setLineNr(line);
-                               return (this->*Member)(args ...);
+                               ++d_instructionDepth;
+                               int const ret = (this->*Member)(args ...);
+                               --d_instructionDepth;
+                               return ret;
                            });
     }
     
@@ -195,10 +375,14 @@ private:
                                      AddressOrInstruction const &rhs,
                                      BinaryFunction func);
 
+    using NullaryFunction = int (Compiler::*)();
+    using TernaryFunction = int (Compiler::*)(AddressOrInstruction const &, AddressOrInstruction const &,
+                                              AddressOrInstruction const &);
+
     // Instructions
     int sizeOfOperator(std::string const &ident);
-    int constVal(int const val);
-    int statement(Instruction const &instr);
+    int constVal(long const val);
+    int statement(Instruction const &instr, int const token);
     int mergeInstructions(Instruction const &instr1, Instruction const &instr2);
     int arrayFromSize(int const sz, Instruction const &fill);
     int arrayFromList(std::vector<Instruction> const &list);
@@ -214,10 +398,31 @@ private:
     int fetchFieldImpl(std::vector<std::string> const &expr, int const baseAddr, size_t const baseIdx);
     
     int fetchElement(AddressOrInstruction const &arr, AddressOrInstruction const &index);
+    int indexedOperand(AddressOrInstruction const &arr);
+    std::string indexedTable(int const arr) const;
+    int constTable(std::string const &ident);
+    int lookupTable(std::string const &ident, AddressOrInstruction const &index);
     int assignElement(AddressOrInstruction const &arr, AddressOrInstruction const &index, AddressOrInstruction const &rhs);
+    int fetchFlatElement(AddressOrInstruction const &arr, AddressOrInstruction const &index);
+    int assignFlatElement(AddressOrInstruction const &arr, AddressOrInstruction const &index, AddressOrInstruction const &rhs);
+    int fetchMultiElement(int const arr, std::vector<int> const &indices);
+    int assignMultiElement(int const arr, std::vector<int> const &indices, AddressOrInstruction const &rhs);
+    SubArray subscript(int const arr, int const index) const;
+    int subArray(SubArray sub);
+    std::pair<bool, int> checkIndices(int const arr, std::vector<int> const &indices);
+    int flatIndex(std::vector<int> const &dims, std::vector<int> const &indices);
     int scanCell();
+    int scanDecimal();
     int randomCell();
     int printCell(AddressOrInstruction const &target);
+    int printString(AddressOrInstruction const &str);
+    int printDecimal(AddressOrInstruction const &value);
+    int copyCells(AddressOrInstruction const &dest, AddressOrInstruction const &src,
+                  AddressOrInstruction const &count);
+    int fillCells(AddressOrInstruction const &dest, AddressOrInstruction const &value,
+                  AddressOrInstruction const &count);
+    int compareCells(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs,
+                     AddressOrInstruction const &count);
     int preIncrement(AddressOrInstruction const &addr);
     int preDecrement(AddressOrInstruction const &addr);
     int postIncrement(AddressOrInstruction const &addr);
@@ -239,6 +444,14 @@ private:
     int logicalNot(AddressOrInstruction const &arg);
     int logicalAnd(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs);
     int logicalOr(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs);
+    int shortCircuitAnd(Instruction const &lhs, Instruction const &rhs);
+    int shortCircuitOr(Instruction const &lhs, Instruction const &rhs);
+    int shortCircuit(int const lhs, Instruction const &rhs, bool const isAnd);
+    int bitwiseAnd(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs);
+    int bitwiseOr(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs);
+    int bitwiseXor(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs);
+    int shiftLeft(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs);
+    int shiftRight(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs);
     int divideBy(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs);
     int divide(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs);
     int moduloBy(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs);
@@ -247,14 +460,41 @@ private:
     int modDiv(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs);
     void divModPair(AddressOrInstruction const &lhs, AddressOrInstruction const &rhs,
                int const divResult, int const modResult);
+    bool constDenominator(int const num, int const denom) const;
+    void divModPairConst(int const num, int const denom, int const divResult, int const modResult);
+    bool constComparand(int const lhs, int const rhs) const;
+    int compareToConst(int const lhs, long const bound, bool const less, int const result);
+    int bitwise(int const lhs, int const rhs, BFGenerator::BitOp const op);
+    bool bitwiseConst(int const var, long const value, BFGenerator::BitOp const op, int const result);
+    int shift(int const lhs, int const rhs, bool const left);
+    int constantResult(int const result, long const value);
+    int booleanEqual(AddressOrInstruction const &var, bool const value, int const result);
+    int cellBits() const;
+
+    // Integers spanning multiple cells
+    TypeSystem::Type wideType(int const bits) const;
+    bool isWide(int const addr) const;
+    bool isWideConstant(int const addr) const;
+    unsigned long wideValue(int const addr) const;
+    void setWideValue(int const addr, unsigned long const value);
+    int wideLiteral(long const value);
+    int convert(int const addr, TypeSystem::Type const &type);
+    std::pair<int, int> promote(int const lhs, int const rhs);
+    int wideArithmetic(int const lhs, int const rhs, WideOp const op);
+    std::pair<int, int> wideDivision(int const lhs, int const rhs);
+    int truthValue(int const addr);
+    Instruction truthValue(Instruction const &condition);
 
     int ifStatement(Instruction const &condition, Instruction const &ifBody, Instruction const &elseBody, bool const scoped = true);  
     int forStatement(Instruction const &init, Instruction const &condition,
                      Instruction const &increment, Instruction const &body);
     int forStatementRuntime(Instruction const &init, Instruction const &condition,
-                            Instruction const &increment, Instruction const &body);
+                            Instruction const &increment, Instruction const &body,
+                            bool const pinCounter = true);
+    std::tuple<int, int, int> loopCounterRange(Instruction const &condition, Instruction const &increment);
     int forRangeStatement(BFXFunction::Parameter const &param, Instruction const &array, Instruction const &body);
     int forRangeStatementRuntime(BFXFunction::Parameter const &param, Instruction const &array, Instruction const &body);
+    bool forRangeCursor(BFXFunction::Parameter const &param, int const arrayAddr, Instruction const &body);
     
     int whileStatement(Instruction const &condition, Instruction const &body);
     int whileStatementRuntime(Instruction const &condition, Instruction const &body);
@@ -262,6 +502,10 @@ private:
     int switchStatement(Instruction const &compareExpr,
                         std::vector<std::pair<Instruction, Instruction>> const &cases,
                         Instruction const &defaultCase);
+    void switchDispatch(int const selector,
+                        std::vector<std::pair<long, size_t>> labels,
+                        std::vector<std::pair<Instruction, Instruction>> const &cases,
+                        Instruction const &defaultCase);
     int breakStatement();
     int continueStatement();
     int returnStatement();
@@ -297,6 +541,10 @@ private:
     void error();                   // called on (syntax) errors
     int lex();
     void print();
+    Token nextToken();
+    Token const &peekToken(size_t const n);
+    void rewriteArrayDeclaration();
+    void rewriteStructArrayAccess();
 
     void exceptionHandler(std::exception const &exc);
 
@@ -313,6 +561,10 @@ private:
 template <typename First, typename ... Rest>
 void Compiler::compilerWarning(First const &first, Rest&& ... rest) const
 {
+    // Anything evaluated while probing or looking for invariants is evaluated again afterwards
+    if (d_probing || d_invariants != nullptr)
+        return;
+    
     std::cerr << "Warning: in " << filename() << " on line " << lineNr() << ": " << first;
     (std::cerr << ... << rest) << '\n';
 }
@@ -365,15 +617,23 @@ int Compiler::eval(BFGenFunc&& bfFunc, ConstFunc&& constFunc, int const resultAd
     if (canBeConstEvaluated && d_constEvalEnabled)
     {
         // Evaluate using constfunc
-        constEvalSetToValue(resultAddr, constFunc(d_memory.value(args) ...));
+        std::array<long, N> values{d_memory.value(args) ...};
+        long const result = std::apply(constFunc, values);
         
         // Application of constFunc may have resulted in side-effects if it accepted
         // reference-parameters. Check Mask for volatile values ->
-        // for each changed value, set its sync-flag to false.
+        // for each changed value, store it and set its sync-flag to false.
         
         for (int i = 0; i != N; ++i)
+        {
             if (isVolatile(i))
+            {
+                d_memory.setValue(arguments[i], values[i]);
                 d_memory.setSync(arguments[i], false);
+            }
+        }
+
+        constEvalSetToValue(resultAddr, result);
     }
     else 
     {
@@ -404,6 +664,7 @@ inline std::ostream &operator<<(std::ostream &out, Compiler::CellType type)
     case Compiler::CellType::INT8: return (out << "int8");
     case Compiler::CellType::INT16: return (out << "int16");
     case Compiler::CellType::INT32: return (out << "int32");
+    case Compiler::CellType::INT64: return (out << "int64");
     }
 
     assert(false && "unreachable");
@@ -129,151 +129,162 @@ PI_ const s_productionInfo[] =
      {348, 2}, // 8: program ->  program unit_test_block
      {351, 2}, // 9: include_directive (INCLUDE) ->  INCLUDE STR
      {349, 2}, // 10: function_definition ->  function_header scope_block
-     {355, 5}, // 11: function_header (FUNCTION) ->  FUNCTION IDENT '(' optional_parameter_list ')'
-     {355, 7}, // 12: function_header (FUNCTION) ->  FUNCTION IDENT '=' IDENT '(' optional_parameter_list ')'
+     {356, 5}, // 11: function_header (FUNCTION) ->  FUNCTION IDENT '(' optional_parameter_list ')'
+     {356, 7}, // 12: function_header (FUNCTION) ->  FUNCTION IDENT '=' IDENT '(' optional_parameter_list ')'
      {352, 5}, // 13: const_definition (CONST) ->  CONST IDENT '=' NUM ';'
      {352, 5}, // 14: const_definition (CONST) ->  CONST IDENT '=' CHR ';'
-     {353, 5}, // 15: struct_definition (STRUCT) ->  STRUCT IDENT '{' struct_body '}'
-     {353, 2}, // 16: struct_definition (';') ->  struct_definition ';'
-     {356, 2}, // 17: struct_body (';') ->  variable_specification_list ';'
-     {356, 3}, // 18: struct_body (';') ->  struct_body variable_specification_list ';'
-     {357, 3}, // 19: scope_block ('{') ->  '{' code_body '}'
-     {358, 1}, // 20: parameter (IDENT) ->  IDENT
-     {358, 2}, // 21: parameter ('&') ->  '&' IDENT
-     {359, 1}, // 22: parameter_list ->  parameter
-     {359, 3}, // 23: parameter_list (',') ->  parameter_list ',' parameter
-     {360, 1}, // 24: optional_parameter_list ->  parameter_list
-     {360, 0}, // 25: optional_parameter_list ->  <empty>
-     {350, 3}, // 26: global_variable_list (GLOBAL) ->  GLOBAL variable_specification_list ';'
-     {361, 0}, // 27: code_body ->  <empty>
-     {361, 2}, // 28: code_body ->  code_body statement
-     {362, 1}, // 29: statement ->  statement_
-     {363, 2}, // 30: statement_ (errTok_) ->  errTok_ ';'
-     {363, 1}, // 31: statement_ (';') ->  ';'
-     {363, 2}, // 32: statement_ (';') ->  expression ';'
-     {363, 2}, // 33: statement_ (';') ->  static_assert ';'
-     {363, 1}, // 34: statement_ ->  scope_block
-     {363, 1}, // 35: statement_ ->  for_statement
-     {363, 1}, // 36: statement_ ->  if_statement
-     {363, 1}, // 37: statement_ ->  while_statement
-     {363, 1}, // 38: statement_ ->  switch_statement
-     {363, 1}, // 39: statement_ ->  break_statement
-     {363, 1}, // 40: statement_ ->  continue_statement
-     {363, 1}, // 41: statement_ ->  return_statement
-     {364, 1}, // 42: expression ->  variable_declaration
-     {364, 1}, // 43: expression (_var) ->  variable
-     {364, 2}, // 44: expression (unaryMinus) ->  '-' expression
-     {364, 1}, // 45: expression (_arr) ->  array_element
-     {364, 1}, // 46: expression ->  constant_literal
-     {364, 1}, // 47: expression ->  string_literal
-     {364, 1}, // 48: expression ->  anonymous_array
-     {364, 1}, // 49: expression ->  anonymous_struct
-     {364, 1}, // 50: expression ->  function_call
-     {364, 1}, // 51: expression ->  builtin_function
-     {364, 4}, // 52: expression (SIZEOF) ->  SIZEOF '(' IDENT ')'
-     {364, 3}, // 53: expression ('=') ->  variable_declaration '=' expression
-     {364, 3}, // 54: expression ('=') ->  variable '=' expression
-     {364, 3}, // 55: expression ('=') ->  array_element '=' expression
-     {364, 3}, // 56: expression ('(') ->  '(' expression ')'
-     {364, 2}, // 57: expression (INC) ->  INC variable
-     {364, 2}, // 58: expression (DEC) ->  DEC variable
-     {364, 2}, // 59: expression (INC) ->  variable INC
-     {364, 2}, // 60: expression (DEC) ->  variable DEC
-     {364, 2}, // 61: expression (INC) ->  INC array_element
-     {364, 2}, // 62: expression (DEC) ->  DEC array_element
-     {364, 2}, // 63: expression (INC) ->  array_element INC
-     {364, 2}, // 64: expression (DEC) ->  array_element DEC
-     {364, 3}, // 65: expression (ADD) ->  variable ADD expression
-     {364, 3}, // 66: expression (ADD) ->  array_element ADD expression
-     {364, 3}, // 67: expression ('+') ->  expression '+' expression
-     {364, 3}, // 68: expression (SUB) ->  variable SUB expression
-     {364, 3}, // 69: expression (SUB) ->  array_element SUB expression
-     {364, 3}, // 70: expression ('-') ->  expression '-' expression
-     {364, 3}, // 71: expression (MUL) ->  variable MUL expression
-     {364, 3}, // 72: expression (MUL) ->  array_element MUL expression
-     {364, 3}, // 73: expression ('*') ->  expression '*' expression
-     {364, 3}, // 74: expression (DIV) ->  variable DIV expression
-     {364, 3}, // 75: expression (DIV) ->  array_element DIV expression
-     {364, 3}, // 76: expression ('/') ->  expression '/' expression
-     {364, 3}, // 77: expression (MOD) ->  variable MOD expression
-     {364, 3}, // 78: expression (MOD) ->  array_element MOD expression
-     {364, 3}, // 79: expression (DIVMOD) ->  variable DIVMOD expression
-     {364, 3}, // 80: expression (DIVMOD) ->  array_element DIVMOD expression
-     {364, 3}, // 81: expression (MODDIV) ->  variable MODDIV expression
-     {364, 3}, // 82: expression (MODDIV) ->  array_element MODDIV expression
-     {364, 3}, // 83: expression ('^') ->  expression '^' expression
-     {364, 3}, // 84: expression (POW) ->  variable POW expression
-     {364, 3}, // 85: expression (POW) ->  array_element POW expression
-     {364, 3}, // 86: expression ('%') ->  expression '%' expression
-     {364, 3}, // 87: expression ('<') ->  expression '<' expression
-     {364, 3}, // 88: expression ('>') ->  expression '>' expression
-     {364, 3}, // 89: expression (LE) ->  expression LE expression
-     {364, 3}, // 90: expression (GE) ->  expression GE expression
-     {364, 3}, // 91: expression (NE) ->  expression NE expression
-     {364, 3}, // 92: expression (EQ) ->  expression EQ expression
-     {364, 2}, // 93: expression ('!') ->  '!' expression
-     {364, 3}, // 94: expression (AND) ->  expression AND expression
-     {364, 3}, // 95: expression (OR) ->  expression OR expression
-     {365, 4}, // 96: builtin_function (PRINT) ->  PRINT '(' expression ')'
-     {365, 3}, // 97: builtin_function (SCAN) ->  SCAN '(' ')'
-     {365, 3}, // 98: builtin_function (RAND) ->  RAND '(' ')'
-     {366, 6}, // 99: static_assert (ASSERT) ->  ASSERT '(' expression ',' STR ')'
-     {367, 1}, // 100: variable (IDENT) ->  IDENT
-     {367, 1}, // 101: variable ->  field
-     {368, 3}, // 102: field (IDENT) ->  IDENT '.' IDENT
-     {368, 3}, // 103: field ('.') ->  field '.' IDENT
-     {369, 1}, // 104: constant_literal (NUM) ->  NUM
-     {369, 1}, // 105: constant_literal (CHR) ->  CHR
-     {370, 4}, // 106: array_element ('[') ->  expression '[' expression ']'
-     {371, 1}, // 107: string_literal (STR) ->  STR
-     {372, 4}, // 108: anonymous_array ('#') ->  '#' '{' expression_list '}'
-     {372, 4}, // 109: anonymous_array ('#') ->  '#' '[' NUM ']'
-     {372, 4}, // 110: anonymous_array ('#') ->  '#' '[' IDENT ']'
-     {372, 6}, // 111: anonymous_array ('#') ->  '#' '[' NUM ',' expression ']'
-     {372, 6}, // 112: anonymous_array ('#') ->  '#' '[' IDENT ',' expression ']'
-     {373, 4}, // 113: anonymous_struct (IDENT) ->  IDENT '{' optional_expression_list '}'
-     {374, 4}, // 114: function_call (IDENT) ->  IDENT '(' optional_expression_list ')'
-     {375, 2}, // 115: break_statement (BREAK) ->  BREAK ';'
-     {376, 2}, // 116: continue_statement (CONTINUE) ->  CONTINUE ';'
-     {377, 2}, // 117: return_statement (RETURN) ->  RETURN ';'
-     {378, 9}, // 118: for_statement (FOR) ->  FOR '(' expression ';' expression ';' expression ')' statement
-     {378, 10}, // 119: for_statement (FOR) ->  FOR '*' '(' expression ';' expression ';' expression ')' statement
-     {378, 8}, // 120: for_statement (FOR) ->  FOR '(' LET parameter ':' expression ')' statement
-     {378, 9}, // 121: for_statement (FOR) ->  FOR '*' '(' LET parameter ':' expression ')' statement
-     {379, 5}, // 122: if_statement (IF) ->  IF '(' expression ')' statement
-     {379, 7}, // 123: if_statement (then) ->  IF '(' expression ')' statement ELSE statement
-     {380, 5}, // 124: while_statement (WHILE) ->  WHILE '(' expression ')' statement
-     {380, 6}, // 125: while_statement (WHILE) ->  WHILE '*' '(' expression ')' statement
-     {381, 7}, // 126: switch_statement (SWITCH) ->  SWITCH '(' expression ')' '{' case_list '}'
-     {381, 8}, // 127: switch_statement (SWITCH) ->  SWITCH '(' expression ')' '{' case_list default_case '}'
-     {382, 1}, // 128: case_list ->  switch_case
-     {382, 2}, // 129: case_list ->  case_list switch_case
-     {383, 4}, // 130: switch_case (CASE) ->  CASE expression ':' statement
-     {384, 3}, // 131: default_case (DEFAULT) ->  DEFAULT ':' statement
-     {385, 2}, // 132: variable_declaration (LET) ->  LET variable_specification
-     {386, 1}, // 133: variable_specification (IDENT) ->  IDENT
-     {386, 2}, // 134: variable_specification ('&') ->  '&' IDENT
-     {386, 3}, // 135: variable_specification ('[') ->  '[' ']' IDENT
-     {386, 4}, // 136: variable_specification ('[') ->  '[' NUM ']' IDENT
-     {386, 4}, // 137: variable_specification ('[') ->  '[' IDENT ']' IDENT
-     {386, 5}, // 138: variable_specification ('[') ->  '[' STRUCT IDENT ']' IDENT
-     {387, 1}, // 139: variable_specification_list ->  variable_specification
-     {387, 3}, // 140: variable_specification_list (',') ->  variable_specification_list ',' variable_specification
-     {388, 1}, // 141: expression_list ->  expression
-     {388, 3}, // 142: expression_list (',') ->  expression_list ',' expression
-     {389, 0}, // 143: optional_expression_list ->  <empty>
-     {389, 1}, // 144: optional_expression_list ->  expression_list
-     {354, 4}, // 145: unit_test_block (START_TEST) ->  START_TEST unit_test_label unit_test_body END_TEST
-     {390, 3}, // 146: unit_test_label ('<') ->  '<' IDENT '>'
-     {391, 1}, // 147: unit_test_body ->  unit_test_case
-     {391, 2}, // 148: unit_test_body ->  unit_test_body unit_test_case
-     {392, 3}, // 149: unit_test_case ->  unit_test_label unit_test_input unit_test_expect
-     {392, 2}, // 150: unit_test_case ->  unit_test_label unit_test_expect
-     {393, 3}, // 151: unit_test_input (INPUT) ->  INPUT unit_test_content END_TEST_CONTENT
-     {394, 3}, // 152: unit_test_expect (EXPECT) ->  EXPECT unit_test_content END_TEST_CONTENT
-     {395, 0}, // 153: unit_test_content ->  <empty>
-     {395, 2}, // 154: unit_test_content (CHR) ->  unit_test_content CHR
-     {396, 1}, // 155: program_$ ->  program
+     {352, 11}, // 15: const_definition (CONST) ->  CONST '[' NUM ']' IDENT '=' '#' '{' const_table '}' ';'
+     {352, 11}, // 16: const_definition (CONST) ->  CONST '[' IDENT ']' IDENT '=' '#' '{' const_table '}' ';'
+     {353, 1}, // 17: const_table (NUM) ->  NUM
+     {353, 1}, // 18: const_table (CHR) ->  CHR
+     {353, 3}, // 19: const_table (',') ->  const_table ',' NUM
+     {353, 3}, // 20: const_table (',') ->  const_table ',' CHR
+     {354, 5}, // 21: struct_definition (STRUCT) ->  STRUCT IDENT '{' struct_body '}'
+     {354, 2}, // 22: struct_definition (';') ->  struct_definition ';'
+     {357, 2}, // 23: struct_body (';') ->  variable_specification_list ';'
+     {357, 3}, // 24: struct_body (';') ->  struct_body variable_specification_list ';'
+     {358, 3}, // 25: scope_block ('{') ->  '{' code_body '}'
+     {359, 1}, // 26: parameter (IDENT) ->  IDENT
+     {359, 2}, // 27: parameter ('&') ->  '&' IDENT
+     {360, 1}, // 28: parameter_list ->  parameter
+     {360, 3}, // 29: parameter_list (',') ->  parameter_list ',' parameter
+     {361, 1}, // 30: optional_parameter_list ->  parameter_list
+     {361, 0}, // 31: optional_parameter_list ->  <empty>
+     {350, 3}, // 32: global_variable_list (GLOBAL) ->  GLOBAL variable_specification_list ';'
+     {362, 0}, // 33: code_body ->  <empty>
+     {362, 2}, // 34: code_body ->  code_body statement
+     {363, 1}, // 35: statement ->  statement_
+     {364, 2}, // 36: statement_ (errTok_) ->  errTok_ ';'
+     {364, 1}, // 37: statement_ (';') ->  ';'
+     {364, 2}, // 38: statement_ (';') ->  expression ';'
+     {364, 2}, // 39: statement_ (';') ->  static_assert ';'
+     {364, 1}, // 40: statement_ ->  scope_block
+     {364, 1}, // 41: statement_ ->  for_statement
+     {364, 1}, // 42: statement_ ->  if_statement
+     {364, 1}, // 43: statement_ ->  while_statement
+     {364, 1}, // 44: statement_ ->  switch_statement
+     {364, 1}, // 45: statement_ ->  break_statement
+     {364, 1}, // 46: statement_ ->  continue_statement
+     {364, 1}, // 47: statement_ ->  return_statement
+     {365, 1}, // 48: expression ->  variable_declaration
+     {365, 1}, // 49: expression (_var) ->  variable
+     {365, 2}, // 50: expression (unaryMinus) ->  '-' expression
+     {365, 1}, // 51: expression (_arr) ->  array_element
+     {365, 1}, // 52: expression ->  constant_literal
+     {365, 1}, // 53: expression ->  string_literal
+     {365, 1}, // 54: expression ->  anonymous_array
+     {365, 1}, // 55: expression ->  anonymous_struct
+     {365, 1}, // 56: expression ->  function_call
+     {365, 1}, // 57: expression ->  builtin_function
+     {365, 4}, // 58: expression (SIZEOF) ->  SIZEOF '(' IDENT ')'
+     {365, 3}, // 59: expression ('=') ->  variable_declaration '=' expression
+     {365, 3}, // 60: expression ('=') ->  variable '=' expression
+     {365, 3}, // 61: expression ('=') ->  array_element '=' expression
+     {365, 3}, // 62: expression ('(') ->  '(' expression ')'
+     {365, 2}, // 63: expression (INC) ->  INC variable
+     {365, 2}, // 64: expression (DEC) ->  DEC variable
+     {365, 2}, // 65: expression (INC) ->  variable INC
+     {365, 2}, // 66: expression (DEC) ->  variable DEC
+     {365, 2}, // 67: expression (INC) ->  INC array_element
+     {365, 2}, // 68: expression (DEC) ->  DEC array_element
+     {365, 2}, // 69: expression (INC) ->  array_element INC
+     {365, 2}, // 70: expression (DEC) ->  array_element DEC
+     {365, 3}, // 71: expression (ADD) ->  variable ADD expression
+     {365, 3}, // 72: expression (ADD) ->  array_element ADD expression
+     {365, 3}, // 73: expression ('+') ->  expression '+' expression
+     {365, 3}, // 74: expression (SUB) ->  variable SUB expression
+     {365, 3}, // 75: expression (SUB) ->  array_element SUB expression
+     {365, 3}, // 76: expression ('-') ->  expression '-' expression
+     {365, 3}, // 77: expression (MUL) ->  variable MUL expression
+     {365, 3}, // 78: expression (MUL) ->  array_element MUL expression
+     {365, 3}, // 79: expression ('*') ->  expression '*' expression
+     {365, 3}, // 80: expression (DIV) ->  variable DIV expression
+     {365, 3}, // 81: expression (DIV) ->  array_element DIV expression
+     {365, 3}, // 82: expression ('/') ->  expression '/' expression
+     {365, 3}, // 83: expression (MOD) ->  variable MOD expression
+     {365, 3}, // 84: expression (MOD) ->  array_element MOD expression
+     {365, 3}, // 85: expression (DIVMOD) ->  variable DIVMOD expression
+     {365, 3}, // 86: expression (DIVMOD) ->  array_element DIVMOD expression
+     {365, 3}, // 87: expression (MODDIV) ->  variable MODDIV expression
+     {365, 3}, // 88: expression (MODDIV) ->  array_element MODDIV expression
+     {365, 3}, // 89: expression ('^') ->  expression '^' expression
+     {365, 3}, // 90: expression (POW) ->  variable POW expression
+     {365, 3}, // 91: expression (POW) ->  array_element POW expression
+     {365, 3}, // 92: expression ('%') ->  expression '%' expression
+     {365, 3}, // 93: expression ('<') ->  expression '<' expression
+     {365, 3}, // 94: expression ('>') ->  expression '>' expression
+     {365, 3}, // 95: expression (LE) ->  expression LE expression
+     {365, 3}, // 96: expression (GE) ->  expression GE expression
+     {365, 3}, // 97: expression (NE) ->  expression NE expression
+     {365, 3}, // 98: expression (EQ) ->  expression EQ expression
+     {365, 2}, // 99: expression ('!') ->  '!' expression
+     {365, 3}, // 100: expression (AND) ->  expression AND expression
+     {365, 3}, // 101: expression (OR) ->  expression OR expression
+     {365, 3}, // 102: expression ('&') ->  expression '&' expression
+     {365, 3}, // 103: expression ('|') ->  expression '|' expression
+     {365, 3}, // 104: expression (XOR) ->  expression XOR expression
+     {365, 3}, // 105: expression (SHL) ->  expression SHL expression
+     {365, 3}, // 106: expression (SHR) ->  expression SHR expression
+     {366, 4}, // 107: builtin_function (PRINT) ->  PRINT '(' expression ')'
+     {366, 3}, // 108: builtin_function (SCAN) ->  SCAN '(' ')'
+     {366, 3}, // 109: builtin_function (RAND) ->  RAND '(' ')'
+     {367, 6}, // 110: static_assert (ASSERT) ->  ASSERT '(' expression ',' STR ')'
+     {368, 1}, // 111: variable (IDENT) ->  IDENT
+     {368, 1}, // 112: variable ->  field
+     {369, 3}, // 113: field (IDENT) ->  IDENT '.' IDENT
+     {369, 3}, // 114: field ('.') ->  field '.' IDENT
+     {370, 1}, // 115: constant_literal (NUM) ->  NUM
+     {370, 1}, // 116: constant_literal (CHR) ->  CHR
+     {371, 4}, // 117: array_element ('[') ->  expression '[' expression ']'
+     {372, 1}, // 118: string_literal (STR) ->  STR
+     {373, 4}, // 119: anonymous_array ('#') ->  '#' '{' expression_list '}'
+     {373, 4}, // 120: anonymous_array ('#') ->  '#' '[' NUM ']'
+     {373, 4}, // 121: anonymous_array ('#') ->  '#' '[' IDENT ']'
+     {373, 6}, // 122: anonymous_array ('#') ->  '#' '[' NUM ',' expression ']'
+     {373, 6}, // 123: anonymous_array ('#') ->  '#' '[' IDENT ',' expression ']'
+     {374, 4}, // 124: anonymous_struct (IDENT) ->  IDENT '{' optional_expression_list '}'
+     {375, 4}, // 125: function_call (IDENT) ->  IDENT '(' optional_expression_list ')'
+     {376, 2}, // 126: break_statement (BREAK) ->  BREAK ';'
+     {377, 2}, // 127: continue_statement (CONTINUE) ->  CONTINUE ';'
+     {378, 2}, // 128: return_statement (RETURN) ->  RETURN ';'
+     {379, 9}, // 129: for_statement (FOR) ->  FOR '(' expression ';' expression ';' expression ')' statement
+     {379, 10}, // 130: for_statement (FOR) ->  FOR '*' '(' expression ';' expression ';' expression ')' statement
+     {379, 8}, // 131: for_statement (FOR) ->  FOR '(' LET parameter ':' expression ')' statement
+     {379, 9}, // 132: for_statement (FOR) ->  FOR '*' '(' LET parameter ':' expression ')' statement
+     {380, 5}, // 133: if_statement (IF) ->  IF '(' expression ')' statement
+     {380, 7}, // 134: if_statement (then) ->  IF '(' expression ')' statement ELSE statement
+     {381, 5}, // 135: while_statement (WHILE) ->  WHILE '(' expression ')' statement
+     {381, 6}, // 136: while_statement (WHILE) ->  WHILE '*' '(' expression ')' statement
+     {382, 7}, // 137: switch_statement (SWITCH) ->  SWITCH '(' expression ')' '{' case_list '}'
+     {382, 8}, // 138: switch_statement (SWITCH) ->  SWITCH '(' expression ')' '{' case_list default_case '}'
+     {383, 1}, // 139: case_list ->  switch_case
+     {383, 2}, // 140: case_list ->  case_list switch_case
+     {384, 4}, // 141: switch_case (CASE) ->  CASE expression ':' statement
+     {385, 3}, // 142: default_case (DEFAULT) ->  DEFAULT ':' statement
+     {386, 2}, // 143: variable_declaration (LET) ->  LET variable_specification
+     {387, 1}, // 144: variable_specification (IDENT) ->  IDENT
+     {387, 2}, // 145: variable_specification ('&') ->  '&' IDENT
+     {387, 3}, // 146: variable_specification ('[') ->  '[' ']' IDENT
+     {387, 4}, // 147: variable_specification ('[') ->  '[' NUM ']' IDENT
+     {387, 4}, // 148: variable_specification ('[') ->  '[' IDENT ']' IDENT
+     {387, 5}, // 149: variable_specification ('[') ->  '[' STRUCT IDENT ']' IDENT
+     {388, 1}, // 150: variable_specification_list ->  variable_specification
+     {388, 3}, // 151: variable_specification_list (',') ->  variable_specification_list ',' variable_specification
+     {389, 1}, // 152: expression_list ->  expression
+     {389, 3}, // 153: expression_list (',') ->  expression_list ',' expression
+     {390, 0}, // 154: optional_expression_list ->  <empty>
+     {390, 1}, // 155: optional_expression_list ->  expression_list
+     {355, 4}, // 156: unit_test_block (START_TEST) ->  START_TEST unit_test_label unit_test_body END_TEST
+     {391, 3}, // 157: unit_test_label ('<') ->  '<' IDENT '>'
+     {392, 1}, // 158: unit_test_body ->  unit_test_case
+     {392, 2}, // 159: unit_test_body ->  unit_test_body unit_test_case
+     {393, 3}, // 160: unit_test_case ->  unit_test_label unit_test_input unit_test_expect
+     {393, 2}, // 161: unit_test_case ->  unit_test_label unit_test_expect
+     {394, 3}, // 162: unit_test_input (INPUT) ->  INPUT unit_test_content END_TEST_CONTENT
+     {395, 3}, // 163: unit_test_expect (EXPECT) ->  EXPECT unit_test_content END_TEST_CONTENT
+     {396, 0}, // 164: unit_test_content ->  <empty>
+     {396, 2}, // 165: unit_test_content (CHR) ->  unit_test_content CHR
+     {397, 1}, // 166: program_$ ->  program
 };
 
 // State info and SR_ transitions for each state.
@@ -294,9 +305,9 @@ SR_ s_1[] =
     { {     350}, {       4} }, // global_variable_list
     { {     351}, {       5} }, // include_directive   
     { {     352}, {       6} }, // const_definition    
-    { {     353}, {       7} }, // struct_definition   
-    { {     354}, {       8} }, // unit_test_block     
-    { {     355}, {       9} }, // function_header     
+    { {     354}, {       7} }, // struct_definition   
+    { {     355}, {       8} }, // unit_test_block     
+    { {     356}, {       9} }, // function_header     
     { {     259}, {      10} }, // GLOBAL              
     { {     260}, {      11} }, // INCLUDE             
     { {     268}, {      12} }, // CONST               
@@ -353,7 +364,7 @@ SR_ s_8[] =
 SR_ s_9[] =
 {
     { { REQ_TOKEN}, {  3} },               
-    { {       357}, { 17} }, // scope_block
+    { {       358}, { 17} }, // scope_block
     { {       123}, { 18} }, // '{'        
     { {         0}, {  0} },               
 };
@@ -361,9 +372,9 @@ SR_ s_9[] =
 SR_ s_10[] =
 {
     { { REQ_TOKEN}, {  6} },                               
-    { {       387}, { 19} }, // variable_specification_list
-    { {       386}, { 20} }, // variable_specification     
-    { {       303}, { 21} }, // IDENT                      
+    { {       388}, { 19} }, // variable_specification_list
+    { {       387}, { 20} }, // variable_specification     
+    { {       306}, { 21} }, // IDENT                      
     { {        38}, { 22} }, // '&'                        
     { {        91}, { 23} }, // '['                        
     { {         0}, {  0} },                               
@@ -372,28 +383,29 @@ SR_ s_10[] =
 SR_ s_11[] =
 {
     { { REQ_TOKEN}, {  2} },       
-    { {       304}, { 24} }, // STR
+    { {       307}, { 24} }, // STR
     { {         0}, {  0} },       
 };
 
 SR_ s_12[] =
 {
-    { { REQ_TOKEN}, {  2} },         
-    { {       303}, { 25} }, // IDENT
-    { {         0}, {  0} },         
+    { { REQ_TOKEN}, {   3} },         
+    { {       306}, {  25} }, // IDENT
+    { {        91}, { 345} }, // '['  
+    { {         0}, {   0} },         
 };
 
 SR_ s_13[] =
 {
     { { REQ_TOKEN}, {  2} },         
-    { {       303}, { 26} }, // IDENT
+    { {       306}, { 26} }, // IDENT
     { {         0}, {  0} },         
 };
 
 SR_ s_14[] =
 {
     { { REQ_TOKEN}, {  3} },                   
-    { {       390}, { 27} }, // unit_test_label
+    { {       391}, { 27} }, // unit_test_label
     { {        60}, { 28} }, // '<'            
     { {         0}, {  0} },                   
 };
@@ -401,14 +413,14 @@ SR_ s_14[] =
 SR_ s_15[] =
 {
     { { REQ_TOKEN}, {  2} },         
-    { {       303}, { 29} }, // IDENT
+    { {       306}, { 29} }, // IDENT
     { {         0}, {  0} },         
 };
 
 SR_ s_16[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -16} }, 
+    { {       0}, { -22} }, 
 };
 
 SR_ s_17[] =
@@ -420,8 +432,8 @@ SR_ s_17[] =
 SR_ s_18[] =
 {
     { { DEF_RED}, {   2} },             
-    { {     361}, {  30} }, // code_body
-    { {       0}, { -27} },             
+    { {     362}, {  30} }, // code_body
+    { {       0}, { -33} },             
 };
 
 SR_ s_19[] =
@@ -435,19 +447,19 @@ SR_ s_19[] =
 SR_ s_20[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -139} }, 
+    { {       0}, { -150} }, 
 };
 
 SR_ s_21[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -133} }, 
+    { {       0}, { -144} }, 
 };
 
 SR_ s_22[] =
 {
     { { REQ_TOKEN}, {  2} },         
-    { {       303}, { 33} }, // IDENT
+    { {       306}, { 33} }, // IDENT
     { {         0}, {  0} },         
 };
 
@@ -455,8 +467,8 @@ SR_ s_23[] =
 {
     { { REQ_TOKEN}, {  5} },          
     { {        93}, { 34} }, // ']'   
-    { {       305}, { 35} }, // NUM   
-    { {       303}, { 36} }, // IDENT 
+    { {       308}, { 35} }, // NUM   
+    { {       306}, { 36} }, // IDENT 
     { {       272}, { 37} }, // STRUCT
     { {         0}, {  0} },          
 };
@@ -484,9 +496,9 @@ SR_ s_26[] =
 SR_ s_27[] =
 {
     { { REQ_TOKEN}, {  5} },                   
-    { {       391}, { 40} }, // unit_test_body 
-    { {       392}, { 41} }, // unit_test_case 
-    { {       390}, { 42} }, // unit_test_label
+    { {       392}, { 40} }, // unit_test_body 
+    { {       393}, { 41} }, // unit_test_case 
+    { {       391}, { 42} }, // unit_test_label
     { {        60}, { 28} }, // '<'            
     { {         0}, {  0} },                   
 };
@@ -494,7 +506,7 @@ SR_ s_27[] =
 SR_ s_28[] =
 {
     { { REQ_TOKEN}, {  2} },         
-    { {       303}, { 43} }, // IDENT
+    { {       306}, { 43} }, // IDENT
     { {         0}, {  0} },         
 };
 
@@ -510,34 +522,34 @@ SR_ s_30[] =
 {
     { { ERR_REQ}, { 50} },                        
     { {     125}, { 46} }, // '}'                 
-    { {     362}, { 47} }, // statement           
-    { {     363}, { 48} }, // statement_          
+    { {     363}, { 47} }, // statement           
+    { {     364}, { 48} }, // statement_          
     { { errTok_}, { 49} }, // errTok_             
     { {      59}, { 50} }, // ';'                 
-    { {     364}, { 51} }, // expression          
-    { {     366}, { 52} }, // static_assert       
-    { {     357}, { 53} }, // scope_block         
-    { {     378}, { 54} }, // for_statement       
-    { {     379}, { 55} }, // if_statement        
-    { {     380}, { 56} }, // while_statement     
-    { {     381}, { 57} }, // switch_statement    
-    { {     375}, { 58} }, // break_statement     
-    { {     376}, { 59} }, // continue_statement  
-    { {     377}, { 60} }, // return_statement    
-    { {     385}, { 61} }, // variable_declaration
-    { {     367}, { 62} }, // variable            
+    { {     365}, { 51} }, // expression          
+    { {     367}, { 52} }, // static_assert       
+    { {     358}, { 53} }, // scope_block         
+    { {     379}, { 54} }, // for_statement       
+    { {     380}, { 55} }, // if_statement        
+    { {     381}, { 56} }, // while_statement     
+    { {     382}, { 57} }, // switch_statement    
+    { {     376}, { 58} }, // break_statement     
+    { {     377}, { 59} }, // continue_statement  
+    { {     378}, { 60} }, // return_statement    
+    { {     386}, { 61} }, // variable_declaration
+    { {     368}, { 62} }, // variable            
     { {      45}, { 63} }, // '-'                 
-    { {     370}, { 64} }, // array_element       
-    { {     369}, { 65} }, // constant_literal    
-    { {     371}, { 66} }, // string_literal      
-    { {     372}, { 67} }, // anonymous_array     
-    { {     373}, { 68} }, // anonymous_struct    
-    { {     374}, { 69} }, // function_call       
-    { {     365}, { 70} }, // builtin_function    
+    { {     371}, { 64} }, // array_element       
+    { {     370}, { 65} }, // constant_literal    
+    { {     372}, { 66} }, // string_literal      
+    { {     373}, { 67} }, // anonymous_array     
+    { {     374}, { 68} }, // anonymous_struct    
+    { {     375}, { 69} }, // function_call       
+    { {     366}, { 70} }, // builtin_function    
     { {     264}, { 71} }, // SIZEOF              
     { {      40}, { 72} }, // '('                 
-    { {     301}, { 73} }, // INC                 
-    { {     302}, { 74} }, // DEC                 
+    { {     304}, { 73} }, // INC                 
+    { {     305}, { 74} }, // DEC                 
     { {      33}, { 75} }, // '!'                 
     { {     276}, { 76} }, // ASSERT              
     { {     123}, { 18} }, // '{'                 
@@ -549,11 +561,11 @@ SR_ s_30[] =
     { {     274}, { 82} }, // CONTINUE            
     { {     275}, { 83} }, // RETURN              
     { {     257}, { 84} }, // LET                 
-    { {     303}, { 85} }, // IDENT               
-    { {     368}, { 86} }, // field               
-    { {     305}, { 87} }, // NUM                 
-    { {     306}, { 88} }, // CHR                 
-    { {     304}, { 89} }, // STR                 
+    { {     306}, { 85} }, // IDENT               
+    { {     369}, { 86} }, // field               
+    { {     308}, { 87} }, // NUM                 
+    { {     309}, { 88} }, // CHR                 
+    { {     307}, { 89} }, // STR                 
     { {      35}, { 90} }, // '#'                 
     { {     262}, { 91} }, // PRINT               
     { {     261}, { 92} }, // SCAN                
@@ -564,14 +576,14 @@ SR_ s_30[] =
 SR_ s_31[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -26} }, 
+    { {       0}, { -32} }, 
 };
 
 SR_ s_32[] =
 {
     { { REQ_TOKEN}, {  5} },                          
-    { {       386}, { 94} }, // variable_specification
-    { {       303}, { 21} }, // IDENT                 
+    { {       387}, { 94} }, // variable_specification
+    { {       306}, { 21} }, // IDENT                 
     { {        38}, { 22} }, // '&'                   
     { {        91}, { 23} }, // '['                   
     { {         0}, {  0} },                          
@@ -580,13 +592,13 @@ SR_ s_32[] =
 SR_ s_33[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -134} }, 
+    { {       0}, { -145} }, 
 };
 
 SR_ s_34[] =
 {
     { { REQ_TOKEN}, {  2} },         
-    { {       303}, { 95} }, // IDENT
+    { {       306}, { 95} }, // IDENT
     { {         0}, {  0} },         
 };
 
@@ -607,25 +619,25 @@ SR_ s_36[] =
 SR_ s_37[] =
 {
     { { REQ_TOKEN}, {  2} },         
-    { {       303}, { 98} }, // IDENT
+    { {       306}, { 98} }, // IDENT
     { {         0}, {  0} },         
 };
 
 SR_ s_38[] =
 {
     { { REQ_TOKEN}, {   3} },       
-    { {       305}, {  99} }, // NUM
-    { {       306}, { 100} }, // CHR
+    { {       308}, {  99} }, // NUM
+    { {       309}, { 100} }, // CHR
     { {         0}, {   0} },       
 };
 
 SR_ s_39[] =
 {
     { { REQ_TOKEN}, {   7} },                               
-    { {       356}, { 101} }, // struct_body                
-    { {       387}, { 102} }, // variable_specification_list
-    { {       386}, {  20} }, // variable_specification     
-    { {       303}, {  21} }, // IDENT                      
+    { {       357}, { 101} }, // struct_body                
+    { {       388}, { 102} }, // variable_specification_list
+    { {       387}, {  20} }, // variable_specification     
+    { {       306}, {  21} }, // IDENT                      
     { {        38}, {  22} }, // '&'                        
     { {        91}, {  23} }, // '['                        
     { {         0}, {   0} },                               
@@ -635,8 +647,8 @@ SR_ s_40[] =
 {
     { { REQ_TOKEN}, {   5} },                   
     { {       278}, { 103} }, // END_TEST       
-    { {       392}, { 104} }, // unit_test_case 
-    { {       390}, {  42} }, // unit_test_label
+    { {       393}, { 104} }, // unit_test_case 
+    { {       391}, {  42} }, // unit_test_label
     { {        60}, {  28} }, // '<'            
     { {         0}, {   0} },                   
 };
@@ -644,14 +656,14 @@ SR_ s_40[] =
 SR_ s_41[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -147} }, 
+    { {       0}, { -158} }, 
 };
 
 SR_ s_42[] =
 {
     { { REQ_TOKEN}, {   5} },                    
-    { {       393}, { 105} }, // unit_test_input 
-    { {       394}, { 106} }, // unit_test_expect
+    { {       394}, { 105} }, // unit_test_input 
+    { {       395}, { 106} }, // unit_test_expect
     { {       279}, { 107} }, // INPUT           
     { {       280}, { 108} }, // EXPECT          
     { {         0}, {   0} },                    
@@ -667,37 +679,37 @@ SR_ s_43[] =
 SR_ s_44[] =
 {
     { { REQ_DEF}, {   6} },                           
-    { {     360}, { 110} }, // optional_parameter_list
-    { {     359}, { 111} }, // parameter_list         
-    { {     358}, { 112} }, // parameter              
-    { {     303}, { 113} }, // IDENT                  
+    { {     361}, { 110} }, // optional_parameter_list
+    { {     360}, { 111} }, // parameter_list         
+    { {     359}, { 112} }, // parameter              
+    { {     306}, { 113} }, // IDENT                  
     { {      38}, { 114} }, // '&'                    
-    { {       0}, { -25} },                           
+    { {       0}, { -31} },                           
 };
 
 SR_ s_45[] =
 {
     { { REQ_TOKEN}, {   2} },         
-    { {       303}, { 115} }, // IDENT
+    { {       306}, { 115} }, // IDENT
     { {         0}, {   0} },         
 };
 
 SR_ s_46[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -19} }, 
+    { {       0}, { -25} }, 
 };
 
 SR_ s_47[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -28} }, 
+    { {       0}, { -34} }, 
 };
 
 SR_ s_48[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -29} }, 
+    { {       0}, { -35} }, 
 };
 
 SR_ s_49[] =
@@ -710,12 +722,12 @@ SR_ s_49[] =
 SR_ s_50[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -31} }, 
+    { {       0}, { -37} }, 
 };
 
 SR_ s_51[] =
 {
-    { { REQ_TOKEN}, {  17} },       
+    { { REQ_TOKEN}, {  22} },       
     { {        59}, { 117} }, // ';'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
@@ -725,120 +737,125 @@ SR_ s_51[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
 SR_ s_52[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        59}, { 133} }, // ';'
+    { {        59}, { 138} }, // ';'
     { {         0}, {   0} },       
 };
 
 SR_ s_53[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -34} }, 
+    { {       0}, { -40} }, 
 };
 
 SR_ s_54[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -35} }, 
+    { {       0}, { -41} }, 
 };
 
 SR_ s_55[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -36} }, 
+    { {       0}, { -42} }, 
 };
 
 SR_ s_56[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -37} }, 
+    { {       0}, { -43} }, 
 };
 
 SR_ s_57[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -38} }, 
+    { {       0}, { -44} }, 
 };
 
 SR_ s_58[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -39} }, 
+    { {       0}, { -45} }, 
 };
 
 SR_ s_59[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -40} }, 
+    { {       0}, { -46} }, 
 };
 
 SR_ s_60[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -41} }, 
+    { {       0}, { -47} }, 
 };
 
 SR_ s_61[] =
 {
     { { REQ_DEF}, {   2} },       
-    { {      61}, { 134} }, // '='
-    { {       0}, { -42} },       
+    { {      61}, { 139} }, // '='
+    { {       0}, { -48} },       
 };
 
 SR_ s_62[] =
 {
     { { REQ_DEF}, {  12} },          
-    { {      61}, { 135} }, // '='   
-    { {     301}, { 136} }, // INC   
-    { {     302}, { 137} }, // DEC   
-    { {     286}, { 138} }, // ADD   
-    { {     287}, { 139} }, // SUB   
-    { {     288}, { 140} }, // MUL   
-    { {     290}, { 141} }, // DIV   
-    { {     289}, { 142} }, // MOD   
-    { {     291}, { 143} }, // DIVMOD
-    { {     292}, { 144} }, // MODDIV
-    { {     293}, { 145} }, // POW   
-    { {       0}, { -43} },          
+    { {      61}, { 140} }, // '='   
+    { {     304}, { 141} }, // INC   
+    { {     305}, { 142} }, // DEC   
+    { {     286}, { 143} }, // ADD   
+    { {     287}, { 144} }, // SUB   
+    { {     288}, { 145} }, // MUL   
+    { {     290}, { 146} }, // DIV   
+    { {     289}, { 147} }, // MOD   
+    { {     291}, { 148} }, // DIVMOD
+    { {     292}, { 149} }, // MODDIV
+    { {     293}, { 150} }, // POW   
+    { {       0}, { -49} },          
 };
 
 SR_ s_63[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 146} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 151} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -849,88 +866,88 @@ SR_ s_63[] =
 SR_ s_64[] =
 {
     { { REQ_DEF}, {  12} },          
-    { {      61}, { 147} }, // '='   
-    { {     301}, { 148} }, // INC   
-    { {     302}, { 149} }, // DEC   
-    { {     286}, { 150} }, // ADD   
-    { {     287}, { 151} }, // SUB   
-    { {     288}, { 152} }, // MUL   
-    { {     290}, { 153} }, // DIV   
-    { {     289}, { 154} }, // MOD   
-    { {     291}, { 155} }, // DIVMOD
-    { {     292}, { 156} }, // MODDIV
-    { {     293}, { 157} }, // POW   
-    { {       0}, { -45} },          
+    { {      61}, { 152} }, // '='   
+    { {     304}, { 153} }, // INC   
+    { {     305}, { 154} }, // DEC   
+    { {     286}, { 155} }, // ADD   
+    { {     287}, { 156} }, // SUB   
+    { {     288}, { 157} }, // MUL   
+    { {     290}, { 158} }, // DIV   
+    { {     289}, { 159} }, // MOD   
+    { {     291}, { 160} }, // DIVMOD
+    { {     292}, { 161} }, // MODDIV
+    { {     293}, { 162} }, // POW   
+    { {       0}, { -51} },          
 };
 
 SR_ s_65[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -46} }, 
+    { {       0}, { -52} }, 
 };
 
 SR_ s_66[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -47} }, 
+    { {       0}, { -53} }, 
 };
 
 SR_ s_67[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -48} }, 
+    { {       0}, { -54} }, 
 };
 
 SR_ s_68[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -49} }, 
+    { {       0}, { -55} }, 
 };
 
 SR_ s_69[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -50} }, 
+    { {       0}, { -56} }, 
 };
 
 SR_ s_70[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -51} }, 
+    { {       0}, { -57} }, 
 };
 
 SR_ s_71[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        40}, { 158} }, // '('
+    { {        40}, { 163} }, // '('
     { {         0}, {   0} },       
 };
 
 SR_ s_72[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 159} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 164} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -941,28 +958,28 @@ SR_ s_72[] =
 SR_ s_73[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       367}, { 160} }, // variable            
-    { {       370}, { 161} }, // array_element       
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       364}, { 162} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
+    { {       368}, { 165} }, // variable            
+    { {       371}, { 166} }, // array_element       
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       365}, { 167} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
     { {        45}, {  63} }, // '-'                 
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -973,28 +990,28 @@ SR_ s_73[] =
 SR_ s_74[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       367}, { 163} }, // variable            
-    { {       370}, { 164} }, // array_element       
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       364}, { 162} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
+    { {       368}, { 168} }, // variable            
+    { {       371}, { 169} }, // array_element       
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       365}, { 167} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
     { {        45}, {  63} }, // '-'                 
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1005,28 +1022,28 @@ SR_ s_74[] =
 SR_ s_75[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 165} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 170} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1037,66 +1054,66 @@ SR_ s_75[] =
 SR_ s_76[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        40}, { 166} }, // '('
+    { {        40}, { 171} }, // '('
     { {         0}, {   0} },       
 };
 
 SR_ s_77[] =
 {
     { { REQ_TOKEN}, {   3} },       
-    { {        40}, { 167} }, // '('
-    { {        42}, { 168} }, // '*'
+    { {        40}, { 172} }, // '('
+    { {        42}, { 173} }, // '*'
     { {         0}, {   0} },       
 };
 
 SR_ s_78[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        40}, { 169} }, // '('
+    { {        40}, { 174} }, // '('
     { {         0}, {   0} },       
 };
 
 SR_ s_79[] =
 {
     { { REQ_TOKEN}, {   3} },       
-    { {        40}, { 170} }, // '('
-    { {        42}, { 171} }, // '*'
+    { {        40}, { 175} }, // '('
+    { {        42}, { 176} }, // '*'
     { {         0}, {   0} },       
 };
 
 SR_ s_80[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        40}, { 172} }, // '('
+    { {        40}, { 177} }, // '('
     { {         0}, {   0} },       
 };
 
 SR_ s_81[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        59}, { 173} }, // ';'
+    { {        59}, { 178} }, // ';'
     { {         0}, {   0} },       
 };
 
 SR_ s_82[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        59}, { 174} }, // ';'
+    { {        59}, { 179} }, // ';'
     { {         0}, {   0} },       
 };
 
 SR_ s_83[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        59}, { 175} }, // ';'
+    { {        59}, { 180} }, // ';'
     { {         0}, {   0} },       
 };
 
 SR_ s_84[] =
 {
     { { REQ_TOKEN}, {   5} },                          
-    { {       386}, { 176} }, // variable_specification
-    { {       303}, {  21} }, // IDENT                 
+    { {       387}, { 181} }, // variable_specification
+    { {       306}, {  21} }, // IDENT                 
     { {        38}, {  22} }, // '&'                   
     { {        91}, {  23} }, // '['                   
     { {         0}, {   0} },                          
@@ -1105,120 +1122,120 @@ SR_ s_84[] =
 SR_ s_85[] =
 {
     { { REQ_DEF}, {    4} },       
-    { {     123}, {  177} }, // '{'
-    { {      40}, {  178} }, // '('
-    { {      46}, {  179} }, // '.'
-    { {       0}, { -100} },       
+    { {     123}, {  182} }, // '{'
+    { {      40}, {  183} }, // '('
+    { {      46}, {  184} }, // '.'
+    { {       0}, { -111} },       
 };
 
 SR_ s_86[] =
 {
     { { REQ_DEF}, {    2} },       
-    { {      46}, {  180} }, // '.'
-    { {       0}, { -101} },       
+    { {      46}, {  185} }, // '.'
+    { {       0}, { -112} },       
 };
 
 SR_ s_87[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -104} }, 
+    { {       0}, { -115} }, 
 };
 
 SR_ s_88[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -105} }, 
+    { {       0}, { -116} }, 
 };
 
 SR_ s_89[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -107} }, 
+    { {       0}, { -118} }, 
 };
 
 SR_ s_90[] =
 {
     { { REQ_TOKEN}, {   3} },       
-    { {       123}, { 181} }, // '{'
-    { {        91}, { 182} }, // '['
+    { {       123}, { 186} }, // '{'
+    { {        91}, { 187} }, // '['
     { {         0}, {   0} },       
 };
 
 SR_ s_91[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        40}, { 183} }, // '('
+    { {        40}, { 188} }, // '('
     { {         0}, {   0} },       
 };
 
 SR_ s_92[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        40}, { 184} }, // '('
+    { {        40}, { 189} }, // '('
     { {         0}, {   0} },       
 };
 
 SR_ s_93[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        40}, { 185} }, // '('
+    { {        40}, { 190} }, // '('
     { {         0}, {   0} },       
 };
 
 SR_ s_94[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -140} }, 
+    { {       0}, { -151} }, 
 };
 
 SR_ s_95[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -135} }, 
+    { {       0}, { -146} }, 
 };
 
 SR_ s_96[] =
 {
     { { REQ_TOKEN}, {   2} },         
-    { {       303}, { 186} }, // IDENT
+    { {       306}, { 191} }, // IDENT
     { {         0}, {   0} },         
 };
 
 SR_ s_97[] =
 {
     { { REQ_TOKEN}, {   2} },         
-    { {       303}, { 187} }, // IDENT
+    { {       306}, { 192} }, // IDENT
     { {         0}, {   0} },         
 };
 
 SR_ s_98[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        93}, { 188} }, // ']'
+    { {        93}, { 193} }, // ']'
     { {         0}, {   0} },       
 };
 
 SR_ s_99[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        59}, { 189} }, // ';'
+    { {        59}, { 194} }, // ';'
     { {         0}, {   0} },       
 };
 
 SR_ s_100[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        59}, { 190} }, // ';'
+    { {        59}, { 195} }, // ';'
     { {         0}, {   0} },       
 };
 
 SR_ s_101[] =
 {
     { { REQ_TOKEN}, {   7} },                               
-    { {       125}, { 191} }, // '}'                        
-    { {       387}, { 192} }, // variable_specification_list
-    { {       386}, {  20} }, // variable_specification     
-    { {       303}, {  21} }, // IDENT                      
+    { {       125}, { 196} }, // '}'                        
+    { {       388}, { 197} }, // variable_specification_list
+    { {       387}, {  20} }, // variable_specification     
+    { {       306}, {  21} }, // IDENT                      
     { {        38}, {  22} }, // '&'                        
     { {        91}, {  23} }, // '['                        
     { {         0}, {   0} },                               
@@ -1227,7 +1244,7 @@ SR_ s_101[] =
 SR_ s_102[] =
 {
     { { REQ_TOKEN}, {   3} },       
-    { {        59}, { 193} }, // ';'
+    { {        59}, { 198} }, // ';'
     { {        44}, {  32} }, // ','
     { {         0}, {   0} },       
 };
@@ -1235,19 +1252,19 @@ SR_ s_102[] =
 SR_ s_103[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -145} }, 
+    { {       0}, { -156} }, 
 };
 
 SR_ s_104[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -148} }, 
+    { {       0}, { -159} }, 
 };
 
 SR_ s_105[] =
 {
     { { REQ_TOKEN}, {   3} },                    
-    { {       394}, { 194} }, // unit_test_expect
+    { {       395}, { 199} }, // unit_test_expect
     { {       280}, { 108} }, // EXPECT          
     { {         0}, {   0} },                    
 };
@@ -1255,106 +1272,106 @@ SR_ s_105[] =
 SR_ s_106[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -150} }, 
+    { {       0}, { -161} }, 
 };
 
 SR_ s_107[] =
 {
     { { DEF_RED}, {    2} },                     
-    { {     395}, {  195} }, // unit_test_content
-    { {       0}, { -153} },                     
+    { {     396}, {  200} }, // unit_test_content
+    { {       0}, { -164} },                     
 };
 
 SR_ s_108[] =
 {
     { { DEF_RED}, {    2} },                     
-    { {     395}, {  196} }, // unit_test_content
-    { {       0}, { -153} },                     
+    { {     396}, {  201} }, // unit_test_content
+    { {       0}, { -164} },                     
 };
 
 SR_ s_109[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -146} }, 
+    { {       0}, { -157} }, 
 };
 
 SR_ s_110[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        41}, { 197} }, // ')'
+    { {        41}, { 202} }, // ')'
     { {         0}, {   0} },       
 };
 
 SR_ s_111[] =
 {
     { { REQ_DEF}, {   2} },       
-    { {      44}, { 198} }, // ','
-    { {       0}, { -24} },       
+    { {      44}, { 203} }, // ','
+    { {       0}, { -30} },       
 };
 
 SR_ s_112[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -22} }, 
+    { {       0}, { -28} }, 
 };
 
 SR_ s_113[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -20} }, 
+    { {       0}, { -26} }, 
 };
 
 SR_ s_114[] =
 {
     { { REQ_TOKEN}, {   2} },         
-    { {       303}, { 199} }, // IDENT
+    { {       306}, { 204} }, // IDENT
     { {         0}, {   0} },         
 };
 
 SR_ s_115[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        40}, { 200} }, // '('
+    { {        40}, { 205} }, // '('
     { {         0}, {   0} },       
 };
 
 SR_ s_116[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -30} }, 
+    { {       0}, { -36} }, 
 };
 
 SR_ s_117[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -32} }, 
+    { {       0}, { -38} }, 
 };
 
 SR_ s_118[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 201} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 206} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1365,28 +1382,28 @@ SR_ s_118[] =
 SR_ s_119[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 202} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 207} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1397,28 +1414,28 @@ SR_ s_119[] =
 SR_ s_120[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 203} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 208} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1429,28 +1446,28 @@ SR_ s_120[] =
 SR_ s_121[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 204} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 209} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1461,28 +1478,28 @@ SR_ s_121[] =
 SR_ s_122[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 205} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 210} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1493,28 +1510,28 @@ SR_ s_122[] =
 SR_ s_123[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 206} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 211} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1525,28 +1542,28 @@ SR_ s_123[] =
 SR_ s_124[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 207} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 212} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1557,28 +1574,28 @@ SR_ s_124[] =
 SR_ s_125[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 208} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 213} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1589,28 +1606,28 @@ SR_ s_125[] =
 SR_ s_126[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 209} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 214} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1621,28 +1638,28 @@ SR_ s_126[] =
 SR_ s_127[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 210} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 215} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1653,28 +1670,28 @@ SR_ s_127[] =
 SR_ s_128[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 211} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 216} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1685,28 +1702,28 @@ SR_ s_128[] =
 SR_ s_129[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 212} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 217} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1717,28 +1734,28 @@ SR_ s_129[] =
 SR_ s_130[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 213} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 218} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1749,28 +1766,28 @@ SR_ s_130[] =
 SR_ s_131[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 214} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 219} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1781,28 +1798,28 @@ SR_ s_131[] =
 SR_ s_132[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 215} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 220} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1812,35 +1829,61 @@ SR_ s_132[] =
 
 SR_ s_133[] =
 {
-    { { DEF_RED}, {   1} }, 
-    { {       0}, { -33} }, 
+    { { REQ_TOKEN}, {  27} },                        
+    { {       365}, { 221} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
+    { {        45}, {  63} }, // '-'                 
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
+    { {       264}, {  71} }, // SIZEOF              
+    { {        40}, {  72} }, // '('                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
+    { {        33}, {  75} }, // '!'                 
+    { {       257}, {  84} }, // LET                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
+    { {        35}, {  90} }, // '#'                 
+    { {       262}, {  91} }, // PRINT               
+    { {       261}, {  92} }, // SCAN                
+    { {       263}, {  93} }, // RAND                
+    { {         0}, {   0} },                        
 };
 
 SR_ s_134[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 216} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 222} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1851,28 +1894,28 @@ SR_ s_134[] =
 SR_ s_135[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 217} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 223} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1882,41 +1925,99 @@ SR_ s_135[] =
 
 SR_ s_136[] =
 {
-    { { DEF_RED}, {   1} }, 
-    { {       0}, { -59} }, 
+    { { REQ_TOKEN}, {  27} },                        
+    { {       365}, { 224} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
+    { {        45}, {  63} }, // '-'                 
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
+    { {       264}, {  71} }, // SIZEOF              
+    { {        40}, {  72} }, // '('                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
+    { {        33}, {  75} }, // '!'                 
+    { {       257}, {  84} }, // LET                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
+    { {        35}, {  90} }, // '#'                 
+    { {       262}, {  91} }, // PRINT               
+    { {       261}, {  92} }, // SCAN                
+    { {       263}, {  93} }, // RAND                
+    { {         0}, {   0} },                        
 };
 
 SR_ s_137[] =
 {
-    { { DEF_RED}, {   1} }, 
-    { {       0}, { -60} }, 
+    { { REQ_TOKEN}, {  27} },                        
+    { {       365}, { 225} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
+    { {        45}, {  63} }, // '-'                 
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
+    { {       264}, {  71} }, // SIZEOF              
+    { {        40}, {  72} }, // '('                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
+    { {        33}, {  75} }, // '!'                 
+    { {       257}, {  84} }, // LET                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
+    { {        35}, {  90} }, // '#'                 
+    { {       262}, {  91} }, // PRINT               
+    { {       261}, {  92} }, // SCAN                
+    { {       263}, {  93} }, // RAND                
+    { {         0}, {   0} },                        
 };
 
 SR_ s_138[] =
+{
+    { { DEF_RED}, {   1} }, 
+    { {       0}, { -39} }, 
+};
+
+SR_ s_139[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 218} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 226} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1924,31 +2025,31 @@ SR_ s_138[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_139[] =
+SR_ s_140[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 219} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 227} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1956,31 +2057,43 @@ SR_ s_139[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_140[] =
+SR_ s_141[] =
+{
+    { { DEF_RED}, {   1} }, 
+    { {       0}, { -65} }, 
+};
+
+SR_ s_142[] =
+{
+    { { DEF_RED}, {   1} }, 
+    { {       0}, { -66} }, 
+};
+
+SR_ s_143[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 220} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 228} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -1988,31 +2101,31 @@ SR_ s_140[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_141[] =
+SR_ s_144[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 221} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 229} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2020,31 +2133,31 @@ SR_ s_141[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_142[] =
+SR_ s_145[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 222} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 230} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2052,31 +2165,31 @@ SR_ s_142[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_143[] =
+SR_ s_146[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 223} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 231} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2084,31 +2197,31 @@ SR_ s_143[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_144[] =
+SR_ s_147[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 224} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 232} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2116,31 +2229,31 @@ SR_ s_144[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_145[] =
+SR_ s_148[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 225} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 233} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2148,38 +2261,102 @@ SR_ s_145[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_146[] =
+SR_ s_149[] =
+{
+    { { REQ_TOKEN}, {  27} },                        
+    { {       365}, { 234} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
+    { {        45}, {  63} }, // '-'                 
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
+    { {       264}, {  71} }, // SIZEOF              
+    { {        40}, {  72} }, // '('                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
+    { {        33}, {  75} }, // '!'                 
+    { {       257}, {  84} }, // LET                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
+    { {        35}, {  90} }, // '#'                 
+    { {       262}, {  91} }, // PRINT               
+    { {       261}, {  92} }, // SCAN                
+    { {       263}, {  93} }, // RAND                
+    { {         0}, {   0} },                        
+};
+
+SR_ s_150[] =
+{
+    { { REQ_TOKEN}, {  27} },                        
+    { {       365}, { 235} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
+    { {        45}, {  63} }, // '-'                 
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
+    { {       264}, {  71} }, // SIZEOF              
+    { {        40}, {  72} }, // '('                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
+    { {        33}, {  75} }, // '!'                 
+    { {       257}, {  84} }, // LET                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
+    { {        35}, {  90} }, // '#'                 
+    { {       262}, {  91} }, // PRINT               
+    { {       261}, {  92} }, // SCAN                
+    { {       263}, {  93} }, // RAND                
+    { {         0}, {   0} },                        
+};
+
+SR_ s_151[] =
 {
     { { REQ_DEF}, {   2} },       
-    { {      91}, { 132} }, // '['
-    { {       0}, { -44} },       
+    { {      91}, { 137} }, // '['
+    { {       0}, { -50} },       
 };
 
-SR_ s_147[] =
+SR_ s_152[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 226} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 236} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2187,43 +2364,43 @@ SR_ s_147[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_148[] =
+SR_ s_153[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -63} }, 
+    { {       0}, { -69} }, 
 };
 
-SR_ s_149[] =
+SR_ s_154[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -64} }, 
+    { {       0}, { -70} }, 
 };
 
-SR_ s_150[] =
+SR_ s_155[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 227} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 237} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2231,31 +2408,31 @@ SR_ s_150[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_151[] =
+SR_ s_156[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 228} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 238} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2263,31 +2440,31 @@ SR_ s_151[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_152[] =
+SR_ s_157[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 229} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 239} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2295,31 +2472,31 @@ SR_ s_152[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_153[] =
+SR_ s_158[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 230} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 240} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2327,31 +2504,31 @@ SR_ s_153[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_154[] =
+SR_ s_159[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 231} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 241} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2359,31 +2536,31 @@ SR_ s_154[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_155[] =
+SR_ s_160[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 232} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 242} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2391,31 +2568,31 @@ SR_ s_155[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_156[] =
+SR_ s_161[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 233} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 243} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2423,31 +2600,31 @@ SR_ s_156[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_157[] =
+SR_ s_162[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 234} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 244} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2455,17 +2632,17 @@ SR_ s_157[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_158[] =
+SR_ s_163[] =
 {
     { { REQ_TOKEN}, {   2} },         
-    { {       303}, { 235} }, // IDENT
+    { {       306}, { 245} }, // IDENT
     { {         0}, {   0} },         
 };
 
-SR_ s_159[] =
+SR_ s_164[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        41}, { 236} }, // ')'
+    { { REQ_TOKEN}, {  22} },       
+    { {        41}, { 246} }, // ')'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -2474,54 +2651,59 @@ SR_ s_159[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_160[] =
+SR_ s_165[] =
 {
     { { REQ_DEF}, {  12} },          
-    { {      61}, { 135} }, // '='   
-    { {     301}, { 136} }, // INC   
-    { {     302}, { 137} }, // DEC   
-    { {     286}, { 138} }, // ADD   
-    { {     287}, { 139} }, // SUB   
-    { {     288}, { 140} }, // MUL   
-    { {     290}, { 141} }, // DIV   
-    { {     289}, { 142} }, // MOD   
-    { {     291}, { 143} }, // DIVMOD
-    { {     292}, { 144} }, // MODDIV
-    { {     293}, { 145} }, // POW   
-    { {       0}, { -57} },          
+    { {      61}, { 140} }, // '='   
+    { {     304}, { 141} }, // INC   
+    { {     305}, { 142} }, // DEC   
+    { {     286}, { 143} }, // ADD   
+    { {     287}, { 144} }, // SUB   
+    { {     288}, { 145} }, // MUL   
+    { {     290}, { 146} }, // DIV   
+    { {     289}, { 147} }, // MOD   
+    { {     291}, { 148} }, // DIVMOD
+    { {     292}, { 149} }, // MODDIV
+    { {     293}, { 150} }, // POW   
+    { {       0}, { -63} },          
 };
 
-SR_ s_161[] =
+SR_ s_166[] =
 {
     { { REQ_DEF}, {  12} },          
-    { {      61}, { 147} }, // '='   
-    { {     301}, { 148} }, // INC   
-    { {     302}, { 149} }, // DEC   
-    { {     286}, { 150} }, // ADD   
-    { {     287}, { 151} }, // SUB   
-    { {     288}, { 152} }, // MUL   
-    { {     290}, { 153} }, // DIV   
-    { {     289}, { 154} }, // MOD   
-    { {     291}, { 155} }, // DIVMOD
-    { {     292}, { 156} }, // MODDIV
-    { {     293}, { 157} }, // POW   
-    { {       0}, { -61} },          
+    { {      61}, { 152} }, // '='   
+    { {     304}, { 153} }, // INC   
+    { {     305}, { 154} }, // DEC   
+    { {     286}, { 155} }, // ADD   
+    { {     287}, { 156} }, // SUB   
+    { {     288}, { 157} }, // MUL   
+    { {     290}, { 158} }, // DIV   
+    { {     289}, { 159} }, // MOD   
+    { {     291}, { 160} }, // DIVMOD
+    { {     292}, { 161} }, // MODDIV
+    { {     293}, { 162} }, // POW   
+    { {       0}, { -67} },          
 };
 
-SR_ s_162[] =
+SR_ s_167[] =
 {
-    { { REQ_TOKEN}, {  16} },       
-    { {        91}, { 132} }, // '['
+    { { REQ_TOKEN}, {  21} },       
+    { {        91}, { 137} }, // '['
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -2530,81 +2712,86 @@ SR_ s_162[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
     { {         0}, {   0} },       
 };
 
-SR_ s_163[] =
+SR_ s_168[] =
 {
     { { REQ_DEF}, {  12} },          
-    { {      61}, { 135} }, // '='   
-    { {     301}, { 136} }, // INC   
-    { {     302}, { 137} }, // DEC   
-    { {     286}, { 138} }, // ADD   
-    { {     287}, { 139} }, // SUB   
-    { {     288}, { 140} }, // MUL   
-    { {     290}, { 141} }, // DIV   
-    { {     289}, { 142} }, // MOD   
-    { {     291}, { 143} }, // DIVMOD
-    { {     292}, { 144} }, // MODDIV
-    { {     293}, { 145} }, // POW   
-    { {       0}, { -58} },          
+    { {      61}, { 140} }, // '='   
+    { {     304}, { 141} }, // INC   
+    { {     305}, { 142} }, // DEC   
+    { {     286}, { 143} }, // ADD   
+    { {     287}, { 144} }, // SUB   
+    { {     288}, { 145} }, // MUL   
+    { {     290}, { 146} }, // DIV   
+    { {     289}, { 147} }, // MOD   
+    { {     291}, { 148} }, // DIVMOD
+    { {     292}, { 149} }, // MODDIV
+    { {     293}, { 150} }, // POW   
+    { {       0}, { -64} },          
 };
 
-SR_ s_164[] =
+SR_ s_169[] =
 {
     { { REQ_DEF}, {  12} },          
-    { {      61}, { 147} }, // '='   
-    { {     301}, { 148} }, // INC   
-    { {     302}, { 149} }, // DEC   
-    { {     286}, { 150} }, // ADD   
-    { {     287}, { 151} }, // SUB   
-    { {     288}, { 152} }, // MUL   
-    { {     290}, { 153} }, // DIV   
-    { {     289}, { 154} }, // MOD   
-    { {     291}, { 155} }, // DIVMOD
-    { {     292}, { 156} }, // MODDIV
-    { {     293}, { 157} }, // POW   
-    { {       0}, { -62} },          
+    { {      61}, { 152} }, // '='   
+    { {     304}, { 153} }, // INC   
+    { {     305}, { 154} }, // DEC   
+    { {     286}, { 155} }, // ADD   
+    { {     287}, { 156} }, // SUB   
+    { {     288}, { 157} }, // MUL   
+    { {     290}, { 158} }, // DIV   
+    { {     289}, { 159} }, // MOD   
+    { {     291}, { 160} }, // DIVMOD
+    { {     292}, { 161} }, // MODDIV
+    { {     293}, { 162} }, // POW   
+    { {       0}, { -68} },          
 };
 
-SR_ s_165[] =
+SR_ s_170[] =
 {
     { { REQ_DEF}, {   2} },       
-    { {      91}, { 132} }, // '['
-    { {       0}, { -93} },       
+    { {      91}, { 137} }, // '['
+    { {       0}, { -99} },       
 };
 
-SR_ s_166[] =
+SR_ s_171[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 237} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 247} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2612,31 +2799,31 @@ SR_ s_166[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_167[] =
+SR_ s_172[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 238} }, // expression          
-    { {       257}, { 239} }, // LET                 
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 248} }, // expression          
+    { {       257}, { 249} }, // LET                 
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2644,38 +2831,38 @@ SR_ s_167[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_168[] =
+SR_ s_173[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        40}, { 240} }, // '('
+    { {        40}, { 250} }, // '('
     { {         0}, {   0} },       
 };
 
-SR_ s_169[] =
+SR_ s_174[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 241} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 251} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2683,31 +2870,31 @@ SR_ s_169[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_170[] =
+SR_ s_175[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 242} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 252} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2715,38 +2902,38 @@ SR_ s_170[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_171[] =
+SR_ s_176[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        40}, { 243} }, // '('
+    { {        40}, { 253} }, // '('
     { {         0}, {   0} },       
 };
 
-SR_ s_172[] =
+SR_ s_177[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 244} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 254} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2754,138 +2941,138 @@ SR_ s_172[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_173[] =
+SR_ s_178[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -115} }, 
+    { {       0}, { -126} }, 
 };
 
-SR_ s_174[] =
+SR_ s_179[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -116} }, 
+    { {       0}, { -127} }, 
 };
 
-SR_ s_175[] =
+SR_ s_180[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -117} }, 
+    { {       0}, { -128} }, 
 };
 
-SR_ s_176[] =
+SR_ s_181[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -132} }, 
+    { {       0}, { -143} }, 
 };
 
-SR_ s_177[] =
+SR_ s_182[] =
 {
     { { REQ_DEF}, {   29} },                            
-    { {     389}, {  245} }, // optional_expression_list
-    { {     388}, {  246} }, // expression_list         
-    { {     364}, {  247} }, // expression              
-    { {     385}, {   61} }, // variable_declaration    
-    { {     367}, {   62} }, // variable                
+    { {     390}, {  255} }, // optional_expression_list
+    { {     389}, {  256} }, // expression_list         
+    { {     365}, {  257} }, // expression              
+    { {     386}, {   61} }, // variable_declaration    
+    { {     368}, {   62} }, // variable                
     { {      45}, {   63} }, // '-'                     
-    { {     370}, {   64} }, // array_element           
-    { {     369}, {   65} }, // constant_literal        
-    { {     371}, {   66} }, // string_literal          
-    { {     372}, {   67} }, // anonymous_array         
-    { {     373}, {   68} }, // anonymous_struct        
-    { {     374}, {   69} }, // function_call           
-    { {     365}, {   70} }, // builtin_function        
+    { {     371}, {   64} }, // array_element           
+    { {     370}, {   65} }, // constant_literal        
+    { {     372}, {   66} }, // string_literal          
+    { {     373}, {   67} }, // anonymous_array         
+    { {     374}, {   68} }, // anonymous_struct        
+    { {     375}, {   69} }, // function_call           
+    { {     366}, {   70} }, // builtin_function        
     { {     264}, {   71} }, // SIZEOF                  
     { {      40}, {   72} }, // '('                     
-    { {     301}, {   73} }, // INC                     
-    { {     302}, {   74} }, // DEC                     
+    { {     304}, {   73} }, // INC                     
+    { {     305}, {   74} }, // DEC                     
     { {      33}, {   75} }, // '!'                     
     { {     257}, {   84} }, // LET                     
-    { {     303}, {   85} }, // IDENT                   
-    { {     368}, {   86} }, // field                   
-    { {     305}, {   87} }, // NUM                     
-    { {     306}, {   88} }, // CHR                     
-    { {     304}, {   89} }, // STR                     
+    { {     306}, {   85} }, // IDENT                   
+    { {     369}, {   86} }, // field                   
+    { {     308}, {   87} }, // NUM                     
+    { {     309}, {   88} }, // CHR                     
+    { {     307}, {   89} }, // STR                     
     { {      35}, {   90} }, // '#'                     
     { {     262}, {   91} }, // PRINT                   
     { {     261}, {   92} }, // SCAN                    
     { {     263}, {   93} }, // RAND                    
-    { {       0}, { -143} },                            
+    { {       0}, { -154} },                            
 };
 
-SR_ s_178[] =
+SR_ s_183[] =
 {
     { { REQ_DEF}, {   29} },                            
-    { {     389}, {  248} }, // optional_expression_list
-    { {     388}, {  246} }, // expression_list         
-    { {     364}, {  247} }, // expression              
-    { {     385}, {   61} }, // variable_declaration    
-    { {     367}, {   62} }, // variable                
+    { {     390}, {  258} }, // optional_expression_list
+    { {     389}, {  256} }, // expression_list         
+    { {     365}, {  257} }, // expression              
+    { {     386}, {   61} }, // variable_declaration    
+    { {     368}, {   62} }, // variable                
     { {      45}, {   63} }, // '-'                     
-    { {     370}, {   64} }, // array_element           
-    { {     369}, {   65} }, // constant_literal        
-    { {     371}, {   66} }, // string_literal          
-    { {     372}, {   67} }, // anonymous_array         
-    { {     373}, {   68} }, // anonymous_struct        
-    { {     374}, {   69} }, // function_call           
-    { {     365}, {   70} }, // builtin_function        
+    { {     371}, {   64} }, // array_element           
+    { {     370}, {   65} }, // constant_literal        
+    { {     372}, {   66} }, // string_literal          
+    { {     373}, {   67} }, // anonymous_array         
+    { {     374}, {   68} }, // anonymous_struct        
+    { {     375}, {   69} }, // function_call           
+    { {     366}, {   70} }, // builtin_function        
     { {     264}, {   71} }, // SIZEOF                  
     { {      40}, {   72} }, // '('                     
-    { {     301}, {   73} }, // INC                     
-    { {     302}, {   74} }, // DEC                     
+    { {     304}, {   73} }, // INC                     
+    { {     305}, {   74} }, // DEC                     
     { {      33}, {   75} }, // '!'                     
     { {     257}, {   84} }, // LET                     
-    { {     303}, {   85} }, // IDENT                   
-    { {     368}, {   86} }, // field                   
-    { {     305}, {   87} }, // NUM                     
-    { {     306}, {   88} }, // CHR                     
-    { {     304}, {   89} }, // STR                     
+    { {     306}, {   85} }, // IDENT                   
+    { {     369}, {   86} }, // field                   
+    { {     308}, {   87} }, // NUM                     
+    { {     309}, {   88} }, // CHR                     
+    { {     307}, {   89} }, // STR                     
     { {      35}, {   90} }, // '#'                     
     { {     262}, {   91} }, // PRINT                   
     { {     261}, {   92} }, // SCAN                    
     { {     263}, {   93} }, // RAND                    
-    { {       0}, { -143} },                            
+    { {       0}, { -154} },                            
 };
 
-SR_ s_179[] =
+SR_ s_184[] =
 {
     { { REQ_TOKEN}, {   2} },         
-    { {       303}, { 249} }, // IDENT
+    { {       306}, { 259} }, // IDENT
     { {         0}, {   0} },         
 };
 
-SR_ s_180[] =
+SR_ s_185[] =
 {
     { { REQ_TOKEN}, {   2} },         
-    { {       303}, { 250} }, // IDENT
+    { {       306}, { 260} }, // IDENT
     { {         0}, {   0} },         
 };
 
-SR_ s_181[] =
+SR_ s_186[] =
 {
     { { REQ_TOKEN}, {  28} },                        
-    { {       388}, { 251} }, // expression_list     
-    { {       364}, { 247} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       389}, { 261} }, // expression_list     
+    { {       365}, { 257} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2893,39 +3080,39 @@ SR_ s_181[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_182[] =
+SR_ s_187[] =
 {
     { { REQ_TOKEN}, {   3} },         
-    { {       305}, { 252} }, // NUM  
-    { {       303}, { 253} }, // IDENT
+    { {       308}, { 262} }, // NUM  
+    { {       306}, { 263} }, // IDENT
     { {         0}, {   0} },         
 };
 
-SR_ s_183[] =
+SR_ s_188[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 254} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 264} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -2933,233 +3120,241 @@ SR_ s_183[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_184[] =
+SR_ s_189[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        41}, { 255} }, // ')'
+    { {        41}, { 265} }, // ')'
     { {         0}, {   0} },       
 };
 
-SR_ s_185[] =
+SR_ s_190[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        41}, { 256} }, // ')'
+    { {        41}, { 266} }, // ')'
     { {         0}, {   0} },       
 };
 
-SR_ s_186[] =
+SR_ s_191[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -136} }, 
+    { {       0}, { -147} }, 
 };
 
-SR_ s_187[] =
+SR_ s_192[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -137} }, 
+    { {       0}, { -148} }, 
 };
 
-SR_ s_188[] =
+SR_ s_193[] =
 {
     { { REQ_TOKEN}, {   2} },         
-    { {       303}, { 257} }, // IDENT
+    { {       306}, { 267} }, // IDENT
     { {         0}, {   0} },         
 };
 
-SR_ s_189[] =
+SR_ s_194[] =
 {
     { { DEF_RED}, {   1} }, 
     { {       0}, { -13} }, 
 };
 
-SR_ s_190[] =
+SR_ s_195[] =
 {
     { { DEF_RED}, {   1} }, 
     { {       0}, { -14} }, 
 };
 
-SR_ s_191[] =
+SR_ s_196[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -15} }, 
+    { {       0}, { -21} }, 
 };
 
-SR_ s_192[] =
+SR_ s_197[] =
 {
     { { REQ_TOKEN}, {   3} },       
-    { {        59}, { 258} }, // ';'
+    { {        59}, { 268} }, // ';'
     { {        44}, {  32} }, // ','
     { {         0}, {   0} },       
 };
 
-SR_ s_193[] =
+SR_ s_198[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -17} }, 
+    { {       0}, { -23} }, 
 };
 
-SR_ s_194[] =
+SR_ s_199[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -149} }, 
+    { {       0}, { -160} }, 
 };
 
-SR_ s_195[] =
+SR_ s_200[] =
 {
     { { REQ_TOKEN}, {   3} },                    
-    { {       281}, { 259} }, // END_TEST_CONTENT
-    { {       306}, { 260} }, // CHR             
+    { {       281}, { 269} }, // END_TEST_CONTENT
+    { {       309}, { 270} }, // CHR             
     { {         0}, {   0} },                    
 };
 
-SR_ s_196[] =
+SR_ s_201[] =
 {
     { { REQ_TOKEN}, {   3} },                    
-    { {       281}, { 261} }, // END_TEST_CONTENT
-    { {       306}, { 260} }, // CHR             
+    { {       281}, { 271} }, // END_TEST_CONTENT
+    { {       309}, { 270} }, // CHR             
     { {         0}, {   0} },                    
 };
 
-SR_ s_197[] =
+SR_ s_202[] =
 {
     { { DEF_RED}, {   1} }, 
     { {       0}, { -11} }, 
 };
 
-SR_ s_198[] =
+SR_ s_203[] =
 {
     { { REQ_TOKEN}, {   4} },             
-    { {       358}, { 262} }, // parameter
-    { {       303}, { 113} }, // IDENT    
+    { {       359}, { 272} }, // parameter
+    { {       306}, { 113} }, // IDENT    
     { {        38}, { 114} }, // '&'      
     { {         0}, {   0} },             
 };
 
-SR_ s_199[] =
+SR_ s_204[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -21} }, 
+    { {       0}, { -27} }, 
 };
 
-SR_ s_200[] =
+SR_ s_205[] =
 {
     { { REQ_DEF}, {   6} },                           
-    { {     360}, { 263} }, // optional_parameter_list
-    { {     359}, { 111} }, // parameter_list         
-    { {     358}, { 112} }, // parameter              
-    { {     303}, { 113} }, // IDENT                  
+    { {     361}, { 273} }, // optional_parameter_list
+    { {     360}, { 111} }, // parameter_list         
+    { {     359}, { 112} }, // parameter              
+    { {     306}, { 113} }, // IDENT                  
     { {      38}, { 114} }, // '&'                    
-    { {       0}, { -25} },                           
+    { {       0}, { -31} },                           
 };
 
-SR_ s_201[] =
+SR_ s_206[] =
 {
     { { REQ_DEF}, {   6} },       
     { {      42}, { 120} }, // '*'
     { {      47}, { 121} }, // '/'
     { {      94}, { 122} }, // '^'
     { {      37}, { 123} }, // '%'
-    { {      91}, { 132} }, // '['
-    { {       0}, { -67} },       
+    { {      91}, { 137} }, // '['
+    { {       0}, { -73} },       
 };
 
-SR_ s_202[] =
+SR_ s_207[] =
 {
     { { REQ_DEF}, {   6} },       
     { {      42}, { 120} }, // '*'
     { {      47}, { 121} }, // '/'
     { {      94}, { 122} }, // '^'
     { {      37}, { 123} }, // '%'
-    { {      91}, { 132} }, // '['
-    { {       0}, { -70} },       
+    { {      91}, { 137} }, // '['
+    { {       0}, { -76} },       
 };
 
-SR_ s_203[] =
+SR_ s_208[] =
 {
     { { REQ_DEF}, {   3} },       
     { {      94}, { 122} }, // '^'
-    { {      91}, { 132} }, // '['
-    { {       0}, { -73} },       
+    { {      91}, { 137} }, // '['
+    { {       0}, { -79} },       
 };
 
-SR_ s_204[] =
+SR_ s_209[] =
 {
     { { REQ_DEF}, {   3} },       
     { {      94}, { 122} }, // '^'
-    { {      91}, { 132} }, // '['
-    { {       0}, { -76} },       
+    { {      91}, { 137} }, // '['
+    { {       0}, { -82} },       
 };
 
-SR_ s_205[] =
+SR_ s_210[] =
 {
     { { REQ_DEF}, {   2} },       
-    { {      91}, { 132} }, // '['
-    { {       0}, { -83} },       
+    { {      91}, { 137} }, // '['
+    { {       0}, { -89} },       
 };
 
-SR_ s_206[] =
+SR_ s_211[] =
 {
     { { REQ_DEF}, {   3} },       
     { {      94}, { 122} }, // '^'
-    { {      91}, { 132} }, // '['
-    { {       0}, { -86} },       
+    { {      91}, { 137} }, // '['
+    { {       0}, { -92} },       
 };
 
-SR_ s_207[] =
+SR_ s_212[] =
 {
-    { { REQ_DEF}, {   8} },       
+    { { REQ_DEF}, {  10} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
     { {      47}, { 121} }, // '/'
     { {      94}, { 122} }, // '^'
     { {      37}, { 123} }, // '%'
-    { {      91}, { 132} }, // '['
-    { {       0}, { -87} },       
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -93} },       
 };
 
-SR_ s_208[] =
+SR_ s_213[] =
 {
-    { { REQ_DEF}, {   8} },       
+    { { REQ_DEF}, {  10} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
     { {      47}, { 121} }, // '/'
     { {      94}, { 122} }, // '^'
     { {      37}, { 123} }, // '%'
-    { {      91}, { 132} }, // '['
-    { {       0}, { -88} },       
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -94} },       
 };
 
-SR_ s_209[] =
+SR_ s_214[] =
 {
-    { { REQ_DEF}, {   8} },       
+    { { REQ_DEF}, {  10} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
     { {      47}, { 121} }, // '/'
     { {      94}, { 122} }, // '^'
     { {      37}, { 123} }, // '%'
-    { {      91}, { 132} }, // '['
-    { {       0}, { -89} },       
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -95} },       
 };
 
-SR_ s_210[] =
+SR_ s_215[] =
 {
-    { { REQ_DEF}, {   8} },       
+    { { REQ_DEF}, {  10} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
     { {      47}, { 121} }, // '/'
     { {      94}, { 122} }, // '^'
     { {      37}, { 123} }, // '%'
-    { {      91}, { 132} }, // '['
-    { {       0}, { -90} },       
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -96} },       
 };
 
-SR_ s_211[] =
+SR_ s_216[] =
 {
-    { { REQ_DEF}, {  12} },       
+    { { REQ_DEF}, {  14} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3168,15 +3363,17 @@ SR_ s_211[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -91} },       
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -97} },       
 };
 
-SR_ s_212[] =
+SR_ s_217[] =
 {
-    { { REQ_DEF}, {  12} },       
+    { { REQ_DEF}, {  14} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3185,55 +3382,159 @@ SR_ s_212[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -92} },       
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -98} },       
 };
 
-SR_ s_213[] =
+SR_ s_218[] =
 {
-    { { REQ_DEF}, {  14} },       
-    { {      43}, { 118} }, // '+'
-    { {      45}, { 119} }, // '-'
-    { {      42}, { 120} }, // '*'
-    { {      47}, { 121} }, // '/'
-    { {      94}, { 122} }, // '^'
-    { {      37}, { 123} }, // '%'
-    { {      60}, { 124} }, // '<'
-    { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -94} },       
+    { { REQ_DEF}, {   19} },       
+    { {      43}, {  118} }, // '+'
+    { {      45}, {  119} }, // '-'
+    { {      42}, {  120} }, // '*'
+    { {      47}, {  121} }, // '/'
+    { {      94}, {  122} }, // '^'
+    { {      37}, {  123} }, // '%'
+    { {      60}, {  124} }, // '<'
+    { {      62}, {  125} }, // '>'
+    { {     299}, {  126} }, // LE 
+    { {     300}, {  127} }, // GE 
+    { {     298}, {  128} }, // NE 
+    { {     297}, {  129} }, // EQ 
+    { {      38}, {  132} }, // '&'
+    { {     124}, {  133} }, // '|'
+    { {     296}, {  134} }, // XOR
+    { {     301}, {  135} }, // SHL
+    { {     302}, {  136} }, // SHR
+    { {      91}, {  137} }, // '['
+    { {       0}, { -100} },       
 };
 
-SR_ s_214[] =
+SR_ s_219[] =
 {
-    { { REQ_DEF}, {  15} },       
-    { {      43}, { 118} }, // '+'
-    { {      45}, { 119} }, // '-'
-    { {      42}, { 120} }, // '*'
-    { {      47}, { 121} }, // '/'
-    { {      94}, { 122} }, // '^'
-    { {      37}, { 123} }, // '%'
-    { {      60}, { 124} }, // '<'
-    { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
-    { {     295}, { 130} }, // AND
-    { {      91}, { 132} }, // '['
-    { {       0}, { -95} },       
+    { { REQ_DEF}, {   20} },       
+    { {      43}, {  118} }, // '+'
+    { {      45}, {  119} }, // '-'
+    { {      42}, {  120} }, // '*'
+    { {      47}, {  121} }, // '/'
+    { {      94}, {  122} }, // '^'
+    { {      37}, {  123} }, // '%'
+    { {      60}, {  124} }, // '<'
+    { {      62}, {  125} }, // '>'
+    { {     299}, {  126} }, // LE 
+    { {     300}, {  127} }, // GE 
+    { {     298}, {  128} }, // NE 
+    { {     297}, {  129} }, // EQ 
+    { {     295}, {  130} }, // AND
+    { {      38}, {  132} }, // '&'
+    { {     124}, {  133} }, // '|'
+    { {     296}, {  134} }, // XOR
+    { {     301}, {  135} }, // SHL
+    { {     302}, {  136} }, // SHR
+    { {      91}, {  137} }, // '['
+    { {       0}, { -101} },       
 };
 
-SR_ s_215[] =
+SR_ s_220[] =
+{
+    { { REQ_DEF}, {   16} },       
+    { {      43}, {  118} }, // '+'
+    { {      45}, {  119} }, // '-'
+    { {      42}, {  120} }, // '*'
+    { {      47}, {  121} }, // '/'
+    { {      94}, {  122} }, // '^'
+    { {      37}, {  123} }, // '%'
+    { {      60}, {  124} }, // '<'
+    { {      62}, {  125} }, // '>'
+    { {     299}, {  126} }, // LE 
+    { {     300}, {  127} }, // GE 
+    { {     298}, {  128} }, // NE 
+    { {     297}, {  129} }, // EQ 
+    { {     301}, {  135} }, // SHL
+    { {     302}, {  136} }, // SHR
+    { {      91}, {  137} }, // '['
+    { {       0}, { -102} },       
+};
+
+SR_ s_221[] =
+{
+    { { REQ_DEF}, {   18} },       
+    { {      43}, {  118} }, // '+'
+    { {      45}, {  119} }, // '-'
+    { {      42}, {  120} }, // '*'
+    { {      47}, {  121} }, // '/'
+    { {      94}, {  122} }, // '^'
+    { {      37}, {  123} }, // '%'
+    { {      60}, {  124} }, // '<'
+    { {      62}, {  125} }, // '>'
+    { {     299}, {  126} }, // LE 
+    { {     300}, {  127} }, // GE 
+    { {     298}, {  128} }, // NE 
+    { {     297}, {  129} }, // EQ 
+    { {      38}, {  132} }, // '&'
+    { {     296}, {  134} }, // XOR
+    { {     301}, {  135} }, // SHL
+    { {     302}, {  136} }, // SHR
+    { {      91}, {  137} }, // '['
+    { {       0}, { -103} },       
+};
+
+SR_ s_222[] =
+{
+    { { REQ_DEF}, {   17} },       
+    { {      43}, {  118} }, // '+'
+    { {      45}, {  119} }, // '-'
+    { {      42}, {  120} }, // '*'
+    { {      47}, {  121} }, // '/'
+    { {      94}, {  122} }, // '^'
+    { {      37}, {  123} }, // '%'
+    { {      60}, {  124} }, // '<'
+    { {      62}, {  125} }, // '>'
+    { {     299}, {  126} }, // LE 
+    { {     300}, {  127} }, // GE 
+    { {     298}, {  128} }, // NE 
+    { {     297}, {  129} }, // EQ 
+    { {      38}, {  132} }, // '&'
+    { {     301}, {  135} }, // SHL
+    { {     302}, {  136} }, // SHR
+    { {      91}, {  137} }, // '['
+    { {       0}, { -104} },       
+};
+
+SR_ s_223[] =
+{
+    { { REQ_DEF}, {    8} },       
+    { {      43}, {  118} }, // '+'
+    { {      45}, {  119} }, // '-'
+    { {      42}, {  120} }, // '*'
+    { {      47}, {  121} }, // '/'
+    { {      94}, {  122} }, // '^'
+    { {      37}, {  123} }, // '%'
+    { {      91}, {  137} }, // '['
+    { {       0}, { -105} },       
+};
+
+SR_ s_224[] =
+{
+    { { REQ_DEF}, {    8} },       
+    { {      43}, {  118} }, // '+'
+    { {      45}, {  119} }, // '-'
+    { {      42}, {  120} }, // '*'
+    { {      47}, {  121} }, // '/'
+    { {      94}, {  122} }, // '^'
+    { {      37}, {  123} }, // '%'
+    { {      91}, {  137} }, // '['
+    { {       0}, { -106} },       
+};
+
+SR_ s_225[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        93}, { 264} }, // ']'
+    { { REQ_TOKEN}, {  22} },       
+    { {        93}, { 274} }, // ']'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -3242,19 +3543,24 @@ SR_ s_215[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_216[] =
+SR_ s_226[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3263,19 +3569,24 @@ SR_ s_216[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -53} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -59} },       
 };
 
-SR_ s_217[] =
+SR_ s_227[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3284,19 +3595,24 @@ SR_ s_217[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -54} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -60} },       
 };
 
-SR_ s_218[] =
+SR_ s_228[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3305,19 +3621,24 @@ SR_ s_218[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -65} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -71} },       
 };
 
-SR_ s_219[] =
+SR_ s_229[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3326,19 +3647,24 @@ SR_ s_219[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -68} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -74} },       
 };
 
-SR_ s_220[] =
+SR_ s_230[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3347,19 +3673,24 @@ SR_ s_220[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -71} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -77} },       
 };
 
-SR_ s_221[] =
+SR_ s_231[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3368,19 +3699,24 @@ SR_ s_221[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -74} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -80} },       
 };
 
-SR_ s_222[] =
+SR_ s_232[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3389,19 +3725,24 @@ SR_ s_222[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -77} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -83} },       
 };
 
-SR_ s_223[] =
+SR_ s_233[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3410,19 +3751,24 @@ SR_ s_223[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -79} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -85} },       
 };
 
-SR_ s_224[] =
+SR_ s_234[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3431,19 +3777,24 @@ SR_ s_224[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -81} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -87} },       
 };
 
-SR_ s_225[] =
+SR_ s_235[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3452,19 +3803,24 @@ SR_ s_225[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -84} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -90} },       
 };
 
-SR_ s_226[] =
+SR_ s_236[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3473,19 +3829,24 @@ SR_ s_226[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -55} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -61} },       
 };
 
-SR_ s_227[] =
+SR_ s_237[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3494,19 +3855,24 @@ SR_ s_227[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -66} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -72} },       
 };
 
-SR_ s_228[] =
+SR_ s_238[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3515,19 +3881,24 @@ SR_ s_228[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -69} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -75} },       
 };
 
-SR_ s_229[] =
+SR_ s_239[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3536,19 +3907,24 @@ SR_ s_229[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -72} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -78} },       
 };
 
-SR_ s_230[] =
+SR_ s_240[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3557,19 +3933,24 @@ SR_ s_230[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -75} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -81} },       
 };
 
-SR_ s_231[] =
+SR_ s_241[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3578,19 +3959,24 @@ SR_ s_231[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -78} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -84} },       
 };
 
-SR_ s_232[] =
+SR_ s_242[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3599,19 +3985,24 @@ SR_ s_232[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -80} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -86} },       
 };
 
-SR_ s_233[] =
+SR_ s_243[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3620,19 +4011,24 @@ SR_ s_233[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -82} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -88} },       
 };
 
-SR_ s_234[] =
+SR_ s_244[] =
 {
-    { { REQ_DEF}, {  16} },       
+    { { REQ_DEF}, {  21} },       
     { {      43}, { 118} }, // '+'
     { {      45}, { 119} }, // '-'
     { {      42}, { 120} }, // '*'
@@ -3641,33 +4037,38 @@ SR_ s_234[] =
     { {      37}, { 123} }, // '%'
     { {      60}, { 124} }, // '<'
     { {      62}, { 125} }, // '>'
-    { {     298}, { 126} }, // LE 
-    { {     299}, { 127} }, // GE 
-    { {     297}, { 128} }, // NE 
-    { {     296}, { 129} }, // EQ 
+    { {     299}, { 126} }, // LE 
+    { {     300}, { 127} }, // GE 
+    { {     298}, { 128} }, // NE 
+    { {     297}, { 129} }, // EQ 
     { {     295}, { 130} }, // AND
     { {     294}, { 131} }, // OR 
-    { {      91}, { 132} }, // '['
-    { {       0}, { -85} },       
+    { {      38}, { 132} }, // '&'
+    { {     124}, { 133} }, // '|'
+    { {     296}, { 134} }, // XOR
+    { {     301}, { 135} }, // SHL
+    { {     302}, { 136} }, // SHR
+    { {      91}, { 137} }, // '['
+    { {       0}, { -91} },       
 };
 
-SR_ s_235[] =
+SR_ s_245[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        41}, { 265} }, // ')'
+    { {        41}, { 275} }, // ')'
     { {         0}, {   0} },       
 };
 
-SR_ s_236[] =
+SR_ s_246[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -56} }, 
+    { {       0}, { -62} }, 
 };
 
-SR_ s_237[] =
+SR_ s_247[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        44}, { 266} }, // ','
+    { { REQ_TOKEN}, {  22} },       
+    { {        44}, { 276} }, // ','
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -3676,20 +4077,25 @@ SR_ s_237[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_238[] =
+SR_ s_248[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        59}, { 267} }, // ';'
+    { { REQ_TOKEN}, {  22} },       
+    { {        59}, { 277} }, // ';'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -3698,52 +4104,57 @@ SR_ s_238[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_239[] =
+SR_ s_249[] =
 {
     { { REQ_TOKEN}, {   6} },                          
-    { {       358}, { 268} }, // parameter             
-    { {       386}, { 176} }, // variable_specification
-    { {       303}, { 269} }, // IDENT                 
-    { {        38}, { 270} }, // '&'                   
+    { {       359}, { 278} }, // parameter             
+    { {       387}, { 181} }, // variable_specification
+    { {       306}, { 279} }, // IDENT                 
+    { {        38}, { 280} }, // '&'                   
     { {        91}, {  23} }, // '['                   
     { {         0}, {   0} },                          
 };
 
-SR_ s_240[] =
+SR_ s_250[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 271} }, // expression          
-    { {       257}, { 272} }, // LET                 
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 281} }, // expression          
+    { {       257}, { 282} }, // LET                 
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -3751,10 +4162,10 @@ SR_ s_240[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_241[] =
+SR_ s_251[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        41}, { 273} }, // ')'
+    { { REQ_TOKEN}, {  22} },       
+    { {        41}, { 283} }, // ')'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -3763,20 +4174,25 @@ SR_ s_241[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_242[] =
+SR_ s_252[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        41}, { 274} }, // ')'
+    { { REQ_TOKEN}, {  22} },       
+    { {        41}, { 284} }, // ')'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -3785,41 +4201,46 @@ SR_ s_242[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_243[] =
+SR_ s_253[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 275} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 285} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -3827,10 +4248,10 @@ SR_ s_243[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_244[] =
+SR_ s_254[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        41}, { 276} }, // ')'
+    { { REQ_TOKEN}, {  22} },       
+    { {        41}, { 286} }, // ')'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -3839,33 +4260,38 @@ SR_ s_244[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_245[] =
+SR_ s_255[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {       125}, { 277} }, // '}'
+    { {       125}, { 287} }, // '}'
     { {         0}, {   0} },       
 };
 
-SR_ s_246[] =
+SR_ s_256[] =
 {
     { { REQ_DEF}, {    2} },       
-    { {      44}, {  278} }, // ','
-    { {       0}, { -144} },       
+    { {      44}, {  288} }, // ','
+    { {       0}, { -155} },       
 };
 
-SR_ s_247[] =
+SR_ s_257[] =
 {
-    { { REQ_DEF}, {   16} },       
+    { { REQ_DEF}, {   21} },       
     { {      43}, {  118} }, // '+'
     { {      45}, {  119} }, // '-'
     { {      42}, {  120} }, // '*'
@@ -3874,63 +4300,68 @@ SR_ s_247[] =
     { {      37}, {  123} }, // '%'
     { {      60}, {  124} }, // '<'
     { {      62}, {  125} }, // '>'
-    { {     298}, {  126} }, // LE 
-    { {     299}, {  127} }, // GE 
-    { {     297}, {  128} }, // NE 
-    { {     296}, {  129} }, // EQ 
+    { {     299}, {  126} }, // LE 
+    { {     300}, {  127} }, // GE 
+    { {     298}, {  128} }, // NE 
+    { {     297}, {  129} }, // EQ 
     { {     295}, {  130} }, // AND
     { {     294}, {  131} }, // OR 
-    { {      91}, {  132} }, // '['
-    { {       0}, { -141} },       
+    { {      38}, {  132} }, // '&'
+    { {     124}, {  133} }, // '|'
+    { {     296}, {  134} }, // XOR
+    { {     301}, {  135} }, // SHL
+    { {     302}, {  136} }, // SHR
+    { {      91}, {  137} }, // '['
+    { {       0}, { -152} },       
 };
 
-SR_ s_248[] =
+SR_ s_258[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        41}, { 279} }, // ')'
+    { {        41}, { 289} }, // ')'
     { {         0}, {   0} },       
 };
 
-SR_ s_249[] =
+SR_ s_259[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -102} }, 
+    { {       0}, { -113} }, 
 };
 
-SR_ s_250[] =
+SR_ s_260[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -103} }, 
+    { {       0}, { -114} }, 
 };
 
-SR_ s_251[] =
+SR_ s_261[] =
 {
     { { REQ_TOKEN}, {   3} },       
-    { {       125}, { 280} }, // '}'
-    { {        44}, { 278} }, // ','
+    { {       125}, { 290} }, // '}'
+    { {        44}, { 288} }, // ','
     { {         0}, {   0} },       
 };
 
-SR_ s_252[] =
+SR_ s_262[] =
 {
     { { REQ_TOKEN}, {   3} },       
-    { {        93}, { 281} }, // ']'
-    { {        44}, { 282} }, // ','
+    { {        93}, { 291} }, // ']'
+    { {        44}, { 292} }, // ','
     { {         0}, {   0} },       
 };
 
-SR_ s_253[] =
+SR_ s_263[] =
 {
     { { REQ_TOKEN}, {   3} },       
-    { {        93}, { 283} }, // ']'
-    { {        44}, { 284} }, // ','
+    { {        93}, { 293} }, // ']'
+    { {        44}, { 294} }, // ','
     { {         0}, {   0} },       
 };
 
-SR_ s_254[] =
+SR_ s_264[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        41}, { 285} }, // ')'
+    { { REQ_TOKEN}, {  22} },       
+    { {        41}, { 295} }, // ')'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -3939,115 +4370,120 @@ SR_ s_254[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_255[] =
+SR_ s_265[] =
 {
-    { { DEF_RED}, {   1} }, 
-    { {       0}, { -97} }, 
+    { { DEF_RED}, {    1} }, 
+    { {       0}, { -108} }, 
 };
 
-SR_ s_256[] =
+SR_ s_266[] =
 {
-    { { DEF_RED}, {   1} }, 
-    { {       0}, { -98} }, 
+    { { DEF_RED}, {    1} }, 
+    { {       0}, { -109} }, 
 };
 
-SR_ s_257[] =
+SR_ s_267[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -138} }, 
+    { {       0}, { -149} }, 
 };
 
-SR_ s_258[] =
+SR_ s_268[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -18} }, 
+    { {       0}, { -24} }, 
 };
 
-SR_ s_259[] =
+SR_ s_269[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -151} }, 
+    { {       0}, { -162} }, 
 };
 
-SR_ s_260[] =
+SR_ s_270[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -154} }, 
+    { {       0}, { -165} }, 
 };
 
-SR_ s_261[] =
+SR_ s_271[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -152} }, 
+    { {       0}, { -163} }, 
 };
 
-SR_ s_262[] =
+SR_ s_272[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -23} }, 
+    { {       0}, { -29} }, 
 };
 
-SR_ s_263[] =
+SR_ s_273[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        41}, { 286} }, // ')'
+    { {        41}, { 296} }, // ')'
     { {         0}, {   0} },       
 };
 
-SR_ s_264[] =
+SR_ s_274[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -106} }, 
+    { {       0}, { -117} }, 
 };
 
-SR_ s_265[] =
+SR_ s_275[] =
 {
     { { DEF_RED}, {   1} }, 
-    { {       0}, { -52} }, 
+    { {       0}, { -58} }, 
 };
 
-SR_ s_266[] =
+SR_ s_276[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {       304}, { 287} }, // STR
+    { {       307}, { 297} }, // STR
     { {         0}, {   0} },       
 };
 
-SR_ s_267[] =
+SR_ s_277[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 288} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 298} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -4055,31 +4491,31 @@ SR_ s_267[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_268[] =
+SR_ s_278[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        58}, { 289} }, // ':'
+    { {        58}, { 299} }, // ':'
     { {         0}, {   0} },       
 };
 
-SR_ s_269[] =
+SR_ s_279[] =
 {
     { { REQ_DEF}, {    2} },       
-    { {      58}, {  -20} }, // ':'
-    { {       0}, { -133} },       
+    { {      58}, {  -26} }, // ':'
+    { {       0}, { -144} },       
 };
 
-SR_ s_270[] =
+SR_ s_280[] =
 {
     { { REQ_TOKEN}, {   2} },         
-    { {       303}, { 290} }, // IDENT
+    { {       306}, { 300} }, // IDENT
     { {         0}, {   0} },         
 };
 
-SR_ s_271[] =
+SR_ s_281[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        59}, { 291} }, // ';'
+    { { REQ_TOKEN}, {  22} },       
+    { {        59}, { 301} }, // ';'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -4088,58 +4524,63 @@ SR_ s_271[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_272[] =
+SR_ s_282[] =
 {
     { { REQ_TOKEN}, {   6} },                          
-    { {       358}, { 292} }, // parameter             
-    { {       386}, { 176} }, // variable_specification
-    { {       303}, { 269} }, // IDENT                 
-    { {        38}, { 270} }, // '&'                   
+    { {       359}, { 302} }, // parameter             
+    { {       387}, { 181} }, // variable_specification
+    { {       306}, { 279} }, // IDENT                 
+    { {        38}, { 280} }, // '&'                   
     { {        91}, {  23} }, // '['                   
     { {         0}, {   0} },                          
 };
 
-SR_ s_273[] =
+SR_ s_283[] =
 {
     { { ERR_REQ}, {  49} },                        
-    { {     362}, { 293} }, // statement           
-    { {     363}, {  48} }, // statement_          
+    { {     363}, { 303} }, // statement           
+    { {     364}, {  48} }, // statement_          
     { { errTok_}, {  49} }, // errTok_             
     { {      59}, {  50} }, // ';'                 
-    { {     364}, {  51} }, // expression          
-    { {     366}, {  52} }, // static_assert       
-    { {     357}, {  53} }, // scope_block         
-    { {     378}, {  54} }, // for_statement       
-    { {     379}, {  55} }, // if_statement        
-    { {     380}, {  56} }, // while_statement     
-    { {     381}, {  57} }, // switch_statement    
-    { {     375}, {  58} }, // break_statement     
-    { {     376}, {  59} }, // continue_statement  
-    { {     377}, {  60} }, // return_statement    
-    { {     385}, {  61} }, // variable_declaration
-    { {     367}, {  62} }, // variable            
+    { {     365}, {  51} }, // expression          
+    { {     367}, {  52} }, // static_assert       
+    { {     358}, {  53} }, // scope_block         
+    { {     379}, {  54} }, // for_statement       
+    { {     380}, {  55} }, // if_statement        
+    { {     381}, {  56} }, // while_statement     
+    { {     382}, {  57} }, // switch_statement    
+    { {     376}, {  58} }, // break_statement     
+    { {     377}, {  59} }, // continue_statement  
+    { {     378}, {  60} }, // return_statement    
+    { {     386}, {  61} }, // variable_declaration
+    { {     368}, {  62} }, // variable            
     { {      45}, {  63} }, // '-'                 
-    { {     370}, {  64} }, // array_element       
-    { {     369}, {  65} }, // constant_literal    
-    { {     371}, {  66} }, // string_literal      
-    { {     372}, {  67} }, // anonymous_array     
-    { {     373}, {  68} }, // anonymous_struct    
-    { {     374}, {  69} }, // function_call       
-    { {     365}, {  70} }, // builtin_function    
+    { {     371}, {  64} }, // array_element       
+    { {     370}, {  65} }, // constant_literal    
+    { {     372}, {  66} }, // string_literal      
+    { {     373}, {  67} }, // anonymous_array     
+    { {     374}, {  68} }, // anonymous_struct    
+    { {     375}, {  69} }, // function_call       
+    { {     366}, {  70} }, // builtin_function    
     { {     264}, {  71} }, // SIZEOF              
     { {      40}, {  72} }, // '('                 
-    { {     301}, {  73} }, // INC                 
-    { {     302}, {  74} }, // DEC                 
+    { {     304}, {  73} }, // INC                 
+    { {     305}, {  74} }, // DEC                 
     { {      33}, {  75} }, // '!'                 
     { {     276}, {  76} }, // ASSERT              
     { {     123}, {  18} }, // '{'                 
@@ -4151,11 +4592,11 @@ SR_ s_273[] =
     { {     274}, {  82} }, // CONTINUE            
     { {     275}, {  83} }, // RETURN              
     { {     257}, {  84} }, // LET                 
-    { {     303}, {  85} }, // IDENT               
-    { {     368}, {  86} }, // field               
-    { {     305}, {  87} }, // NUM                 
-    { {     306}, {  88} }, // CHR                 
-    { {     304}, {  89} }, // STR                 
+    { {     306}, {  85} }, // IDENT               
+    { {     369}, {  86} }, // field               
+    { {     308}, {  87} }, // NUM                 
+    { {     309}, {  88} }, // CHR                 
+    { {     307}, {  89} }, // STR                 
     { {      35}, {  90} }, // '#'                 
     { {     262}, {  91} }, // PRINT               
     { {     261}, {  92} }, // SCAN                
@@ -4163,37 +4604,37 @@ SR_ s_273[] =
     { {       0}, {   0} },                        
 };
 
-SR_ s_274[] =
+SR_ s_284[] =
 {
     { { ERR_REQ}, {  49} },                        
-    { {     362}, { 294} }, // statement           
-    { {     363}, {  48} }, // statement_          
+    { {     363}, { 304} }, // statement           
+    { {     364}, {  48} }, // statement_          
     { { errTok_}, {  49} }, // errTok_             
     { {      59}, {  50} }, // ';'                 
-    { {     364}, {  51} }, // expression          
-    { {     366}, {  52} }, // static_assert       
-    { {     357}, {  53} }, // scope_block         
-    { {     378}, {  54} }, // for_statement       
-    { {     379}, {  55} }, // if_statement        
-    { {     380}, {  56} }, // while_statement     
-    { {     381}, {  57} }, // switch_statement    
-    { {     375}, {  58} }, // break_statement     
-    { {     376}, {  59} }, // continue_statement  
-    { {     377}, {  60} }, // return_statement    
-    { {     385}, {  61} }, // variable_declaration
-    { {     367}, {  62} }, // variable            
+    { {     365}, {  51} }, // expression          
+    { {     367}, {  52} }, // static_assert       
+    { {     358}, {  53} }, // scope_block         
+    { {     379}, {  54} }, // for_statement       
+    { {     380}, {  55} }, // if_statement        
+    { {     381}, {  56} }, // while_statement     
+    { {     382}, {  57} }, // switch_statement    
+    { {     376}, {  58} }, // break_statement     
+    { {     377}, {  59} }, // continue_statement  
+    { {     378}, {  60} }, // return_statement    
+    { {     386}, {  61} }, // variable_declaration
+    { {     368}, {  62} }, // variable            
     { {      45}, {  63} }, // '-'                 
-    { {     370}, {  64} }, // array_element       
-    { {     369}, {  65} }, // constant_literal    
-    { {     371}, {  66} }, // string_literal      
-    { {     372}, {  67} }, // anonymous_array     
-    { {     373}, {  68} }, // anonymous_struct    
-    { {     374}, {  69} }, // function_call       
-    { {     365}, {  70} }, // builtin_function    
+    { {     371}, {  64} }, // array_element       
+    { {     370}, {  65} }, // constant_literal    
+    { {     372}, {  66} }, // string_literal      
+    { {     373}, {  67} }, // anonymous_array     
+    { {     374}, {  68} }, // anonymous_struct    
+    { {     375}, {  69} }, // function_call       
+    { {     366}, {  70} }, // builtin_function    
     { {     264}, {  71} }, // SIZEOF              
     { {      40}, {  72} }, // '('                 
-    { {     301}, {  73} }, // INC                 
-    { {     302}, {  74} }, // DEC                 
+    { {     304}, {  73} }, // INC                 
+    { {     305}, {  74} }, // DEC                 
     { {      33}, {  75} }, // '!'                 
     { {     276}, {  76} }, // ASSERT              
     { {     123}, {  18} }, // '{'                 
@@ -4205,11 +4646,11 @@ SR_ s_274[] =
     { {     274}, {  82} }, // CONTINUE            
     { {     275}, {  83} }, // RETURN              
     { {     257}, {  84} }, // LET                 
-    { {     303}, {  85} }, // IDENT               
-    { {     368}, {  86} }, // field               
-    { {     305}, {  87} }, // NUM                 
-    { {     306}, {  88} }, // CHR                 
-    { {     304}, {  89} }, // STR                 
+    { {     306}, {  85} }, // IDENT               
+    { {     369}, {  86} }, // field               
+    { {     308}, {  87} }, // NUM                 
+    { {     309}, {  88} }, // CHR                 
+    { {     307}, {  89} }, // STR                 
     { {      35}, {  90} }, // '#'                 
     { {     262}, {  91} }, // PRINT               
     { {     261}, {  92} }, // SCAN                
@@ -4217,10 +4658,10 @@ SR_ s_274[] =
     { {       0}, {   0} },                        
 };
 
-SR_ s_275[] =
+SR_ s_285[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        41}, { 295} }, // ')'
+    { { REQ_TOKEN}, {  22} },       
+    { {        41}, { 305} }, // ')'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -4229,54 +4670,59 @@ SR_ s_275[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_276[] =
+SR_ s_286[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {       123}, { 296} }, // '{'
+    { {       123}, { 306} }, // '{'
     { {         0}, {   0} },       
 };
 
-SR_ s_277[] =
+SR_ s_287[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -113} }, 
+    { {       0}, { -124} }, 
 };
 
-SR_ s_278[] =
+SR_ s_288[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 297} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 307} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -4284,49 +4730,49 @@ SR_ s_278[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_279[] =
+SR_ s_289[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -114} }, 
+    { {       0}, { -125} }, 
 };
 
-SR_ s_280[] =
+SR_ s_290[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -108} }, 
+    { {       0}, { -119} }, 
 };
 
-SR_ s_281[] =
+SR_ s_291[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -109} }, 
+    { {       0}, { -120} }, 
 };
 
-SR_ s_282[] =
+SR_ s_292[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 298} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 308} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -4334,37 +4780,37 @@ SR_ s_282[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_283[] =
+SR_ s_293[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -110} }, 
+    { {       0}, { -121} }, 
 };
 
-SR_ s_284[] =
+SR_ s_294[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 299} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 309} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -4372,29 +4818,29 @@ SR_ s_284[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_285[] =
+SR_ s_295[] =
 {
-    { { DEF_RED}, {   1} }, 
-    { {       0}, { -96} }, 
+    { { DEF_RED}, {    1} }, 
+    { {       0}, { -107} }, 
 };
 
-SR_ s_286[] =
+SR_ s_296[] =
 {
     { { DEF_RED}, {   1} }, 
     { {       0}, { -12} }, 
 };
 
-SR_ s_287[] =
+SR_ s_297[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        41}, { 300} }, // ')'
+    { {        41}, { 310} }, // ')'
     { {         0}, {   0} },       
 };
 
-SR_ s_288[] =
+SR_ s_298[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        59}, { 301} }, // ';'
+    { { REQ_TOKEN}, {  22} },       
+    { {        59}, { 311} }, // ';'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -4403,41 +4849,46 @@ SR_ s_288[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_289[] =
+SR_ s_299[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 302} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 312} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -4445,38 +4896,38 @@ SR_ s_289[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_290[] =
+SR_ s_300[] =
 {
     { { REQ_DEF}, {    2} },       
-    { {      58}, {  -21} }, // ':'
-    { {       0}, { -134} },       
+    { {      58}, {  -27} }, // ':'
+    { {       0}, { -145} },       
 };
 
-SR_ s_291[] =
+SR_ s_301[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 303} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 313} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -4484,57 +4935,57 @@ SR_ s_291[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_292[] =
+SR_ s_302[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        58}, { 304} }, // ':'
+    { {        58}, { 314} }, // ':'
     { {         0}, {   0} },       
 };
 
-SR_ s_293[] =
+SR_ s_303[] =
 {
     { { REQ_DEF}, {    2} },        
-    { {     283}, {  305} }, // ELSE
-    { {       0}, { -122} },        
+    { {     283}, {  315} }, // ELSE
+    { {       0}, { -133} },        
 };
 
-SR_ s_294[] =
+SR_ s_304[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -124} }, 
+    { {       0}, { -135} }, 
 };
 
-SR_ s_295[] =
+SR_ s_305[] =
 {
     { { ERR_REQ}, {  49} },                        
-    { {     362}, { 306} }, // statement           
-    { {     363}, {  48} }, // statement_          
+    { {     363}, { 316} }, // statement           
+    { {     364}, {  48} }, // statement_          
     { { errTok_}, {  49} }, // errTok_             
     { {      59}, {  50} }, // ';'                 
-    { {     364}, {  51} }, // expression          
-    { {     366}, {  52} }, // static_assert       
-    { {     357}, {  53} }, // scope_block         
-    { {     378}, {  54} }, // for_statement       
-    { {     379}, {  55} }, // if_statement        
-    { {     380}, {  56} }, // while_statement     
-    { {     381}, {  57} }, // switch_statement    
-    { {     375}, {  58} }, // break_statement     
-    { {     376}, {  59} }, // continue_statement  
-    { {     377}, {  60} }, // return_statement    
-    { {     385}, {  61} }, // variable_declaration
-    { {     367}, {  62} }, // variable            
+    { {     365}, {  51} }, // expression          
+    { {     367}, {  52} }, // static_assert       
+    { {     358}, {  53} }, // scope_block         
+    { {     379}, {  54} }, // for_statement       
+    { {     380}, {  55} }, // if_statement        
+    { {     381}, {  56} }, // while_statement     
+    { {     382}, {  57} }, // switch_statement    
+    { {     376}, {  58} }, // break_statement     
+    { {     377}, {  59} }, // continue_statement  
+    { {     378}, {  60} }, // return_statement    
+    { {     386}, {  61} }, // variable_declaration
+    { {     368}, {  62} }, // variable            
     { {      45}, {  63} }, // '-'                 
-    { {     370}, {  64} }, // array_element       
-    { {     369}, {  65} }, // constant_literal    
-    { {     371}, {  66} }, // string_literal      
-    { {     372}, {  67} }, // anonymous_array     
-    { {     373}, {  68} }, // anonymous_struct    
-    { {     374}, {  69} }, // function_call       
-    { {     365}, {  70} }, // builtin_function    
+    { {     371}, {  64} }, // array_element       
+    { {     370}, {  65} }, // constant_literal    
+    { {     372}, {  66} }, // string_literal      
+    { {     373}, {  67} }, // anonymous_array     
+    { {     374}, {  68} }, // anonymous_struct    
+    { {     375}, {  69} }, // function_call       
+    { {     366}, {  70} }, // builtin_function    
     { {     264}, {  71} }, // SIZEOF              
     { {      40}, {  72} }, // '('                 
-    { {     301}, {  73} }, // INC                 
-    { {     302}, {  74} }, // DEC                 
+    { {     304}, {  73} }, // INC                 
+    { {     305}, {  74} }, // DEC                 
     { {      33}, {  75} }, // '!'                 
     { {     276}, {  76} }, // ASSERT              
     { {     123}, {  18} }, // '{'                 
@@ -4546,11 +4997,11 @@ SR_ s_295[] =
     { {     274}, {  82} }, // CONTINUE            
     { {     275}, {  83} }, // RETURN              
     { {     257}, {  84} }, // LET                 
-    { {     303}, {  85} }, // IDENT               
-    { {     368}, {  86} }, // field               
-    { {     305}, {  87} }, // NUM                 
-    { {     306}, {  88} }, // CHR                 
-    { {     304}, {  89} }, // STR                 
+    { {     306}, {  85} }, // IDENT               
+    { {     369}, {  86} }, // field               
+    { {     308}, {  87} }, // NUM                 
+    { {     309}, {  88} }, // CHR                 
+    { {     307}, {  89} }, // STR                 
     { {      35}, {  90} }, // '#'                 
     { {     262}, {  91} }, // PRINT               
     { {     261}, {  92} }, // SCAN                
@@ -4558,18 +5009,18 @@ SR_ s_295[] =
     { {       0}, {   0} },                        
 };
 
-SR_ s_296[] =
+SR_ s_306[] =
 {
     { { REQ_TOKEN}, {   4} },               
-    { {       382}, { 307} }, // case_list  
-    { {       383}, { 308} }, // switch_case
-    { {       270}, { 309} }, // CASE       
+    { {       383}, { 317} }, // case_list  
+    { {       384}, { 318} }, // switch_case
+    { {       270}, { 319} }, // CASE       
     { {         0}, {   0} },               
 };
 
-SR_ s_297[] =
+SR_ s_307[] =
 {
-    { { REQ_DEF}, {   16} },       
+    { { REQ_DEF}, {   21} },       
     { {      43}, {  118} }, // '+'
     { {      45}, {  119} }, // '-'
     { {      42}, {  120} }, // '*'
@@ -4578,20 +5029,25 @@ SR_ s_297[] =
     { {      37}, {  123} }, // '%'
     { {      60}, {  124} }, // '<'
     { {      62}, {  125} }, // '>'
-    { {     298}, {  126} }, // LE 
-    { {     299}, {  127} }, // GE 
-    { {     297}, {  128} }, // NE 
-    { {     296}, {  129} }, // EQ 
+    { {     299}, {  126} }, // LE 
+    { {     300}, {  127} }, // GE 
+    { {     298}, {  128} }, // NE 
+    { {     297}, {  129} }, // EQ 
     { {     295}, {  130} }, // AND
     { {     294}, {  131} }, // OR 
-    { {      91}, {  132} }, // '['
-    { {       0}, { -142} },       
+    { {      38}, {  132} }, // '&'
+    { {     124}, {  133} }, // '|'
+    { {     296}, {  134} }, // XOR
+    { {     301}, {  135} }, // SHL
+    { {     302}, {  136} }, // SHR
+    { {      91}, {  137} }, // '['
+    { {       0}, { -153} },       
 };
 
-SR_ s_298[] =
+SR_ s_308[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        93}, { 310} }, // ']'
+    { { REQ_TOKEN}, {  22} },       
+    { {        93}, { 320} }, // ']'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -4600,20 +5056,25 @@ SR_ s_298[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_299[] =
+SR_ s_309[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        93}, { 311} }, // ']'
+    { { REQ_TOKEN}, {  22} },       
+    { {        93}, { 321} }, // ']'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -4622,47 +5083,52 @@ SR_ s_299[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_300[] =
+SR_ s_310[] =
 {
-    { { DEF_RED}, {   1} }, 
-    { {       0}, { -99} }, 
+    { { DEF_RED}, {    1} }, 
+    { {       0}, { -110} }, 
 };
 
-SR_ s_301[] =
+SR_ s_311[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 312} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 322} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -4670,10 +5136,10 @@ SR_ s_301[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_302[] =
+SR_ s_312[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        41}, { 313} }, // ')'
+    { { REQ_TOKEN}, {  22} },       
+    { {        41}, { 323} }, // ')'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -4682,20 +5148,25 @@ SR_ s_302[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_303[] =
+SR_ s_313[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        59}, { 314} }, // ';'
+    { { REQ_TOKEN}, {  22} },       
+    { {        59}, { 324} }, // ';'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -4704,41 +5175,46 @@ SR_ s_303[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_304[] =
+SR_ s_314[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 315} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 325} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -4746,37 +5222,37 @@ SR_ s_304[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_305[] =
+SR_ s_315[] =
 {
     { { ERR_REQ}, {  49} },                        
-    { {     362}, { 316} }, // statement           
-    { {     363}, {  48} }, // statement_          
+    { {     363}, { 326} }, // statement           
+    { {     364}, {  48} }, // statement_          
     { { errTok_}, {  49} }, // errTok_             
     { {      59}, {  50} }, // ';'                 
-    { {     364}, {  51} }, // expression          
-    { {     366}, {  52} }, // static_assert       
-    { {     357}, {  53} }, // scope_block         
-    { {     378}, {  54} }, // for_statement       
-    { {     379}, {  55} }, // if_statement        
-    { {     380}, {  56} }, // while_statement     
-    { {     381}, {  57} }, // switch_statement    
-    { {     375}, {  58} }, // break_statement     
-    { {     376}, {  59} }, // continue_statement  
-    { {     377}, {  60} }, // return_statement    
-    { {     385}, {  61} }, // variable_declaration
-    { {     367}, {  62} }, // variable            
+    { {     365}, {  51} }, // expression          
+    { {     367}, {  52} }, // static_assert       
+    { {     358}, {  53} }, // scope_block         
+    { {     379}, {  54} }, // for_statement       
+    { {     380}, {  55} }, // if_statement        
+    { {     381}, {  56} }, // while_statement     
+    { {     382}, {  57} }, // switch_statement    
+    { {     376}, {  58} }, // break_statement     
+    { {     377}, {  59} }, // continue_statement  
+    { {     378}, {  60} }, // return_statement    
+    { {     386}, {  61} }, // variable_declaration
+    { {     368}, {  62} }, // variable            
     { {      45}, {  63} }, // '-'                 
-    { {     370}, {  64} }, // array_element       
-    { {     369}, {  65} }, // constant_literal    
-    { {     371}, {  66} }, // string_literal      
-    { {     372}, {  67} }, // anonymous_array     
-    { {     373}, {  68} }, // anonymous_struct    
-    { {     374}, {  69} }, // function_call       
-    { {     365}, {  70} }, // builtin_function    
+    { {     371}, {  64} }, // array_element       
+    { {     370}, {  65} }, // constant_literal    
+    { {     372}, {  66} }, // string_literal      
+    { {     373}, {  67} }, // anonymous_array     
+    { {     374}, {  68} }, // anonymous_struct    
+    { {     375}, {  69} }, // function_call       
+    { {     366}, {  70} }, // builtin_function    
     { {     264}, {  71} }, // SIZEOF              
     { {      40}, {  72} }, // '('                 
-    { {     301}, {  73} }, // INC                 
-    { {     302}, {  74} }, // DEC                 
+    { {     304}, {  73} }, // INC                 
+    { {     305}, {  74} }, // DEC                 
     { {      33}, {  75} }, // '!'                 
     { {     276}, {  76} }, // ASSERT              
     { {     123}, {  18} }, // '{'                 
@@ -4788,11 +5264,11 @@ SR_ s_305[] =
     { {     274}, {  82} }, // CONTINUE            
     { {     275}, {  83} }, // RETURN              
     { {     257}, {  84} }, // LET                 
-    { {     303}, {  85} }, // IDENT               
-    { {     368}, {  86} }, // field               
-    { {     305}, {  87} }, // NUM                 
-    { {     306}, {  88} }, // CHR                 
-    { {     304}, {  89} }, // STR                 
+    { {     306}, {  85} }, // IDENT               
+    { {     369}, {  86} }, // field               
+    { {     308}, {  87} }, // NUM                 
+    { {     309}, {  88} }, // CHR                 
+    { {     307}, {  89} }, // STR                 
     { {      35}, {  90} }, // '#'                 
     { {     262}, {  91} }, // PRINT               
     { {     261}, {  92} }, // SCAN                
@@ -4800,54 +5276,54 @@ SR_ s_305[] =
     { {       0}, {   0} },                        
 };
 
-SR_ s_306[] =
+SR_ s_316[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -125} }, 
+    { {       0}, { -136} }, 
 };
 
-SR_ s_307[] =
+SR_ s_317[] =
 {
     { { REQ_TOKEN}, {   6} },                
-    { {       125}, { 317} }, // '}'         
-    { {       384}, { 318} }, // default_case
-    { {       383}, { 319} }, // switch_case 
-    { {       271}, { 320} }, // DEFAULT     
-    { {       270}, { 309} }, // CASE        
+    { {       125}, { 327} }, // '}'         
+    { {       385}, { 328} }, // default_case
+    { {       384}, { 329} }, // switch_case 
+    { {       271}, { 330} }, // DEFAULT     
+    { {       270}, { 319} }, // CASE        
     { {         0}, {   0} },                
 };
 
-SR_ s_308[] =
+SR_ s_318[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -128} }, 
+    { {       0}, { -139} }, 
 };
 
-SR_ s_309[] =
+SR_ s_319[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 321} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 331} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -4855,22 +5331,22 @@ SR_ s_309[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_310[] =
+SR_ s_320[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -111} }, 
+    { {       0}, { -122} }, 
 };
 
-SR_ s_311[] =
+SR_ s_321[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -112} }, 
+    { {       0}, { -123} }, 
 };
 
-SR_ s_312[] =
+SR_ s_322[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        41}, { 322} }, // ')'
+    { { REQ_TOKEN}, {  22} },       
+    { {        41}, { 332} }, // ')'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -4879,47 +5355,52 @@ SR_ s_312[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_313[] =
+SR_ s_323[] =
 {
     { { ERR_REQ}, {  49} },                        
-    { {     362}, { 323} }, // statement           
-    { {     363}, {  48} }, // statement_          
+    { {     363}, { 333} }, // statement           
+    { {     364}, {  48} }, // statement_          
     { { errTok_}, {  49} }, // errTok_             
     { {      59}, {  50} }, // ';'                 
-    { {     364}, {  51} }, // expression          
-    { {     366}, {  52} }, // static_assert       
-    { {     357}, {  53} }, // scope_block         
-    { {     378}, {  54} }, // for_statement       
-    { {     379}, {  55} }, // if_statement        
-    { {     380}, {  56} }, // while_statement     
-    { {     381}, {  57} }, // switch_statement    
-    { {     375}, {  58} }, // break_statement     
-    { {     376}, {  59} }, // continue_statement  
-    { {     377}, {  60} }, // return_statement    
-    { {     385}, {  61} }, // variable_declaration
-    { {     367}, {  62} }, // variable            
+    { {     365}, {  51} }, // expression          
+    { {     367}, {  52} }, // static_assert       
+    { {     358}, {  53} }, // scope_block         
+    { {     379}, {  54} }, // for_statement       
+    { {     380}, {  55} }, // if_statement        
+    { {     381}, {  56} }, // while_statement     
+    { {     382}, {  57} }, // switch_statement    
+    { {     376}, {  58} }, // break_statement     
+    { {     377}, {  59} }, // continue_statement  
+    { {     378}, {  60} }, // return_statement    
+    { {     386}, {  61} }, // variable_declaration
+    { {     368}, {  62} }, // variable            
     { {      45}, {  63} }, // '-'                 
-    { {     370}, {  64} }, // array_element       
-    { {     369}, {  65} }, // constant_literal    
-    { {     371}, {  66} }, // string_literal      
-    { {     372}, {  67} }, // anonymous_array     
-    { {     373}, {  68} }, // anonymous_struct    
-    { {     374}, {  69} }, // function_call       
-    { {     365}, {  70} }, // builtin_function    
+    { {     371}, {  64} }, // array_element       
+    { {     370}, {  65} }, // constant_literal    
+    { {     372}, {  66} }, // string_literal      
+    { {     373}, {  67} }, // anonymous_array     
+    { {     374}, {  68} }, // anonymous_struct    
+    { {     375}, {  69} }, // function_call       
+    { {     366}, {  70} }, // builtin_function    
     { {     264}, {  71} }, // SIZEOF              
     { {      40}, {  72} }, // '('                 
-    { {     301}, {  73} }, // INC                 
-    { {     302}, {  74} }, // DEC                 
+    { {     304}, {  73} }, // INC                 
+    { {     305}, {  74} }, // DEC                 
     { {      33}, {  75} }, // '!'                 
     { {     276}, {  76} }, // ASSERT              
     { {     123}, {  18} }, // '{'                 
@@ -4931,11 +5412,11 @@ SR_ s_313[] =
     { {     274}, {  82} }, // CONTINUE            
     { {     275}, {  83} }, // RETURN              
     { {     257}, {  84} }, // LET                 
-    { {     303}, {  85} }, // IDENT               
-    { {     368}, {  86} }, // field               
-    { {     305}, {  87} }, // NUM                 
-    { {     306}, {  88} }, // CHR                 
-    { {     304}, {  89} }, // STR                 
+    { {     306}, {  85} }, // IDENT               
+    { {     369}, {  86} }, // field               
+    { {     308}, {  87} }, // NUM                 
+    { {     309}, {  88} }, // CHR                 
+    { {     307}, {  89} }, // STR                 
     { {      35}, {  90} }, // '#'                 
     { {     262}, {  91} }, // PRINT               
     { {     261}, {  92} }, // SCAN                
@@ -4943,31 +5424,31 @@ SR_ s_313[] =
     { {       0}, {   0} },                        
 };
 
-SR_ s_314[] =
+SR_ s_324[] =
 {
     { { REQ_TOKEN}, {  27} },                        
-    { {       364}, { 324} }, // expression          
-    { {       385}, {  61} }, // variable_declaration
-    { {       367}, {  62} }, // variable            
+    { {       365}, { 334} }, // expression          
+    { {       386}, {  61} }, // variable_declaration
+    { {       368}, {  62} }, // variable            
     { {        45}, {  63} }, // '-'                 
-    { {       370}, {  64} }, // array_element       
-    { {       369}, {  65} }, // constant_literal    
-    { {       371}, {  66} }, // string_literal      
-    { {       372}, {  67} }, // anonymous_array     
-    { {       373}, {  68} }, // anonymous_struct    
-    { {       374}, {  69} }, // function_call       
-    { {       365}, {  70} }, // builtin_function    
+    { {       371}, {  64} }, // array_element       
+    { {       370}, {  65} }, // constant_literal    
+    { {       372}, {  66} }, // string_literal      
+    { {       373}, {  67} }, // anonymous_array     
+    { {       374}, {  68} }, // anonymous_struct    
+    { {       375}, {  69} }, // function_call       
+    { {       366}, {  70} }, // builtin_function    
     { {       264}, {  71} }, // SIZEOF              
     { {        40}, {  72} }, // '('                 
-    { {       301}, {  73} }, // INC                 
-    { {       302}, {  74} }, // DEC                 
+    { {       304}, {  73} }, // INC                 
+    { {       305}, {  74} }, // DEC                 
     { {        33}, {  75} }, // '!'                 
     { {       257}, {  84} }, // LET                 
-    { {       303}, {  85} }, // IDENT               
-    { {       368}, {  86} }, // field               
-    { {       305}, {  87} }, // NUM                 
-    { {       306}, {  88} }, // CHR                 
-    { {       304}, {  89} }, // STR                 
+    { {       306}, {  85} }, // IDENT               
+    { {       369}, {  86} }, // field               
+    { {       308}, {  87} }, // NUM                 
+    { {       309}, {  88} }, // CHR                 
+    { {       307}, {  89} }, // STR                 
     { {        35}, {  90} }, // '#'                 
     { {       262}, {  91} }, // PRINT               
     { {       261}, {  92} }, // SCAN                
@@ -4975,10 +5456,10 @@ SR_ s_314[] =
     { {         0}, {   0} },                        
 };
 
-SR_ s_315[] =
+SR_ s_325[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        41}, { 325} }, // ')'
+    { { REQ_TOKEN}, {  22} },       
+    { {        41}, { 335} }, // ')'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -4987,52 +5468,57 @@ SR_ s_315[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_316[] =
+SR_ s_326[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -123} }, 
+    { {       0}, { -134} }, 
 };
 
-SR_ s_317[] =
+SR_ s_327[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -126} }, 
+    { {       0}, { -137} }, 
 };
 
-SR_ s_318[] =
+SR_ s_328[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {       125}, { 326} }, // '}'
+    { {       125}, { 336} }, // '}'
     { {         0}, {   0} },       
 };
 
-SR_ s_319[] =
+SR_ s_329[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -129} }, 
+    { {       0}, { -140} }, 
 };
 
-SR_ s_320[] =
+SR_ s_330[] =
 {
     { { REQ_TOKEN}, {   2} },       
-    { {        58}, { 327} }, // ':'
+    { {        58}, { 337} }, // ':'
     { {         0}, {   0} },       
 };
 
-SR_ s_321[] =
+SR_ s_331[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        58}, { 328} }, // ':'
+    { { REQ_TOKEN}, {  22} },       
+    { {        58}, { 338} }, // ':'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -5041,47 +5527,52 @@ SR_ s_321[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_322[] =
+SR_ s_332[] =
 {
     { { ERR_REQ}, {  49} },                        
-    { {     362}, { 329} }, // statement           
-    { {     363}, {  48} }, // statement_          
+    { {     363}, { 339} }, // statement           
+    { {     364}, {  48} }, // statement_          
     { { errTok_}, {  49} }, // errTok_             
     { {      59}, {  50} }, // ';'                 
-    { {     364}, {  51} }, // expression          
-    { {     366}, {  52} }, // static_assert       
-    { {     357}, {  53} }, // scope_block         
-    { {     378}, {  54} }, // for_statement       
-    { {     379}, {  55} }, // if_statement        
-    { {     380}, {  56} }, // while_statement     
-    { {     381}, {  57} }, // switch_statement    
-    { {     375}, {  58} }, // break_statement     
-    { {     376}, {  59} }, // continue_statement  
-    { {     377}, {  60} }, // return_statement    
-    { {     385}, {  61} }, // variable_declaration
-    { {     367}, {  62} }, // variable            
+    { {     365}, {  51} }, // expression          
+    { {     367}, {  52} }, // static_assert       
+    { {     358}, {  53} }, // scope_block         
+    { {     379}, {  54} }, // for_statement       
+    { {     380}, {  55} }, // if_statement        
+    { {     381}, {  56} }, // while_statement     
+    { {     382}, {  57} }, // switch_statement    
+    { {     376}, {  58} }, // break_statement     
+    { {     377}, {  59} }, // continue_statement  
+    { {     378}, {  60} }, // return_statement    
+    { {     386}, {  61} }, // variable_declaration
+    { {     368}, {  62} }, // variable            
     { {      45}, {  63} }, // '-'                 
-    { {     370}, {  64} }, // array_element       
-    { {     369}, {  65} }, // constant_literal    
-    { {     371}, {  66} }, // string_literal      
-    { {     372}, {  67} }, // anonymous_array     
-    { {     373}, {  68} }, // anonymous_struct    
-    { {     374}, {  69} }, // function_call       
-    { {     365}, {  70} }, // builtin_function    
+    { {     371}, {  64} }, // array_element       
+    { {     370}, {  65} }, // constant_literal    
+    { {     372}, {  66} }, // string_literal      
+    { {     373}, {  67} }, // anonymous_array     
+    { {     374}, {  68} }, // anonymous_struct    
+    { {     375}, {  69} }, // function_call       
+    { {     366}, {  70} }, // builtin_function    
     { {     264}, {  71} }, // SIZEOF              
     { {      40}, {  72} }, // '('                 
-    { {     301}, {  73} }, // INC                 
-    { {     302}, {  74} }, // DEC                 
+    { {     304}, {  73} }, // INC                 
+    { {     305}, {  74} }, // DEC                 
     { {      33}, {  75} }, // '!'                 
     { {     276}, {  76} }, // ASSERT              
     { {     123}, {  18} }, // '{'                 
@@ -5093,11 +5584,11 @@ SR_ s_322[] =
     { {     274}, {  82} }, // CONTINUE            
     { {     275}, {  83} }, // RETURN              
     { {     257}, {  84} }, // LET                 
-    { {     303}, {  85} }, // IDENT               
-    { {     368}, {  86} }, // field               
-    { {     305}, {  87} }, // NUM                 
-    { {     306}, {  88} }, // CHR                 
-    { {     304}, {  89} }, // STR                 
+    { {     306}, {  85} }, // IDENT               
+    { {     369}, {  86} }, // field               
+    { {     308}, {  87} }, // NUM                 
+    { {     309}, {  88} }, // CHR                 
+    { {     307}, {  89} }, // STR                 
     { {      35}, {  90} }, // '#'                 
     { {     262}, {  91} }, // PRINT               
     { {     261}, {  92} }, // SCAN                
@@ -5105,16 +5596,16 @@ SR_ s_322[] =
     { {       0}, {   0} },                        
 };
 
-SR_ s_323[] =
+SR_ s_333[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -120} }, 
+    { {       0}, { -131} }, 
 };
 
-SR_ s_324[] =
+SR_ s_334[] =
 {
-    { { REQ_TOKEN}, {  17} },       
-    { {        41}, { 330} }, // ')'
+    { { REQ_TOKEN}, {  22} },       
+    { {        41}, { 340} }, // ')'
     { {        43}, { 118} }, // '+'
     { {        45}, { 119} }, // '-'
     { {        42}, { 120} }, // '*'
@@ -5123,47 +5614,52 @@ SR_ s_324[] =
     { {        37}, { 123} }, // '%'
     { {        60}, { 124} }, // '<'
     { {        62}, { 125} }, // '>'
-    { {       298}, { 126} }, // LE 
-    { {       299}, { 127} }, // GE 
-    { {       297}, { 128} }, // NE 
-    { {       296}, { 129} }, // EQ 
+    { {       299}, { 126} }, // LE 
+    { {       300}, { 127} }, // GE 
+    { {       298}, { 128} }, // NE 
+    { {       297}, { 129} }, // EQ 
     { {       295}, { 130} }, // AND
     { {       294}, { 131} }, // OR 
-    { {        91}, { 132} }, // '['
+    { {        38}, { 132} }, // '&'
+    { {       124}, { 133} }, // '|'
+    { {       296}, { 134} }, // XOR
+    { {       301}, { 135} }, // SHL
+    { {       302}, { 136} }, // SHR
+    { {        91}, { 137} }, // '['
     { {         0}, {   0} },       
 };
 
-SR_ s_325[] =
+SR_ s_335[] =
 {
     { { ERR_REQ}, {  49} },                        
-    { {     362}, { 331} }, // statement           
-    { {     363}, {  48} }, // statement_          
+    { {     363}, { 341} }, // statement           
+    { {     364}, {  48} }, // statement_          
     { { errTok_}, {  49} }, // errTok_             
     { {      59}, {  50} }, // ';'                 
-    { {     364}, {  51} }, // expression          
-    { {     366}, {  52} }, // static_assert       
-    { {     357}, {  53} }, // scope_block         
-    { {     378}, {  54} }, // for_statement       
-    { {     379}, {  55} }, // if_statement        
-    { {     380}, {  56} }, // while_statement     
-    { {     381}, {  57} }, // switch_statement    
-    { {     375}, {  58} }, // break_statement     
-    { {     376}, {  59} }, // continue_statement  
-    { {     377}, {  60} }, // return_statement    
-    { {     385}, {  61} }, // variable_declaration
-    { {     367}, {  62} }, // variable            
+    { {     365}, {  51} }, // expression          
+    { {     367}, {  52} }, // static_assert       
+    { {     358}, {  53} }, // scope_block         
+    { {     379}, {  54} }, // for_statement       
+    { {     380}, {  55} }, // if_statement        
+    { {     381}, {  56} }, // while_statement     
+    { {     382}, {  57} }, // switch_statement    
+    { {     376}, {  58} }, // break_statement     
+    { {     377}, {  59} }, // continue_statement  
+    { {     378}, {  60} }, // return_statement    
+    { {     386}, {  61} }, // variable_declaration
+    { {     368}, {  62} }, // variable            
     { {      45}, {  63} }, // '-'                 
-    { {     370}, {  64} }, // array_element       
-    { {     369}, {  65} }, // constant_literal    
-    { {     371}, {  66} }, // string_literal      
-    { {     372}, {  67} }, // anonymous_array     
-    { {     373}, {  68} }, // anonymous_struct    
-    { {     374}, {  69} }, // function_call       
-    { {     365}, {  70} }, // builtin_function    
+    { {     371}, {  64} }, // array_element       
+    { {     370}, {  65} }, // constant_literal    
+    { {     372}, {  66} }, // string_literal      
+    { {     373}, {  67} }, // anonymous_array     
+    { {     374}, {  68} }, // anonymous_struct    
+    { {     375}, {  69} }, // function_call       
+    { {     366}, {  70} }, // builtin_function    
     { {     264}, {  71} }, // SIZEOF              
     { {      40}, {  72} }, // '('                 
-    { {     301}, {  73} }, // INC                 
-    { {     302}, {  74} }, // DEC                 
+    { {     304}, {  73} }, // INC                 
+    { {     305}, {  74} }, // DEC                 
     { {      33}, {  75} }, // '!'                 
     { {     276}, {  76} }, // ASSERT              
     { {     123}, {  18} }, // '{'                 
@@ -5175,11 +5671,11 @@ SR_ s_325[] =
     { {     274}, {  82} }, // CONTINUE            
     { {     275}, {  83} }, // RETURN              
     { {     257}, {  84} }, // LET                 
-    { {     303}, {  85} }, // IDENT               
-    { {     368}, {  86} }, // field               
-    { {     305}, {  87} }, // NUM                 
-    { {     306}, {  88} }, // CHR                 
-    { {     304}, {  89} }, // STR                 
+    { {     306}, {  85} }, // IDENT               
+    { {     369}, {  86} }, // field               
+    { {     308}, {  87} }, // NUM                 
+    { {     309}, {  88} }, // CHR                 
+    { {     307}, {  89} }, // STR                 
     { {      35}, {  90} }, // '#'                 
     { {     262}, {  91} }, // PRINT               
     { {     261}, {  92} }, // SCAN                
@@ -5187,202 +5683,372 @@ SR_ s_325[] =
     { {       0}, {   0} },                        
 };
 
-SR_ s_326[] =
+SR_ s_336[] =
 {
     { { DEF_RED}, {    1} }, 
-    { {       0}, { -127} }, 
+    { {       0}, { -138} }, 
+};
+
+SR_ s_337[] =
+{
+    { { ERR_REQ}, {  49} },                        
+    { {     363}, { 342} }, // statement           
+    { {     364}, {  48} }, // statement_          
+    { { errTok_}, {  49} }, // errTok_             
+    { {      59}, {  50} }, // ';'                 
+    { {     365}, {  51} }, // expression          
+    { {     367}, {  52} }, // static_assert       
+    { {     358}, {  53} }, // scope_block         
+    { {     379}, {  54} }, // for_statement       
+    { {     380}, {  55} }, // if_statement        
+    { {     381}, {  56} }, // while_statement     
+    { {     382}, {  57} }, // switch_statement    
+    { {     376}, {  58} }, // break_statement     
+    { {     377}, {  59} }, // continue_statement  
+    { {     378}, {  60} }, // return_statement    
+    { {     386}, {  61} }, // variable_declaration
+    { {     368}, {  62} }, // variable            
+    { {      45}, {  63} }, // '-'                 
+    { {     371}, {  64} }, // array_element       
+    { {     370}, {  65} }, // constant_literal    
+    { {     372}, {  66} }, // string_literal      
+    { {     373}, {  67} }, // anonymous_array     
+    { {     374}, {  68} }, // anonymous_struct    
+    { {     375}, {  69} }, // function_call       
+    { {     366}, {  70} }, // builtin_function    
+    { {     264}, {  71} }, // SIZEOF              
+    { {      40}, {  72} }, // '('                 
+    { {     304}, {  73} }, // INC                 
+    { {     305}, {  74} }, // DEC                 
+    { {      33}, {  75} }, // '!'                 
+    { {     276}, {  76} }, // ASSERT              
+    { {     123}, {  18} }, // '{'                 
+    { {     265}, {  77} }, // FOR                 
+    { {     266}, {  78} }, // IF                  
+    { {     267}, {  79} }, // WHILE               
+    { {     269}, {  80} }, // SWITCH              
+    { {     273}, {  81} }, // BREAK               
+    { {     274}, {  82} }, // CONTINUE            
+    { {     275}, {  83} }, // RETURN              
+    { {     257}, {  84} }, // LET                 
+    { {     306}, {  85} }, // IDENT               
+    { {     369}, {  86} }, // field               
+    { {     308}, {  87} }, // NUM                 
+    { {     309}, {  88} }, // CHR                 
+    { {     307}, {  89} }, // STR                 
+    { {      35}, {  90} }, // '#'                 
+    { {     262}, {  91} }, // PRINT               
+    { {     261}, {  92} }, // SCAN                
+    { {     263}, {  93} }, // RAND                
+    { {       0}, {   0} },                        
+};
+
+SR_ s_338[] =
+{
+    { { ERR_REQ}, {  49} },                        
+    { {     363}, { 343} }, // statement           
+    { {     364}, {  48} }, // statement_          
+    { { errTok_}, {  49} }, // errTok_             
+    { {      59}, {  50} }, // ';'                 
+    { {     365}, {  51} }, // expression          
+    { {     367}, {  52} }, // static_assert       
+    { {     358}, {  53} }, // scope_block         
+    { {     379}, {  54} }, // for_statement       
+    { {     380}, {  55} }, // if_statement        
+    { {     381}, {  56} }, // while_statement     
+    { {     382}, {  57} }, // switch_statement    
+    { {     376}, {  58} }, // break_statement     
+    { {     377}, {  59} }, // continue_statement  
+    { {     378}, {  60} }, // return_statement    
+    { {     386}, {  61} }, // variable_declaration
+    { {     368}, {  62} }, // variable            
+    { {      45}, {  63} }, // '-'                 
+    { {     371}, {  64} }, // array_element       
+    { {     370}, {  65} }, // constant_literal    
+    { {     372}, {  66} }, // string_literal      
+    { {     373}, {  67} }, // anonymous_array     
+    { {     374}, {  68} }, // anonymous_struct    
+    { {     375}, {  69} }, // function_call       
+    { {     366}, {  70} }, // builtin_function    
+    { {     264}, {  71} }, // SIZEOF              
+    { {      40}, {  72} }, // '('                 
+    { {     304}, {  73} }, // INC                 
+    { {     305}, {  74} }, // DEC                 
+    { {      33}, {  75} }, // '!'                 
+    { {     276}, {  76} }, // ASSERT              
+    { {     123}, {  18} }, // '{'                 
+    { {     265}, {  77} }, // FOR                 
+    { {     266}, {  78} }, // IF                  
+    { {     267}, {  79} }, // WHILE               
+    { {     269}, {  80} }, // SWITCH              
+    { {     273}, {  81} }, // BREAK               
+    { {     274}, {  82} }, // CONTINUE            
+    { {     275}, {  83} }, // RETURN              
+    { {     257}, {  84} }, // LET                 
+    { {     306}, {  85} }, // IDENT               
+    { {     369}, {  86} }, // field               
+    { {     308}, {  87} }, // NUM                 
+    { {     309}, {  88} }, // CHR                 
+    { {     307}, {  89} }, // STR                 
+    { {      35}, {  90} }, // '#'                 
+    { {     262}, {  91} }, // PRINT               
+    { {     261}, {  92} }, // SCAN                
+    { {     263}, {  93} }, // RAND                
+    { {       0}, {   0} },                        
+};
+
+SR_ s_339[] =
+{
+    { { DEF_RED}, {    1} }, 
+    { {       0}, { -129} }, 
+};
+
+SR_ s_340[] =
+{
+    { { ERR_REQ}, {  49} },                        
+    { {     363}, { 344} }, // statement           
+    { {     364}, {  48} }, // statement_          
+    { { errTok_}, {  49} }, // errTok_             
+    { {      59}, {  50} }, // ';'                 
+    { {     365}, {  51} }, // expression          
+    { {     367}, {  52} }, // static_assert       
+    { {     358}, {  53} }, // scope_block         
+    { {     379}, {  54} }, // for_statement       
+    { {     380}, {  55} }, // if_statement        
+    { {     381}, {  56} }, // while_statement     
+    { {     382}, {  57} }, // switch_statement    
+    { {     376}, {  58} }, // break_statement     
+    { {     377}, {  59} }, // continue_statement  
+    { {     378}, {  60} }, // return_statement    
+    { {     386}, {  61} }, // variable_declaration
+    { {     368}, {  62} }, // variable            
+    { {      45}, {  63} }, // '-'                 
+    { {     371}, {  64} }, // array_element       
+    { {     370}, {  65} }, // constant_literal    
+    { {     372}, {  66} }, // string_literal      
+    { {     373}, {  67} }, // anonymous_array     
+    { {     374}, {  68} }, // anonymous_struct    
+    { {     375}, {  69} }, // function_call       
+    { {     366}, {  70} }, // builtin_function    
+    { {     264}, {  71} }, // SIZEOF              
+    { {      40}, {  72} }, // '('                 
+    { {     304}, {  73} }, // INC                 
+    { {     305}, {  74} }, // DEC                 
+    { {      33}, {  75} }, // '!'                 
+    { {     276}, {  76} }, // ASSERT              
+    { {     123}, {  18} }, // '{'                 
+    { {     265}, {  77} }, // FOR                 
+    { {     266}, {  78} }, // IF                  
+    { {     267}, {  79} }, // WHILE               
+    { {     269}, {  80} }, // SWITCH              
+    { {     273}, {  81} }, // BREAK               
+    { {     274}, {  82} }, // CONTINUE            
+    { {     275}, {  83} }, // RETURN              
+    { {     257}, {  84} }, // LET                 
+    { {     306}, {  85} }, // IDENT               
+    { {     369}, {  86} }, // field               
+    { {     308}, {  87} }, // NUM                 
+    { {     309}, {  88} }, // CHR                 
+    { {     307}, {  89} }, // STR                 
+    { {      35}, {  90} }, // '#'                 
+    { {     262}, {  91} }, // PRINT               
+    { {     261}, {  92} }, // SCAN                
+    { {     263}, {  93} }, // RAND                
+    { {       0}, {   0} },                        
+};
+
+SR_ s_341[] =
+{
+    { { DEF_RED}, {    1} }, 
+    { {       0}, { -132} }, 
+};
+
+SR_ s_342[] =
+{
+    { { DEF_RED}, {    1} }, 
+    { {       0}, { -142} }, 
+};
+
+SR_ s_343[] =
+{
+    { { DEF_RED}, {    1} }, 
+    { {       0}, { -141} }, 
+};
+
+SR_ s_344[] =
+{
+    { { DEF_RED}, {    1} }, 
+    { {       0}, { -130} }, 
+};
+
+SR_ s_345[] =
+{
+    { { REQ_TOKEN}, {   3} },         
+    { {       308}, { 346} }, // NUM  
+    { {       306}, { 347} }, // IDENT
+    { {         0}, {   0} },         
+};
+
+SR_ s_346[] =
+{
+    { { REQ_TOKEN}, {   2} },       
+    { {        93}, { 348} }, // ']'
+    { {         0}, {   0} },       
+};
+
+SR_ s_347[] =
+{
+    { { REQ_TOKEN}, {   2} },       
+    { {        93}, { 349} }, // ']'
+    { {         0}, {   0} },       
+};
+
+SR_ s_348[] =
+{
+    { { REQ_TOKEN}, {   2} },         
+    { {       306}, { 350} }, // IDENT
+    { {         0}, {   0} },         
+};
+
+SR_ s_349[] =
+{
+    { { REQ_TOKEN}, {   2} },         
+    { {       306}, { 351} }, // IDENT
+    { {         0}, {   0} },         
+};
+
+SR_ s_350[] =
+{
+    { { REQ_TOKEN}, {   2} },       
+    { {        61}, { 352} }, // '='
+    { {         0}, {   0} },       
+};
+
+SR_ s_351[] =
+{
+    { { REQ_TOKEN}, {   2} },       
+    { {        61}, { 353} }, // '='
+    { {         0}, {   0} },       
+};
+
+SR_ s_352[] =
+{
+    { { REQ_TOKEN}, {   2} },       
+    { {        35}, { 354} }, // '#'
+    { {         0}, {   0} },       
+};
+
+SR_ s_353[] =
+{
+    { { REQ_TOKEN}, {   2} },       
+    { {        35}, { 355} }, // '#'
+    { {         0}, {   0} },       
+};
+
+SR_ s_354[] =
+{
+    { { REQ_TOKEN}, {   2} },       
+    { {       123}, { 356} }, // '{'
+    { {         0}, {   0} },       
+};
+
+SR_ s_355[] =
+{
+    { { REQ_TOKEN}, {   2} },       
+    { {       123}, { 357} }, // '{'
+    { {         0}, {   0} },       
+};
+
+SR_ s_356[] =
+{
+    { { REQ_TOKEN}, {   4} },               
+    { {       353}, { 358} }, // const_table
+    { {       308}, { 359} }, // NUM        
+    { {       309}, { 360} }, // CHR        
+    { {         0}, {   0} },               
+};
+
+SR_ s_357[] =
+{
+    { { REQ_TOKEN}, {   4} },               
+    { {       353}, { 361} }, // const_table
+    { {       308}, { 359} }, // NUM        
+    { {       309}, { 360} }, // CHR        
+    { {         0}, {   0} },               
+};
+
+SR_ s_358[] =
+{
+    { { REQ_TOKEN}, {   3} },       
+    { {       125}, { 362} }, // '}'
+    { {        44}, { 363} }, // ','
+    { {         0}, {   0} },       
+};
+
+SR_ s_359[] =
+{
+    { { DEF_RED}, {   1} }, 
+    { {       0}, { -17} }, 
+};
+
+SR_ s_360[] =
+{
+    { { DEF_RED}, {   1} }, 
+    { {       0}, { -18} }, 
 };
 
-SR_ s_327[] =
+SR_ s_361[] =
 {
-    { { ERR_REQ}, {  49} },                        
-    { {     362}, { 332} }, // statement           
-    { {     363}, {  48} }, // statement_          
-    { { errTok_}, {  49} }, // errTok_             
-    { {      59}, {  50} }, // ';'                 
-    { {     364}, {  51} }, // expression          
-    { {     366}, {  52} }, // static_assert       
-    { {     357}, {  53} }, // scope_block         
-    { {     378}, {  54} }, // for_statement       
-    { {     379}, {  55} }, // if_statement        
-    { {     380}, {  56} }, // while_statement     
-    { {     381}, {  57} }, // switch_statement    
-    { {     375}, {  58} }, // break_statement     
-    { {     376}, {  59} }, // continue_statement  
-    { {     377}, {  60} }, // return_statement    
-    { {     385}, {  61} }, // variable_declaration
-    { {     367}, {  62} }, // variable            
-    { {      45}, {  63} }, // '-'                 
-    { {     370}, {  64} }, // array_element       
-    { {     369}, {  65} }, // constant_literal    
-    { {     371}, {  66} }, // string_literal      
-    { {     372}, {  67} }, // anonymous_array     
-    { {     373}, {  68} }, // anonymous_struct    
-    { {     374}, {  69} }, // function_call       
-    { {     365}, {  70} }, // builtin_function    
-    { {     264}, {  71} }, // SIZEOF              
-    { {      40}, {  72} }, // '('                 
-    { {     301}, {  73} }, // INC                 
-    { {     302}, {  74} }, // DEC                 
-    { {      33}, {  75} }, // '!'                 
-    { {     276}, {  76} }, // ASSERT              
-    { {     123}, {  18} }, // '{'                 
-    { {     265}, {  77} }, // FOR                 
-    { {     266}, {  78} }, // IF                  
-    { {     267}, {  79} }, // WHILE               
-    { {     269}, {  80} }, // SWITCH              
-    { {     273}, {  81} }, // BREAK               
-    { {     274}, {  82} }, // CONTINUE            
-    { {     275}, {  83} }, // RETURN              
-    { {     257}, {  84} }, // LET                 
-    { {     303}, {  85} }, // IDENT               
-    { {     368}, {  86} }, // field               
-    { {     305}, {  87} }, // NUM                 
-    { {     306}, {  88} }, // CHR                 
-    { {     304}, {  89} }, // STR                 
-    { {      35}, {  90} }, // '#'                 
-    { {     262}, {  91} }, // PRINT               
-    { {     261}, {  92} }, // SCAN                
-    { {     263}, {  93} }, // RAND                
-    { {       0}, {   0} },                        
+    { { REQ_TOKEN}, {   3} },       
+    { {       125}, { 364} }, // '}'
+    { {        44}, { 363} }, // ','
+    { {         0}, {   0} },       
 };
 
-SR_ s_328[] =
+SR_ s_362[] =
 {
-    { { ERR_REQ}, {  49} },                        
-    { {     362}, { 333} }, // statement           
-    { {     363}, {  48} }, // statement_          
-    { { errTok_}, {  49} }, // errTok_             
-    { {      59}, {  50} }, // ';'                 
-    { {     364}, {  51} }, // expression          
-    { {     366}, {  52} }, // static_assert       
-    { {     357}, {  53} }, // scope_block         
-    { {     378}, {  54} }, // for_statement       
-    { {     379}, {  55} }, // if_statement        
-    { {     380}, {  56} }, // while_statement     
-    { {     381}, {  57} }, // switch_statement    
-    { {     375}, {  58} }, // break_statement     
-    { {     376}, {  59} }, // continue_statement  
-    { {     377}, {  60} }, // return_statement    
-    { {     385}, {  61} }, // variable_declaration
-    { {     367}, {  62} }, // variable            
-    { {      45}, {  63} }, // '-'                 
-    { {     370}, {  64} }, // array_element       
-    { {     369}, {  65} }, // constant_literal    
-    { {     371}, {  66} }, // string_literal      
-    { {     372}, {  67} }, // anonymous_array     
-    { {     373}, {  68} }, // anonymous_struct    
-    { {     374}, {  69} }, // function_call       
-    { {     365}, {  70} }, // builtin_function    
-    { {     264}, {  71} }, // SIZEOF              
-    { {      40}, {  72} }, // '('                 
-    { {     301}, {  73} }, // INC                 
-    { {     302}, {  74} }, // DEC                 
-    { {      33}, {  75} }, // '!'                 
-    { {     276}, {  76} }, // ASSERT              
-    { {     123}, {  18} }, // '{'                 
-    { {     265}, {  77} }, // FOR                 
-    { {     266}, {  78} }, // IF                  
-    { {     267}, {  79} }, // WHILE               
-    { {     269}, {  80} }, // SWITCH              
-    { {     273}, {  81} }, // BREAK               
-    { {     274}, {  82} }, // CONTINUE            
-    { {     275}, {  83} }, // RETURN              
-    { {     257}, {  84} }, // LET                 
-    { {     303}, {  85} }, // IDENT               
-    { {     368}, {  86} }, // field               
-    { {     305}, {  87} }, // NUM                 
-    { {     306}, {  88} }, // CHR                 
-    { {     304}, {  89} }, // STR                 
-    { {      35}, {  90} }, // '#'                 
-    { {     262}, {  91} }, // PRINT               
-    { {     261}, {  92} }, // SCAN                
-    { {     263}, {  93} }, // RAND                
-    { {       0}, {   0} },                        
+    { { REQ_TOKEN}, {   2} },       
+    { {        59}, { 365} }, // ';'
+    { {         0}, {   0} },       
 };
 
-SR_ s_329[] =
+SR_ s_363[] =
 {
-    { { DEF_RED}, {    1} }, 
-    { {       0}, { -118} }, 
+    { { REQ_TOKEN}, {   3} },       
+    { {       308}, { 366} }, // NUM
+    { {       309}, { 367} }, // CHR
+    { {         0}, {   0} },       
 };
 
-SR_ s_330[] =
+SR_ s_364[] =
 {
-    { { ERR_REQ}, {  49} },                        
-    { {     362}, { 334} }, // statement           
-    { {     363}, {  48} }, // statement_          
-    { { errTok_}, {  49} }, // errTok_             
-    { {      59}, {  50} }, // ';'                 
-    { {     364}, {  51} }, // expression          
-    { {     366}, {  52} }, // static_assert       
-    { {     357}, {  53} }, // scope_block         
-    { {     378}, {  54} }, // for_statement       
-    { {     379}, {  55} }, // if_statement        
-    { {     380}, {  56} }, // while_statement     
-    { {     381}, {  57} }, // switch_statement    
-    { {     375}, {  58} }, // break_statement     
-    { {     376}, {  59} }, // continue_statement  
-    { {     377}, {  60} }, // return_statement    
-    { {     385}, {  61} }, // variable_declaration
-    { {     367}, {  62} }, // variable            
-    { {      45}, {  63} }, // '-'                 
-    { {     370}, {  64} }, // array_element       
-    { {     369}, {  65} }, // constant_literal    
-    { {     371}, {  66} }, // string_literal      
-    { {     372}, {  67} }, // anonymous_array     
-    { {     373}, {  68} }, // anonymous_struct    
-    { {     374}, {  69} }, // function_call       
-    { {     365}, {  70} }, // builtin_function    
-    { {     264}, {  71} }, // SIZEOF              
-    { {      40}, {  72} }, // '('                 
-    { {     301}, {  73} }, // INC                 
-    { {     302}, {  74} }, // DEC                 
-    { {      33}, {  75} }, // '!'                 
-    { {     276}, {  76} }, // ASSERT              
-    { {     123}, {  18} }, // '{'                 
-    { {     265}, {  77} }, // FOR                 
-    { {     266}, {  78} }, // IF                  
-    { {     267}, {  79} }, // WHILE               
-    { {     269}, {  80} }, // SWITCH              
-    { {     273}, {  81} }, // BREAK               
-    { {     274}, {  82} }, // CONTINUE            
-    { {     275}, {  83} }, // RETURN              
-    { {     257}, {  84} }, // LET                 
-    { {     303}, {  85} }, // IDENT               
-    { {     368}, {  86} }, // field               
-    { {     305}, {  87} }, // NUM                 
-    { {     306}, {  88} }, // CHR                 
-    { {     304}, {  89} }, // STR                 
-    { {      35}, {  90} }, // '#'                 
-    { {     262}, {  91} }, // PRINT               
-    { {     261}, {  92} }, // SCAN                
-    { {     263}, {  93} }, // RAND                
-    { {       0}, {   0} },                        
+    { { REQ_TOKEN}, {   2} },       
+    { {        59}, { 368} }, // ';'
+    { {         0}, {   0} },       
 };
 
-SR_ s_331[] =
+SR_ s_365[] =
 {
-    { { DEF_RED}, {    1} }, 
-    { {       0}, { -121} }, 
+    { { DEF_RED}, {   1} }, 
+    { {       0}, { -15} }, 
 };
 
-SR_ s_332[] =
+SR_ s_366[] =
 {
-    { { DEF_RED}, {    1} }, 
-    { {       0}, { -131} }, 
+    { { DEF_RED}, {   1} }, 
+    { {       0}, { -19} }, 
 };
 
-SR_ s_333[] =
+SR_ s_367[] =
 {
-    { { DEF_RED}, {    1} }, 
-    { {       0}, { -130} }, 
+    { { DEF_RED}, {   1} }, 
+    { {       0}, { -20} }, 
 };
 
-SR_ s_334[] =
+SR_ s_368[] =
 {
-    { { DEF_RED}, {    1} }, 
-    { {       0}, { -119} }, 
+    { { DEF_RED}, {   1} }, 
+    { {       0}, { -16} }, 
 };
 
 
@@ -5422,7 +6088,10 @@ SR_ *s_state[] =
   s_300,  s_301,  s_302,  s_303,  s_304,  s_305,  s_306,  s_307,  s_308,  s_309,
   s_310,  s_311,  s_312,  s_313,  s_314,  s_315,  s_316,  s_317,  s_318,  s_319,
   s_320,  s_321,  s_322,  s_323,  s_324,  s_325,  s_326,  s_327,  s_328,  s_329,
-  s_330,  s_331,  s_332,  s_333,  s_334,
+  s_330,  s_331,  s_332,  s_333,  s_334,  s_335,  s_336,  s_337,  s_338,  s_339,
+  s_340,  s_341,  s_342,  s_343,  s_344,  s_345,  s_346,  s_347,  s_348,  s_349,
+  s_350,  s_351,  s_352,  s_353,  s_354,  s_355,  s_356,  s_357,  s_358,  s_359,
+  s_360,  s_361,  s_362,  s_363,  s_364,  s_365,  s_366,  s_367,  s_368,
 };
 
 } // anonymous namespace ends
@@ -5451,6 +6120,7 @@ char const *idOfTag_[] = {
     "TEST_VECTOR",
     "STRING_TUPLE",
     "INSTRUCTION_PAIR",
+    "INT_LIST",
     "<undefined>"
 };
 
@@ -5704,77 +6374,77 @@ try
         // $insert actioncases
         
         case 2:
-#line 102 "grammar"
+#line 108 "grammar"
         {
             d_val_ = std::move(vs_(-1));
         }
         break;
 
         case 3:
-#line 104 "grammar"
+#line 110 "grammar"
         {
             d_val_ = std::move(vs_(-1));
         }
         break;
 
         case 4:
-#line 106 "grammar"
+#line 112 "grammar"
         {
             d_val_ = std::move(vs_(-1));
         }
         break;
 
         case 5:
-#line 108 "grammar"
+#line 114 "grammar"
         {
             d_val_ = std::move(vs_(-1));
         }
         break;
 
         case 6:
-#line 110 "grammar"
+#line 116 "grammar"
         {
             d_val_ = std::move(vs_(-1));
         }
         break;
 
         case 7:
-#line 112 "grammar"
+#line 118 "grammar"
         {
             d_val_ = std::move(vs_(-1));
         }
         break;
 
         case 8:
-#line 114 "grammar"
+#line 120 "grammar"
         {
             d_val_ = std::move(vs_(-1));
         }
         break;
 
         case 9:
-#line 118 "grammar"
+#line 124 "grammar"
         {
          pushStream(vs_(0).get<Tag_::STRING>());
          }
         break;
 
         case 10:
-#line 125 "grammar"
+#line 131 "grammar"
         {
          addFunction((vs_(-1).get<Tag_::BFX_FUNCTION>()).setBody(vs_(0).get<Tag_::INSTRUCTION>()));
          }
         break;
 
         case 11:
-#line 132 "grammar"
+#line 138 "grammar"
         {
          d_val_ = BFXFunction(vs_(-3).get<Tag_::STRING>(), vs_(-1).get<Tag_::PARAMETER_LIST>());
          }
         break;
 
         case 12:
-#line 137 "grammar"
+#line 143 "grammar"
         {
          d_val_ = BFXFunction(vs_(-3).get<Tag_::STRING>(), vs_(-1).get<Tag_::PARAMETER_LIST>());
          (d_val_.get<Tag_::BFX_FUNCTION>()).setReturnVariable(vs_(-5).get<Tag_::STRING>());
@@ -5782,57 +6452,101 @@ try
         break;
 
         case 13:
-#line 145 "grammar"
+#line 151 "grammar"
         {
          addConstant(vs_(-3).get<Tag_::STRING>(), vs_(-1).get<Tag_::INT>());
          }
         break;
 
         case 14:
-#line 150 "grammar"
+#line 156 "grammar"
         {
          addConstant(vs_(-3).get<Tag_::STRING>(), vs_(-1).get<Tag_::CHAR>());
          }
         break;
 
         case 15:
-#line 157 "grammar"
+#line 161 "grammar"
         {
-         addStruct(vs_(-3).get<Tag_::STRING>(), vs_(-1).get<Tag_::DECLARATION_LIST>());
+         addConstTable(vs_(-6).get<Tag_::STRING>(), vs_(-8).get<Tag_::INT>(), vs_(-2).get<Tag_::INT_LIST>());
          }
         break;
 
         case 16:
-#line 162 "grammar"
+#line 166 "grammar"
+        {
+         addConstTable(vs_(-6).get<Tag_::STRING>(), compileTimeConstant(vs_(-8).get<Tag_::STRING>()), vs_(-2).get<Tag_::INT_LIST>());
+         }
+        break;
+
+        case 17:
+#line 173 "grammar"
+        {
+         d_val_ = std::vector<long>{vs_(0).get<Tag_::INT>()};
+         }
+        break;
+
+        case 18:
+#line 178 "grammar"
+        {
+         d_val_ = std::vector<long>{vs_(0).get<Tag_::CHAR>()};
+         }
+        break;
+
+        case 19:
+#line 183 "grammar"
+        {
+         (vs_(-2).get<Tag_::INT_LIST>()).push_back(vs_(0).get<Tag_::INT>());
+         d_val_ = vs_(-2).get<Tag_::INT_LIST>();
+         }
+        break;
+
+        case 20:
+#line 189 "grammar"
+        {
+         (vs_(-2).get<Tag_::INT_LIST>()).push_back(vs_(0).get<Tag_::CHAR>());
+         d_val_ = vs_(-2).get<Tag_::INT_LIST>();
+         }
+        break;
+
+        case 21:
+#line 197 "grammar"
+        {
+         addStruct(vs_(-3).get<Tag_::STRING>(), vs_(-1).get<Tag_::DECLARATION_LIST>());
+         }
+        break;
+
+        case 22:
+#line 202 "grammar"
         {
             d_val_ = std::move(vs_(-1));
         }
         break;
 
-        case 17:
-#line 166 "grammar"
+        case 23:
+#line 206 "grammar"
         {
             d_val_ = std::move(vs_(-1));
         }
         break;
 
-        case 18:
-#line 168 "grammar"
+        case 24:
+#line 208 "grammar"
         {
          (vs_(-2).get<Tag_::DECLARATION_LIST>()).insert(vs_(-2).get<Tag_::DECLARATION_LIST>().begin(), vs_(-1).get<Tag_::DECLARATION_LIST>().begin(), vs_(-1).get<Tag_::DECLARATION_LIST>().end());
          d_val_ = vs_(-2).get<Tag_::DECLARATION_LIST>();
          }
         break;
 
-        case 19:
-#line 177 "grammar"
+        case 25:
+#line 217 "grammar"
         {
          d_val_ = vs_(-1).get<Tag_::INSTRUCTION>();
          }
         break;
 
-        case 20:
-#line 184 "grammar"
+        case 26:
+#line 224 "grammar"
         {
          d_val_ = BFXFunction::Parameter(
          vs_(0).get<Tag_::STRING>(),
@@ -5841,8 +6555,8 @@ try
          }
         break;
 
-        case 21:
-#line 192 "grammar"
+        case 27:
+#line 232 "grammar"
         {
          d_val_ = BFXFunction::Parameter(
          vs_(0).get<Tag_::STRING>(),
@@ -5851,8 +6565,8 @@ try
          }
         break;
 
-        case 22:
-#line 202 "grammar"
+        case 28:
+#line 242 "grammar"
         {
          auto ret = std::vector<BFXFunction::Parameter>();
          ret.push_back(vs_(0).get<Tag_::PARAMETER>());
@@ -5860,164 +6574,164 @@ try
          }
         break;
 
-        case 23:
-#line 209 "grammar"
+        case 29:
+#line 249 "grammar"
         {
          (vs_(-2).get<Tag_::PARAMETER_LIST>()).push_back(vs_(0).get<Tag_::PARAMETER>());
          d_val_ = vs_(-2).get<Tag_::PARAMETER_LIST>();
          }
         break;
 
-        case 24:
-#line 217 "grammar"
+        case 30:
+#line 257 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 25:
-#line 219 "grammar"
+        case 31:
+#line 259 "grammar"
         {
          d_val_ = std::vector<BFXFunction::Parameter>();
          }
         break;
 
-        case 26:
-#line 226 "grammar"
+        case 32:
+#line 266 "grammar"
         {
          addGlobals(vs_(-1).get<Tag_::DECLARATION_LIST>());
          }
         break;
 
-        case 27:
-#line 232 "grammar"
+        case 33:
+#line 272 "grammar"
         {
          d_val_ = Instruction([](){ return -1; });
          }
         break;
 
-        case 28:
-#line 237 "grammar"
+        case 34:
+#line 277 "grammar"
         {
          d_val_ = instruction<&Compiler::mergeInstructions>(vs_(-1).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 29:
-#line 244 "grammar"
+        case 35:
+#line 284 "grammar"
         {
-         d_val_ = instruction<&Compiler::statement>(vs_(0).get<Tag_::INSTRUCTION>());
+         d_val_ = instruction<&Compiler::statement>(vs_(0).get<Tag_::INSTRUCTION>(), d_tokenIndex);
          }
         break;
 
-        case 30:
-#line 251 "grammar"
+        case 36:
+#line 291 "grammar"
         {
             d_val_ = std::move(vs_(-1));
         }
         break;
 
-        case 31:
-#line 253 "grammar"
+        case 37:
+#line 293 "grammar"
         {
          d_val_ = [](){ return -1; };
          }
         break;
 
-        case 32:
-#line 258 "grammar"
+        case 38:
+#line 298 "grammar"
         {
             d_val_ = std::move(vs_(-1));
         }
         break;
 
-        case 33:
-#line 260 "grammar"
+        case 39:
+#line 300 "grammar"
         {
             d_val_ = std::move(vs_(-1));
         }
         break;
 
-        case 34:
-#line 262 "grammar"
+        case 40:
+#line 302 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 35:
-#line 264 "grammar"
+        case 41:
+#line 304 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 36:
-#line 266 "grammar"
+        case 42:
+#line 306 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 37:
-#line 268 "grammar"
+        case 43:
+#line 308 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 38:
-#line 270 "grammar"
+        case 44:
+#line 310 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 39:
-#line 272 "grammar"
+        case 45:
+#line 312 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 40:
-#line 274 "grammar"
+        case 46:
+#line 314 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 41:
-#line 276 "grammar"
+        case 47:
+#line 316 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 42:
-#line 280 "grammar"
+        case 48:
+#line 320 "grammar"
         {
          d_val_ = instruction<&Compiler::declareVariable>((vs_(0).get<Tag_::DECLARATION>()).first, (vs_(0).get<Tag_::DECLARATION>()).second);
          }
         break;
 
-        case 43:
-#line 285 "grammar"
+        case 49:
+#line 325 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 44:
-#line 287 "grammar"
+        case 50:
+#line 327 "grammar"
         {
          compilerError("Negative numbers are not supported.");
          d_val_ = []() { return -1; };
          }
         break;
 
-        case 45:
-#line 293 "grammar"
+        case 51:
+#line 333 "grammar"
         {
          d_val_ = instruction<&Compiler::fetchElement>(
          (vs_(0).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6026,57 +6740,57 @@ try
          }
         break;
 
-        case 46:
-#line 301 "grammar"
+        case 52:
+#line 341 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 47:
-#line 303 "grammar"
+        case 53:
+#line 343 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 48:
-#line 305 "grammar"
+        case 54:
+#line 345 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 49:
-#line 307 "grammar"
+        case 55:
+#line 347 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 50:
-#line 309 "grammar"
+        case 56:
+#line 349 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 51:
-#line 311 "grammar"
+        case 57:
+#line 351 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 52:
-#line 313 "grammar"
+        case 58:
+#line 353 "grammar"
         {
          d_val_ = instruction<&Compiler::sizeOfOperator>(vs_(-1).get<Tag_::STRING>());
          }
         break;
 
-        case 53:
-#line 318 "grammar"
+        case 59:
+#line 358 "grammar"
         {
          d_val_ = instruction<&Compiler::initializeExpression>(
          (vs_(-2).get<Tag_::DECLARATION>()).first,
@@ -6086,15 +6800,15 @@ try
          }
         break;
 
-        case 54:
-#line 327 "grammar"
+        case 60:
+#line 367 "grammar"
         {
          d_val_ = instruction<&Compiler::assign>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 55:
-#line 332 "grammar"
+        case 61:
+#line 372 "grammar"
         {
          d_val_ = instruction<&Compiler::assignElement>(
          (vs_(-2).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6104,43 +6818,43 @@ try
          }
         break;
 
-        case 56:
-#line 341 "grammar"
+        case 62:
+#line 381 "grammar"
         {
          d_val_ = vs_(-1).get<Tag_::INSTRUCTION>();
          }
         break;
 
-        case 57:
-#line 346 "grammar"
+        case 63:
+#line 386 "grammar"
         {
          d_val_ = instruction<&Compiler::preIncrement>(vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 58:
-#line 351 "grammar"
+        case 64:
+#line 391 "grammar"
         {
          d_val_ = instruction<&Compiler::preDecrement>(vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 59:
-#line 356 "grammar"
+        case 65:
+#line 396 "grammar"
         {
          d_val_ = instruction<&Compiler::postIncrement>(vs_(-1).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 60:
-#line 361 "grammar"
+        case 66:
+#line 401 "grammar"
         {
          d_val_ = instruction<&Compiler::postDecrement>(vs_(-1).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 61:
-#line 366 "grammar"
+        case 67:
+#line 406 "grammar"
         {
          d_val_ = instruction<&Compiler::applyUnaryFunctionToElement>(
          (vs_(0).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6150,8 +6864,8 @@ try
          }
         break;
 
-        case 62:
-#line 375 "grammar"
+        case 68:
+#line 415 "grammar"
         {
          d_val_ = instruction<&Compiler::applyUnaryFunctionToElement>(
          (vs_(0).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6161,8 +6875,8 @@ try
          }
         break;
 
-        case 63:
-#line 384 "grammar"
+        case 69:
+#line 424 "grammar"
         {
          d_val_ = instruction<&Compiler::applyUnaryFunctionToElement>(
          (vs_(-1).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6172,8 +6886,8 @@ try
          }
         break;
 
-        case 64:
-#line 393 "grammar"
+        case 70:
+#line 433 "grammar"
         {
          d_val_ = instruction<&Compiler::applyUnaryFunctionToElement>(
          (vs_(-1).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6183,15 +6897,15 @@ try
          }
         break;
 
-        case 65:
-#line 402 "grammar"
+        case 71:
+#line 442 "grammar"
         {
          d_val_ = instruction<&Compiler::addTo>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 66:
-#line 407 "grammar"
+        case 72:
+#line 447 "grammar"
         {
          d_val_ = instruction<&Compiler::applyBinaryFunctionToElement>(
          (vs_(-2).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6202,22 +6916,22 @@ try
          }
         break;
 
-        case 67:
-#line 417 "grammar"
+        case 73:
+#line 457 "grammar"
         {
          d_val_ = instruction<&Compiler::add>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 68:
-#line 422 "grammar"
+        case 74:
+#line 462 "grammar"
         {
          d_val_ = instruction<&Compiler::subtractFrom>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 69:
-#line 427 "grammar"
+        case 75:
+#line 467 "grammar"
         {
          d_val_ = instruction<&Compiler::applyBinaryFunctionToElement>(
          (vs_(-2).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6228,22 +6942,22 @@ try
          }
         break;
 
-        case 70:
-#line 437 "grammar"
+        case 76:
+#line 477 "grammar"
         {
          d_val_ = instruction<&Compiler::subtract>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 71:
-#line 442 "grammar"
+        case 77:
+#line 482 "grammar"
         {
          d_val_ = instruction<&Compiler::multiplyBy>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 72:
-#line 447 "grammar"
+        case 78:
+#line 487 "grammar"
         {
          d_val_ = instruction<&Compiler::applyBinaryFunctionToElement>(
          (vs_(-2).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6254,22 +6968,22 @@ try
          }
         break;
 
-        case 73:
-#line 457 "grammar"
+        case 79:
+#line 497 "grammar"
         {
          d_val_ = instruction<&Compiler::multiply>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 74:
-#line 462 "grammar"
+        case 80:
+#line 502 "grammar"
         {
          d_val_ = instruction<&Compiler::divideBy>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 75:
-#line 467 "grammar"
+        case 81:
+#line 507 "grammar"
         {
          d_val_ = instruction<&Compiler::applyBinaryFunctionToElement>(
          (vs_(-2).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6280,22 +6994,22 @@ try
          }
         break;
 
-        case 76:
-#line 477 "grammar"
+        case 82:
+#line 517 "grammar"
         {
          d_val_ = instruction<&Compiler::divide>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 77:
-#line 482 "grammar"
+        case 83:
+#line 522 "grammar"
         {
          d_val_ = instruction<&Compiler::moduloBy>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 78:
-#line 487 "grammar"
+        case 84:
+#line 527 "grammar"
         {
          d_val_ = instruction<&Compiler::applyBinaryFunctionToElement>(
          (vs_(-2).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6306,15 +7020,15 @@ try
          }
         break;
 
-        case 79:
-#line 497 "grammar"
+        case 85:
+#line 537 "grammar"
         {
          d_val_ = instruction<&Compiler::divMod>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 80:
-#line 502 "grammar"
+        case 86:
+#line 542 "grammar"
         {
          d_val_ = instruction<&Compiler::applyBinaryFunctionToElement>(
          (vs_(-2).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6325,15 +7039,15 @@ try
          }
         break;
 
-        case 81:
-#line 512 "grammar"
+        case 87:
+#line 552 "grammar"
         {
          d_val_ = instruction<&Compiler::modDiv>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 82:
-#line 517 "grammar"
+        case 88:
+#line 557 "grammar"
         {
          d_val_ = instruction<&Compiler::applyBinaryFunctionToElement>(
          (vs_(-2).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6344,22 +7058,22 @@ try
          }
         break;
 
-        case 83:
-#line 527 "grammar"
+        case 89:
+#line 567 "grammar"
         {
          d_val_ = instruction<&Compiler::power>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 84:
-#line 532 "grammar"
+        case 90:
+#line 572 "grammar"
         {
          d_val_ = instruction<&Compiler::powerBy>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 85:
-#line 537 "grammar"
+        case 91:
+#line 577 "grammar"
         {
          d_val_ = instruction<&Compiler::applyBinaryFunctionToElement>(
          (vs_(-2).get<Tag_::INSTRUCTION_PAIR>()).first,
@@ -6370,170 +7084,205 @@ try
          }
         break;
 
-        case 86:
-#line 547 "grammar"
+        case 92:
+#line 587 "grammar"
         {
          d_val_ = instruction<&Compiler::modulo>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 87:
-#line 552 "grammar"
+        case 93:
+#line 592 "grammar"
         {
          d_val_ = instruction<&Compiler::less>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 88:
-#line 557 "grammar"
+        case 94:
+#line 597 "grammar"
         {
          d_val_ = instruction<&Compiler::greater>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 89:
-#line 562 "grammar"
+        case 95:
+#line 602 "grammar"
         {
          d_val_ = instruction<&Compiler::lessOrEqual>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 90:
-#line 567 "grammar"
+        case 96:
+#line 607 "grammar"
         {
          d_val_ = instruction<&Compiler::greaterOrEqual>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 91:
-#line 572 "grammar"
+        case 97:
+#line 612 "grammar"
         {
          d_val_ = instruction<&Compiler::notEqual>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 92:
-#line 577 "grammar"
+        case 98:
+#line 617 "grammar"
         {
          d_val_ = instruction<&Compiler::equal>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 93:
-#line 582 "grammar"
+        case 99:
+#line 622 "grammar"
         {
          d_val_ = instruction<&Compiler::logicalNot>(vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 94:
-#line 587 "grammar"
+        case 100:
+#line 627 "grammar"
         {
-         d_val_ = instruction<&Compiler::logicalAnd>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
+         d_val_ = instruction<&Compiler::shortCircuitAnd>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 95:
-#line 592 "grammar"
+        case 101:
+#line 632 "grammar"
         {
-         d_val_ = instruction<&Compiler::logicalOr>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
+         d_val_ = instruction<&Compiler::shortCircuitOr>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 96:
-#line 599 "grammar"
+        case 102:
+#line 637 "grammar"
+        {
+         d_val_ = instruction<&Compiler::bitwiseAnd>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
+         }
+        break;
+
+        case 103:
+#line 642 "grammar"
+        {
+         d_val_ = instruction<&Compiler::bitwiseOr>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
+         }
+        break;
+
+        case 104:
+#line 647 "grammar"
+        {
+         d_val_ = instruction<&Compiler::bitwiseXor>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
+         }
+        break;
+
+        case 105:
+#line 652 "grammar"
+        {
+         d_val_ = instruction<&Compiler::shiftLeft>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
+         }
+        break;
+
+        case 106:
+#line 657 "grammar"
+        {
+         d_val_ = instruction<&Compiler::shiftRight>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
+         }
+        break;
+
+        case 107:
+#line 664 "grammar"
         {
          d_val_ = instruction<&Compiler::printCell>(vs_(-1).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 97:
-#line 604 "grammar"
+        case 108:
+#line 669 "grammar"
         {
          d_val_ = instruction<&Compiler::scanCell>();
          }
         break;
 
-        case 98:
-#line 609 "grammar"
+        case 109:
+#line 674 "grammar"
         {
          d_val_ = instruction<&Compiler::randomCell>();
          }
         break;
 
-        case 99:
-#line 616 "grammar"
+        case 110:
+#line 681 "grammar"
         {
          d_val_ = instruction<&Compiler::staticAssert>(vs_(-3).get<Tag_::INSTRUCTION>(), vs_(-1).get<Tag_::STRING>());
          }
         break;
 
-        case 100:
-#line 623 "grammar"
+        case 111:
+#line 688 "grammar"
         {
          d_val_ = instruction<&Compiler::fetch>(vs_(0).get<Tag_::STRING>());
          }
         break;
 
-        case 101:
-#line 628 "grammar"
+        case 112:
+#line 693 "grammar"
         {
          d_val_ = instruction<&Compiler::fetchField>(vs_(0).get<Tag_::STRING_LIST>());
          }
         break;
 
-        case 102:
-#line 635 "grammar"
+        case 113:
+#line 700 "grammar"
         {
          d_val_ = std::vector<std::string>{vs_(-2).get<Tag_::STRING>(), vs_(0).get<Tag_::STRING>()};
          }
         break;
 
-        case 103:
-#line 640 "grammar"
+        case 114:
+#line 705 "grammar"
         {
          (vs_(-2).get<Tag_::STRING_LIST>()).push_back(vs_(0).get<Tag_::STRING>());
          d_val_ = vs_(-2).get<Tag_::STRING_LIST>();
          }
         break;
 
-        case 104:
-#line 648 "grammar"
+        case 115:
+#line 713 "grammar"
         {
          d_val_ = instruction<&Compiler::constVal>(vs_(0).get<Tag_::INT>());
          }
         break;
 
-        case 105:
-#line 653 "grammar"
+        case 116:
+#line 718 "grammar"
         {
          d_val_ = instruction<&Compiler::constVal>(vs_(0).get<Tag_::CHAR>());
          }
         break;
 
-        case 106:
-#line 661 "grammar"
+        case 117:
+#line 726 "grammar"
         {
          d_val_ = std::pair<Instruction, Instruction>(vs_(-3).get<Tag_::INSTRUCTION>(), vs_(-1).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 107:
-#line 669 "grammar"
+        case 118:
+#line 734 "grammar"
         {
          d_val_ = instruction<&Compiler::arrayFromString>(vs_(0).get<Tag_::STRING>());
          }
         break;
 
-        case 108:
-#line 676 "grammar"
+        case 119:
+#line 741 "grammar"
         {
          d_val_ = instruction<&Compiler::arrayFromList>(vs_(-1).get<Tag_::INSTRUCTION_LIST>());
          }
         break;
 
-        case 109:
-#line 681 "grammar"
+        case 120:
+#line 746 "grammar"
         {
          d_val_ = instruction<&Compiler::arrayFromSize>(
          vs_(-1).get<Tag_::INT>(),
@@ -6542,8 +7291,8 @@ try
          }
         break;
 
-        case 110:
-#line 689 "grammar"
+        case 121:
+#line 754 "grammar"
         {
          d_val_ = instruction<&Compiler::arrayFromSize>(
          compileTimeConstant(vs_(-1).get<Tag_::STRING>()),
@@ -6552,15 +7301,15 @@ try
          }
         break;
 
-        case 111:
-#line 697 "grammar"
+        case 122:
+#line 762 "grammar"
         {
          d_val_ = instruction<&Compiler::arrayFromSize>(vs_(-3).get<Tag_::INT>(), vs_(-1).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 112:
-#line 702 "grammar"
+        case 123:
+#line 767 "grammar"
         {
          d_val_ = instruction<&Compiler::arrayFromSize>(
          compileTimeConstant(vs_(-3).get<Tag_::STRING>()),
@@ -6569,150 +7318,152 @@ try
          }
         break;
 
-        case 113:
-#line 712 "grammar"
+        case 124:
+#line 777 "grammar"
         {
          d_val_ = instruction<&Compiler::anonymousStructObject>(vs_(-3).get<Tag_::STRING>(), vs_(-1).get<Tag_::INSTRUCTION_LIST>()); 
          }
         break;
 
-        case 114:
-#line 719 "grammar"
+        case 125:
+#line 784 "grammar"
         {
          d_val_ = instruction<&Compiler::call>(vs_(-3).get<Tag_::STRING>(), vs_(-1).get<Tag_::INSTRUCTION_LIST>());
          }
         break;
 
-        case 115:
-#line 726 "grammar"
+        case 126:
+#line 791 "grammar"
         {
          d_val_ = instruction<&Compiler::breakStatement>();
          }
         break;
 
-        case 116:
-#line 733 "grammar"
+        case 127:
+#line 798 "grammar"
         {
          d_val_ = instruction<&Compiler::continueStatement>();
          }
         break;
 
-        case 117:
-#line 740 "grammar"
+        case 128:
+#line 805 "grammar"
         {
          d_val_ = instruction<&Compiler::returnStatement>();
          }
         break;
 
-        case 118:
-#line 748 "grammar"
+        case 129:
+#line 813 "grammar"
         {
-         d_val_ = instruction<&Compiler::forStatement>(vs_(-6).get<Tag_::INSTRUCTION>(), vs_(-4).get<Tag_::INSTRUCTION>(), vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
+         d_val_ = addLoop(instruction<&Compiler::forStatement>(vs_(-6).get<Tag_::INSTRUCTION>(), truthValue(vs_(-4).get<Tag_::INSTRUCTION>()), vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>()));
          }
         break;
 
-        case 119:
-#line 753 "grammar"
+        case 130:
+#line 819 "grammar"
         {
-         d_val_ = instruction<&Compiler::forStatementRuntime>(vs_(-6).get<Tag_::INSTRUCTION>(), vs_(-4).get<Tag_::INSTRUCTION>(), vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
+         d_val_ = addLoop(instruction<&Compiler::forStatementRuntime>(vs_(-6).get<Tag_::INSTRUCTION>(), truthValue(vs_(-4).get<Tag_::INSTRUCTION>()), vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>(), true));
          }
         break;
 
-        case 120:
-#line 758 "grammar"
+        case 131:
+#line 825 "grammar"
         {
-         d_val_ = instruction<&Compiler::forRangeStatement>(vs_(-4).get<Tag_::PARAMETER>(), vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
+         d_val_ = addLoop(instruction<&Compiler::forRangeStatement>(vs_(-4).get<Tag_::PARAMETER>(), vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>()));
          }
         break;
 
-        case 121:
-#line 763 "grammar"
+        case 132:
+#line 831 "grammar"
         {
-         d_val_ = instruction<&Compiler::forRangeStatementRuntime>(vs_(-4).get<Tag_::PARAMETER>(), vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
+         d_val_ = addLoop(instruction<&Compiler::forRangeStatementRuntime>(vs_(-4).get<Tag_::PARAMETER>(), vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>()));
          }
         break;
 
-        case 122:
-#line 770 "grammar"
+        case 133:
+#line 839 "grammar"
         {
-         d_val_ = instruction<&Compiler::ifStatement>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>(), Instruction([](){ return -1; }), true);
+         d_val_ = instruction<&Compiler::ifStatement>(truthValue(vs_(-2).get<Tag_::INSTRUCTION>()), vs_(0).get<Tag_::INSTRUCTION>(), Instruction{}, true);
          }
         break;
 
-        case 123:
-#line 775 "grammar"
+        case 134:
+#line 844 "grammar"
         {
-         d_val_ = instruction<&Compiler::ifStatement>(vs_(-4).get<Tag_::INSTRUCTION>(), vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>(), true); 
+         d_val_ = instruction<&Compiler::ifStatement>(truthValue(vs_(-4).get<Tag_::INSTRUCTION>()), vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>(), true); 
          }
         break;
 
-        case 124:
-#line 782 "grammar"
+        case 135:
+#line 851 "grammar"
         {
-         d_val_ = instruction<&Compiler::whileStatement>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
+         d_val_ = addLoop(instruction<&Compiler::whileStatement>(truthValue(vs_(-2).get<Tag_::INSTRUCTION>()), vs_(0).get<Tag_::INSTRUCTION>()));
          }
         break;
 
-        case 125:
-#line 787 "grammar"
+        case 136:
+#line 857 "grammar"
         {
-         d_val_ = instruction<&Compiler::whileStatementRuntime>(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
+         d_val_ = addLoop(instruction<&Compiler::whileStatementRuntime>(truthValue(vs_(-2).get<Tag_::INSTRUCTION>()), vs_(0).get<Tag_::INSTRUCTION>()));
          }
         break;
 
-        case 126:
-#line 794 "grammar"
+        case 137:
+#line 865 "grammar"
         {
-         d_val_ = instruction<&Compiler::switchStatement>(vs_(-4).get<Tag_::INSTRUCTION>(), vs_(-1).get<Tag_::CASE_LIST>(), [](){ return -1; });
+         d_val_ = instruction<&Compiler::switchStatement>(vs_(-4).get<Tag_::INSTRUCTION>(), vs_(-1).get<Tag_::CASE_LIST>(), Instruction{});
+         addSwitch();
          }
         break;
 
-        case 127:
-#line 799 "grammar"
+        case 138:
+#line 870 "grammar"
         {
          d_val_ = instruction<&Compiler::switchStatement>(vs_(-5).get<Tag_::INSTRUCTION>(), vs_(-2).get<Tag_::CASE_LIST>(), vs_(-1).get<Tag_::INSTRUCTION>());
+         addSwitch();
          }
         break;
 
-        case 128:
-#line 807 "grammar"
+        case 139:
+#line 878 "grammar"
         {
          d_val_ = std::vector<std::pair<Instruction, Instruction>>();
          (d_val_.get<Tag_::CASE_LIST>()).push_back(vs_(0).get<Tag_::INSTRUCTION_PAIR>());
          }
         break;
 
-        case 129:
-#line 813 "grammar"
+        case 140:
+#line 884 "grammar"
         {
          (vs_(-1).get<Tag_::CASE_LIST>()).push_back(vs_(0).get<Tag_::INSTRUCTION_PAIR>());
          d_val_ = vs_(-1).get<Tag_::CASE_LIST>();
          }
         break;
 
-        case 130:
-#line 821 "grammar"
+        case 141:
+#line 892 "grammar"
         {
          d_val_ = std::make_pair(vs_(-2).get<Tag_::INSTRUCTION>(), vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 131:
-#line 828 "grammar"
+        case 142:
+#line 899 "grammar"
         {
          d_val_ = vs_(0).get<Tag_::INSTRUCTION>();
          }
         break;
 
-        case 132:
-#line 835 "grammar"
+        case 143:
+#line 906 "grammar"
         {
          d_val_ = vs_(0).get<Tag_::DECLARATION>();
          }
         break;
 
-        case 133:
-#line 842 "grammar"
+        case 144:
+#line 913 "grammar"
         {
          d_val_ = std::pair<std::string, TypeSystem::Type>
          {
@@ -6722,8 +7473,8 @@ try
          }
         break;
 
-        case 134:
-#line 851 "grammar"
+        case 145:
+#line 922 "grammar"
         {
          d_val_ = std::pair<std::string, TypeSystem::Type>
          {
@@ -6733,8 +7484,8 @@ try
          }
         break;
 
-        case 135:
-#line 860 "grammar"
+        case 146:
+#line 931 "grammar"
         {
          d_val_ = std::pair<std::string, TypeSystem::Type>
          {
@@ -6744,8 +7495,8 @@ try
          }
         break;
 
-        case 136:
-#line 869 "grammar"
+        case 147:
+#line 940 "grammar"
         {
          d_val_ = std::pair<std::string, TypeSystem::Type>
          {
@@ -6755,19 +7506,19 @@ try
          }
         break;
 
-        case 137:
-#line 878 "grammar"
+        case 148:
+#line 949 "grammar"
         {
          d_val_ = std::pair<std::string, TypeSystem::Type>
          {
          vs_(0).get<Tag_::STRING>(),
-         TypeSystem::Type(compileTimeConstant(vs_(-2).get<Tag_::STRING>()))
+         declaredType(vs_(-2).get<Tag_::STRING>())
          };
          }
         break;
 
-        case 138:
-#line 887 "grammar"
+        case 149:
+#line 958 "grammar"
         {
          d_val_ = std::pair<std::string, TypeSystem::Type>
          {
@@ -6777,119 +7528,119 @@ try
          }
         break;
 
-        case 139:
-#line 899 "grammar"
+        case 150:
+#line 970 "grammar"
         { 
          d_val_ = std::vector<std::pair<std::string, TypeSystem::Type>>();
          (d_val_.get<Tag_::DECLARATION_LIST>()).push_back(vs_(0).get<Tag_::DECLARATION>());
          }
         break;
 
-        case 140:
-#line 905 "grammar"
+        case 151:
+#line 976 "grammar"
         {
          (vs_(-2).get<Tag_::DECLARATION_LIST>()).push_back(vs_(0).get<Tag_::DECLARATION>());
          d_val_ = vs_(-2).get<Tag_::DECLARATION_LIST>();
          }
         break;
 
-        case 141:
-#line 914 "grammar"
+        case 152:
+#line 985 "grammar"
         {
          d_val_ = std::vector<Instruction>{};
          (d_val_.get<Tag_::INSTRUCTION_LIST>()).push_back(vs_(0).get<Tag_::INSTRUCTION>());
          }
         break;
 
-        case 142:
-#line 920 "grammar"
+        case 153:
+#line 991 "grammar"
         {
          (vs_(-2).get<Tag_::INSTRUCTION_LIST>()).push_back(vs_(0).get<Tag_::INSTRUCTION>());
          d_val_ = vs_(-2).get<Tag_::INSTRUCTION_LIST>();
          }
         break;
 
-        case 143:
-#line 928 "grammar"
+        case 154:
+#line 999 "grammar"
         {
          d_val_ = std::vector<Instruction>{};
          }
         break;
 
-        case 144:
-#line 933 "grammar"
+        case 155:
+#line 1004 "grammar"
         {
             d_val_ = std::move(vs_(0));
         }
         break;
 
-        case 145:
-#line 938 "grammar"
+        case 156:
+#line 1009 "grammar"
         {
          addTest(vs_(-2).get<Tag_::STRING>(), vs_(-1).get<Tag_::TEST_VECTOR>());
          }
         break;
 
-        case 146:
-#line 945 "grammar"
+        case 157:
+#line 1016 "grammar"
         {
          d_val_ = vs_(-1).get<Tag_::STRING>();
          }
         break;
 
-        case 147:
-#line 952 "grammar"
+        case 158:
+#line 1023 "grammar"
         {
          d_val_ = std::vector<std::tuple<std::string, std::string, std::string>>{};
          (d_val_.get<Tag_::TEST_VECTOR>()).push_back(vs_(0).get<Tag_::STRING_TUPLE>());
          }
         break;
 
-        case 148:
-#line 958 "grammar"
+        case 159:
+#line 1029 "grammar"
         {
          (vs_(-1).get<Tag_::TEST_VECTOR>()).push_back(vs_(0).get<Tag_::STRING_TUPLE>());
          d_val_ = vs_(-1).get<Tag_::TEST_VECTOR>();
          }
         break;
 
-        case 149:
-#line 966 "grammar"
+        case 160:
+#line 1037 "grammar"
         {
          d_val_ = std::make_tuple(vs_(-2).get<Tag_::STRING>(), vs_(-1).get<Tag_::STRING>(), vs_(0).get<Tag_::STRING>());
          }
         break;
 
-        case 150:
-#line 971 "grammar"
+        case 161:
+#line 1042 "grammar"
         {
          d_val_ = std::make_tuple(vs_(-1).get<Tag_::STRING>(), std::string{}, vs_(0).get<Tag_::STRING>());
          }
         break;
 
-        case 151:
-#line 978 "grammar"
+        case 162:
+#line 1049 "grammar"
         {
          d_val_ = vs_(-1).get<Tag_::STRING>();
          }
         break;
 
-        case 152:
-#line 985 "grammar"
+        case 163:
+#line 1056 "grammar"
         {
          d_val_ = vs_(-1).get<Tag_::STRING>();
          }
         break;
 
-        case 153:
-#line 992 "grammar"
+        case 164:
+#line 1063 "grammar"
         {
          d_val_ = std::string("");
          }
         break;
 
-        case 154:
-#line 997 "grammar"
+        case 165:
+#line 1068 "grammar"
         {
          d_val_ = vs_(-1).get<Tag_::STRING>() + vs_(0).get<Tag_::CHAR>();
          }
@@ -38,6 +38,7 @@ enum class Tag_
     TEST_VECTOR,
     STRING_TUPLE,
     INSTRUCTION_PAIR,
+    INT_LIST,
 };
 
 namespace Meta_
@@ -54,11 +55,11 @@ template <typename Tp_>
 struct TagOf;
 
 // $insert polymorphicSpecializations
-enum { sizeofTag_ = 15 };
+enum { sizeofTag_ = 16 };
 
 extern char const *idOfTag_[];
 template <>
-struct TagOf<int>
+struct TagOf<long>
 {
     static Tag_ const tag = Tag_::INT;
 };
@@ -147,10 +148,16 @@ struct TagOf<std::pair<Instruction, Instruction>>
     static Tag_ const tag = Tag_::INSTRUCTION_PAIR;
 };
 
+template <>
+struct TagOf<std::vector<long>>
+{
+    static Tag_ const tag = Tag_::INT_LIST;
+};
+
 template <>
 struct TypeOf<Tag_::INT>
 {
-    typedef int type;
+    typedef long type;
 };
 
 template <>
@@ -237,6 +244,12 @@ struct TypeOf<Tag_::INSTRUCTION_PAIR>
     typedef std::pair<Instruction, Instruction> type;
 };
 
+template <>
+struct TypeOf<Tag_::INT_LIST>
+{
+    typedef std::vector<long> type;
+};
+
 
     // Individual semantic value classes are derived from Base, offering a
     // member returning the value's Tag_, a member cloning the object of its
@@ -357,8 +370,8 @@ class SType: private std::unique_ptr<Base>
         SType &operator=(SType &&tmp);
 
 // $insert polymorphicOpAssignDecl
-        SType &operator=(int const &value);
-        SType &operator=(int &&tmp);
+        SType &operator=(long const &value);
+        SType &operator=(long &&tmp);
 
         SType &operator=(std::vector<std::pair<std::string, TypeSystem::Type>> const &value);
         SType &operator=(std::vector<std::pair<std::string, TypeSystem::Type>> &&tmp);
@@ -402,6 +415,9 @@ class SType: private std::unique_ptr<Base>
         SType &operator=(std::pair<Instruction, Instruction> const &value);
         SType &operator=(std::pair<Instruction, Instruction> &&tmp);
 
+        SType &operator=(std::vector<long> const &value);
+        SType &operator=(std::vector<long> &&tmp);
+
         template <Tag_ tagParam, typename ...Args>
         void assign(Args &&...args);
     
@@ -447,12 +463,12 @@ inline SType &SType::operator=(SType &&tmp)
 }
 
 // $insert polymorphicOpAssignImpl
-inline SType &SType::operator=(int const &value)
+inline SType &SType::operator=(long const &value)
 {
     assign< Tag_::INT >(value);
     return *this;
 }
-inline SType &SType::operator=(int &&tmp)
+inline SType &SType::operator=(long &&tmp)
 {
     assign< Tag_::INT >(std::move(tmp));
     return *this;
@@ -597,6 +613,16 @@ inline SType &SType::operator=(std::pair<Instruction, Instruction> &&tmp)
     assign< Tag_::INSTRUCTION_PAIR >(std::move(tmp));
     return *this;
 }
+inline SType &SType::operator=(std::vector<long> const &value)
+{
+    assign< Tag_::INT_LIST >(value);
+    return *this;
+}
+inline SType &SType::operator=(std::vector<long> &&tmp)
+{
+    assign< Tag_::INT_LIST >(std::move(tmp));
+    return *this;
+}
 
 template <Tag_ tagParam, typename ...Args>
 void SType::assign(Args &&...args)
@@ -716,10 +742,13 @@ class CompilerBase
         POW,
         OR,
         AND,
+        XOR,
         EQ,
         NE,
         LE,
         GE,
+        SHL,
+        SHR,
         unaryMinus,
         INC,
         DEC,
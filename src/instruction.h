@@ -16,18 +16,35 @@ class AddressOrInstruction
     mutable Kind d_kind;
     mutable int d_addr;
     Instruction const d_instr;
+    bool const d_expression;
     
 public:
     AddressOrInstruction(int addr):
         d_kind(Kind::ADDRESS),
-        d_addr(addr)
+        d_addr(addr),
+        d_expression(false)
     {}
     
     AddressOrInstruction(Instruction const &instr):
         d_kind(Kind::INSTRUCTION),
-        d_instr(instr)
+        d_instr(instr),
+        d_expression(true)
     {}
 
+    // Whether the address is the result of evaluating a (sub)expression, rather than
+    // an address that was handed over by the compiler itself.
+    bool isExpression() const
+    {
+        return d_expression;
+    }
+
+    // Evaluates the expression without storing the result, such that it can still be
+    // evaluated for real afterwards.
+    int peek() const
+    {
+        return (d_kind == Kind::INSTRUCTION) ? d_instr() : d_addr;
+    }
+
     operator int() const
     {
         if (d_kind == Kind::INSTRUCTION)
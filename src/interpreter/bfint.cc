@@ -2,6 +2,7 @@
 #include <chrono>
 #include <csignal>
 #include <fstream>
+#include <limits>
 #include <sstream>
 
 #ifdef USE_CURSES
@@ -13,18 +14,19 @@
 namespace _MaxInt
 {
     template <typename T>
-    constexpr size_t _getMax()
+    constexpr uint64_t _getMax()
     {
-        return (static_cast<size_t>(1) << (8 * sizeof(T))) - 1;
+        return std::numeric_limits<T>::max();
     }
     
-    inline static size_t get(CellType c)
+    inline static uint64_t get(CellType c)
     {
         switch (c)
         {
         case CellType::INT8:  return _getMax<uint8_t>();
         case CellType::INT16: return _getMax<uint16_t>();
         case CellType::INT32: return _getMax<uint32_t>();
+        case CellType::INT64: return _getMax<uint64_t>();
         }
         throw -1;
     }
@@ -38,7 +40,9 @@ BFInterpreter::BFInterpreter(Options const &opt):
     d_randMax(opt.randMax),
     d_randomWarningEnabled(opt.randomWarningEnabled),
     d_gamingMode(opt.gamingMode),
-    d_testFile(opt.testFile)
+    d_testFile(opt.testFile),
+    d_bfFile(opt.bfFile),
+    d_heatmapFile(opt.heatmapFile)
 {
     // init code
     std::ifstream file(opt.bfFile);
@@ -66,7 +70,11 @@ void BFInterpreter::reset()
 int BFInterpreter::run()
 {
     if (d_testFile.empty())
-        return run(std::cin, std::cout);
+    {
+        int const err = run(std::cin, std::cout);
+        writeHeatmap();
+        return err;
+    }
         
     auto const report =
         [](std::string const &testName, std::string const &caseName,
@@ -284,6 +292,9 @@ void BFInterpreter::plus()
     case CellType::INT32:
         d_array[d_arrayPointer] = static_cast<uint32_t>(d_array[d_arrayPointer] + n);
         break;
+    case CellType::INT64:
+        d_array[d_arrayPointer] += n;
+        break;
     }
 }
     
@@ -301,6 +312,9 @@ void BFInterpreter::minus()
     case CellType::INT32:
         d_array[d_arrayPointer] = static_cast<uint32_t>(d_array[d_arrayPointer] - n);
         break;
+    case CellType::INT64:
+        d_array[d_arrayPointer] -= n;
+        break;
     }
 }
 
@@ -311,6 +325,8 @@ void BFInterpreter::pointerInc()
 
     while (d_arrayPointer >= d_array.size())
         d_array.resize(2 * d_array.size());
+
+    visit(d_arrayPointer - n);
 }
 
 void BFInterpreter::pointerDec()
@@ -320,6 +336,49 @@ void BFInterpreter::pointerDec()
 
     int const n = consume(LEFT);
     d_arrayPointer -= n;
+
+    visit(d_arrayPointer + n);
+}
+
+void BFInterpreter::visit(size_t const from)
+{
+    if (d_heatmapFile.empty())
+        return;
+
+    if (d_arrayPointer >= d_heat.size())
+        d_heat.resize(d_array.size());
+
+    ++d_heat[d_arrayPointer];
+    ++d_transitions[{from, d_arrayPointer}];
+}
+
+void BFInterpreter::writeHeatmap() const
+{
+    if (d_heatmapFile.empty())
+        return;
+
+    // Same format as the profile written by bfx, such that it can be passed
+    // back to the compiler with --layout-profile.
+    std::ofstream file(d_heatmapFile);
+    if (!file)
+        throw std::string("Could not open file for heatmap: ") + d_heatmapFile;
+
+    file << "Heatmap for " << d_bfFile << ":\n\n"
+         << "+---------+---------+\n"
+         << "| address | #visits |\n"
+         << "+---------+---------+\n";
+
+    for (size_t addr = 0; addr != d_heat.size(); ++addr)
+        if (d_heat[addr] != 0)
+            file << addr << ": " << d_heat[addr] << '\n';
+
+    file << '\n'
+         << "+------------+--------+\n"
+         << "| transition | #moves |\n"
+         << "+------------+--------+\n";
+
+    for (auto const &[move, count]: d_transitions)
+        file << move.first << '-' << move.second << ": " << count << '\n';
 }
 
 void BFInterpreter::startLoop()
@@ -578,7 +637,7 @@ void BFInterpreter::read(std::istream &in)
 {
     char c;
     in.get(c);
-    d_array[d_arrayPointer] = c;
+    d_array[d_arrayPointer] = static_cast<unsigned char>(c);
 }
 
 void BFInterpreter::readCurses()
@@ -600,7 +659,7 @@ void BFInterpreter::random()
 void BFInterpreter::printState()
 {
     for (auto x: d_array)
-        std::cout << (int)x << ' ';
+        std::cout << x << ' ';
     std::cout << '\n';
 }
 
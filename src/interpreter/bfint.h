@@ -2,6 +2,8 @@
 #define BFINT_H
 
 #include <vector>
+#include <cstdint>
+#include <map>
 #include <stack>
 #include <random>
 #include <iostream>
@@ -10,7 +12,8 @@ enum class CellType
     {
      INT8,
      INT16,
-     INT32
+     INT32,
+     INT64
     };
 
 struct Options
@@ -20,6 +23,7 @@ struct Options
     int          tapeLength{30000};
     std::string  bfFile;
     std::string  testFile;
+    std::string  heatmapFile;
     bool         randomEnabled{false};
     int          randMax{0};
     bool         randomWarningEnabled{true};
@@ -28,14 +32,14 @@ struct Options
 
 class BFInterpreter
 {
-    std::vector<int> d_array;
+    std::vector<uint64_t> d_array;
     std::string d_code;
     size_t d_arrayPointer{0};
     size_t d_codePointer{0};
     std::stack<int> d_loopStack;
 
     using RngType = std::mt19937;
-    std::uniform_int_distribution<RngType::result_type> d_uniformDist;
+    std::uniform_int_distribution<uint64_t> d_uniformDist;
     RngType d_rng;
 
     // Options
@@ -45,6 +49,12 @@ class BFInterpreter
     bool const d_randomWarningEnabled{true};
     bool const d_gamingMode{false};
     std::string const d_testFile;
+
+    // Runtime profile: number of moves to each cell and between each pair of cells
+    std::string const d_bfFile;
+    std::string const d_heatmapFile;
+    std::vector<long> d_heat;
+    std::map<std::pair<size_t, size_t>, long> d_transitions;
     
     enum Ops: char
         {
@@ -82,6 +92,8 @@ private:
     static void finish(int sig);
     void runTests();
     void reset();
+    void visit(size_t const from);
+    void writeHeatmap() const;
 };
 
 
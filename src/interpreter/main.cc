@@ -1,6 +1,7 @@
 #include <iostream>
 #include <vector>
 #include <map>
+#include <algorithm>
 #include "bfint.h"
 
 void printHelp(std::string const &progName)
@@ -9,9 +10,11 @@ void printHelp(std::string const &progName)
               << "Options:\n"
               << "-h, --help          Display this text.\n"
               << "-t, --type [Type]   Specify the number of bytes per BF-cell, where [Type] is one of\n"
-                 "                    int8, int16 and int32 (int8 by default).\n"
+                 "                    int8, int16, int32 and int64 (int8 by default).\n"
               << "-n [N]              Specify the number of cells (30,000 by default).\n"
               << "--test [file]       Run the tests specified by the file (generated by bfx --test)\n"
+              << "--heatmap [file]    Write the number of visits to each cell at runtime to a file,\n"
+              << "                      to be used by bfx --layout-profile.\n"
 #ifdef USE_CURSES        
               << "--gaming            Enable gaming-mode.\n"
               << "--gaming-help       Display additional information about gaming-mode.\n"
@@ -74,7 +77,8 @@ Options parseCmdLine(std::vector<std::string> const &args)
             static std::map<std::string, CellType> const getType{
                 {"int8", CellType::INT8},
                 {"int16", CellType::INT16},
-                {"int32", CellType::INT32}
+                {"int32", CellType::INT32},
+                {"int64", CellType::INT64}
             };
 
             auto tolower = [](std::string str)->std::string
@@ -134,6 +138,18 @@ Options parseCmdLine(std::vector<std::string> const &args)
             opt.testFile = args[idx + 1];
             idx += 2;
         }
+        else if (args[idx] == "--heatmap")
+        {
+            if (idx == args.size() - 1)
+            {
+                std::cerr << "ERROR: No filename passed to option \'--heatmap\'.\n";
+                opt.err = 1;
+                return opt;
+            }
+
+            opt.heatmapFile = args[idx + 1];
+            idx += 2;
+        }
         else if (args[idx] == "--random")
         {
             opt.randomEnabled = true;
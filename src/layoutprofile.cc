@@ -0,0 +1,187 @@
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <numeric>
+#include "layoutprofile.h"
+
+bool LayoutProfile::load(std::string const &filename)
+{
+    std::ifstream file(filename);
+    if (!file)
+        return false;
+
+    enum class Section
+        {
+         NONE,
+         ADDRESSES,
+         VARIABLES,
+         TRANSITIONS
+        };
+
+    Section section = Section::NONE;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.rfind("| address", 0) == 0)
+            section = Section::ADDRESSES;
+        else if (line.rfind("| variable", 0) == 0)
+            section = Section::VARIABLES;
+        else if (line.rfind("| transition", 0) == 0)
+            section = Section::TRANSITIONS;
+
+        size_t const colon = line.find(": ");
+        if (section == Section::NONE || colon == std::string::npos)
+            continue;
+
+        // Lines that cannot be parsed (e.g. a profile that was edited by hand) are skipped
+        std::string const left = line.substr(0, colon);
+        std::istringstream lhs(left);
+        std::istringstream right(line.substr(colon + 2));
+        switch (section)
+        {
+        case Section::ADDRESSES:
+            {
+                int addr = 0;
+                long visits = 0;
+                if ((lhs >> addr) && (right >> visits))
+                    d_heat[addr] += visits;
+                break;
+            }
+        case Section::VARIABLES:
+            {
+                int addr = 0;
+                int size = 0;
+                if (right >> addr >> size)
+                    d_cells[left].insert({addr, size});
+                break;
+            }
+        case Section::TRANSITIONS:
+            {
+                int from = 0;
+                int to = 0;
+                char dash = 0;
+                long moves = 0;
+                if ((lhs >> from >> dash >> to) && dash == '-' && (right >> moves))
+                    d_transitions[{from, to}] += moves;
+                break;
+            }
+        default: break;
+        }
+    }
+
+    return true;
+}
+
+void LayoutProfile::computeLayout()
+{
+    // Attribute the moves between addresses to the variables that occupied them, and
+    // list for each variable the others it is visited together with most often.
+    // Field-entries (StructName.field) are only used to order struct-fields.
+    std::vector<std::string> keys;
+    std::map<int, std::vector<size_t>> owners;
+    for (auto const &[key, cells]: d_cells)
+    {
+        if (key.find('.') != std::string::npos)
+            continue;
+
+        std::set<int> addresses;
+        for (auto const &[addr, size]: cells)
+            for (int i = 0; i != size; ++i)
+                addresses.insert(addr + i);
+
+        for (int const addr: addresses)
+            owners[addr].push_back(keys.size());
+        keys.push_back(key);
+    }
+
+    std::map<std::pair<size_t, size_t>, long> affinity;
+    for (auto const &[move, count]: d_transitions)
+    {
+        auto const from = owners.find(move.first);
+        auto const to = owners.find(move.second);
+        if (from == owners.end() || to == owners.end())
+            continue;
+
+        for (size_t const v: from->second)
+            for (size_t const w: to->second)
+                if (v != w)
+                    affinity[{std::min(v, w), std::max(v, w)}] += count;
+    }
+
+    std::vector<std::vector<std::pair<long, size_t>>> partners(keys.size());
+    for (auto const &[pr, count]: affinity)
+    {
+        partners[pr.first].push_back({count, pr.second});
+        partners[pr.second].push_back({count, pr.first});
+    }
+
+    for (size_t v = 0; v != keys.size(); ++v)
+    {
+        auto &list = partners[v];
+        std::stable_sort(list.begin(), list.end(),
+                         [](auto const &a, auto const &b)
+                         {
+                             return a.first > b.first;
+                         });
+        for (auto const &[count, w]: list)
+            d_partners[keys[v]].push_back(keys[w]);
+    }
+}
+
+std::vector<std::string> const &LayoutProfile::partners(std::string const &key) const
+{
+    static std::vector<std::string> const none;
+    auto const it = d_partners.find(key);
+    return (it != d_partners.end()) ? it->second : none;
+}
+
+std::vector<size_t> LayoutProfile::fieldOrder(std::string const &structName,
+                                              std::vector<std::string> const &fieldNames) const
+{
+    // Fields are ordered by the number of visits per cell, such that the hot fields
+    // end up together at the end of the struct, closest to the variables and temps
+    // that are allocated after it. Fields without any visits keep their order.
+    std::vector<size_t> order(fieldNames.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    std::vector<long> density;
+    for (auto const &field: fieldNames)
+        density.push_back(densityOf(fieldKey(structName, field)));
+
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t const i, size_t const j)
+                     {
+                         return density[i] < density[j];
+                     });
+    return order;
+}
+
+long LayoutProfile::densityOf(std::string const &key) const
+{
+    auto const it = d_cells.find(key);
+    if (it == d_cells.end())
+        return 0;
+
+    std::set<int> addresses;
+    for (auto const &[addr, size]: it->second)
+        for (int i = 0; i != size; ++i)
+            addresses.insert(addr + i);
+
+    long heat = 0;
+    for (int const addr: addresses)
+    {
+        auto const h = d_heat.find(addr);
+        heat += (h != d_heat.end()) ? h->second : 0;
+    }
+    return heat / static_cast<long>(addresses.size());
+}
+
+std::string LayoutProfile::variableKey(std::string const &ident, std::string const &function)
+{
+    return function.empty() ? ident : (function + "::" + ident);
+}
+
+std::string LayoutProfile::fieldKey(std::string const &structName, std::string const &field)
+{
+    return structName + "." + field;
+}
@@ -0,0 +1,37 @@
+#ifndef LAYOUTPROFILE_H
+#define LAYOUTPROFILE_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+
+// Reads one or more profiles (written by bfx --profile or bfint --heatmap) and
+// derives a layout from them: variables that are frequently visited one after the
+// other are placed next to each other, and the fields of a struct are ordered by
+// how often they are visited.
+
+class LayoutProfile
+{
+    using CellSet = std::set<std::pair<int, int>>; // {address, size}
+
+    std::map<int, long>                             d_heat;
+    std::map<std::pair<int, int>, long>             d_transitions;
+    std::map<std::string, CellSet>                  d_cells;
+    std::map<std::string, std::vector<std::string>> d_partners;
+
+public:
+    bool load(std::string const &filename);
+    void computeLayout();
+    std::vector<std::string> const &partners(std::string const &key) const;
+    std::vector<size_t> fieldOrder(std::string const &structName,
+                                   std::vector<std::string> const &fieldNames) const;
+
+    static std::string variableKey(std::string const &ident, std::string const &function);
+    static std::string fieldKey(std::string const &structName, std::string const &field);
+
+private:
+    long densityOf(std::string const &key) const;
+};
+
+#endif //LAYOUTPROFILE_H
@@ -49,7 +49,7 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    46, -1},  // 1
+         -1,-1,-1,-1,-1,-1,    49, -1},  // 1
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -57,119 +57,119 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,32,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    46, -1},  // 3
+         -1,-1,-1,-1,-1,-1,    49, -1},  // 3
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    42, -1},  // 4
+         -1,-1,-1,-1,-1,-1,    45, -1},  // 4
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,33,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    46, -1},  // 5
+         -1,-1,-1,-1,-1,-1,    49, -1},  // 5
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,34,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    46, -1},  // 6
+         -1,-1,-1,-1,-1,-1,    49, -1},  // 6
     {35,35,-1,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
          35,35,35,35,35,35,35,35,35,35,36,35,35,35,35,35,35,35,35,35,
          35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
-         35,35,35,35,35,-1,    46, -1},  // 7
+         35,35,35,35,35,-1,    49, -1},  // 7
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,37,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    46, -1},  // 8
+         -1,-1,-1,-1,-1,-1,    49, -1},  // 8
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,38,-1,-1,-1,
          -1,-1,-1,-1,39,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    46, -1},  // 9
+         -1,-1,-1,-1,-1,-1,    49, -1},  // 9
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,40,-1,
          -1,-1,-1,-1,41,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    46, -1},  // 10
+         -1,-1,-1,-1,-1,-1,    49, -1},  // 10
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,42,-1,-1,-1,-1,
          43,-1,-1,-1,44,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    46, -1},  // 11
+         -1,-1,-1,-1,-1,-1,    49, -1},  // 11
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,12,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    38, -1},  // 12
+         -1,-1,-1,-1,-1,-1,    41, -1},  // 12
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,45,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+         -1,-1,-1,163,45,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    46, -1},  // 13
+         -1,-1,-1,-1,-1,-1,    49, -1},  // 13
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,46,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    46, -1},  // 14
+         -1,-1,-1,-1,-1,-1,    49, -1},  // 14
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,47,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+         -1,-1,-1,-1,47,164,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    46, -1},  // 15
+         -1,-1,-1,-1,-1,-1,    49, -1},  // 15
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,48,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    46, -1},  // 16
+         -1,-1,-1,-1,-1,-1,    49, -1},  // 16
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 17
+         17,-1,-1,-1,-1,-1,    42, -1},  // 17
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,49,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+         -1,-1,-1,-1,49,-1,-1,-1,-1,-1,-1,-1,165,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    46, -1},  // 18
+         -1,-1,-1,-1,-1,-1,    49, -1},  // 18
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,50,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 19
+         17,-1,-1,-1,-1,-1,    42, -1},  // 19
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,51,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 20
+         17,-1,-1,-1,-1,-1,    42, -1},  // 20
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,52,17,17,17,17,
          17,17,17,17,17,17,17,17,17,53,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 21
+         17,-1,-1,-1,-1,-1,    42, -1},  // 21
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,54,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 22
+         17,-1,-1,-1,-1,-1,    42, -1},  // 22
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,55,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 23
+         17,-1,-1,-1,-1,-1,    42, -1},  // 23
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,56,17,17,17,17,17,57,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 24
+         17,-1,-1,-1,-1,-1,    42, -1},  // 24
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,58,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 25
+         17,-1,-1,-1,-1,-1,    42, -1},  // 25
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          59,17,17,17,17,17,17,17,60,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 26
+         17,-1,-1,-1,-1,-1,    42, -1},  // 26
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,61,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 27
+         17,-1,-1,-1,-1,-1,    42, -1},  // 27
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,62,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 28
+         17,-1,-1,-1,-1,-1,    42, -1},  // 28
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,63,17,17,17,17,17,17,17,17,17,17,64,17,17,65,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 29
+         17,-1,-1,-1,-1,-1,    42, -1},  // 29
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,66,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 30
+         17,-1,-1,-1,-1,-1,    42, -1},  // 30
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,67,-1,-1,-1,    46, -1},  // 31
+         -1,-1,67,-1,-1,-1,    49, -1},  // 31
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -213,11 +213,11 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    44, -1},  // 42
+         -1,-1,-1,-1,-1,-1,    47, -1},  // 42
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    43, -1},  // 43
+         -1,-1,-1,-1,-1,-1,    46, -1},  // 43
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,72,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -245,39 +245,39 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,74,17,75,76,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 50
+         17,-1,-1,-1,-1,-1,    42, -1},  // 50
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,77,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 51
+         17,-1,-1,-1,-1,-1,    42, -1},  // 51
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,78,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 52
+         17,-1,-1,-1,-1,-1,    42, -1},  // 52
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,79,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 53
+         17,-1,-1,-1,-1,-1,    42, -1},  // 53
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          80,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 54
+         17,-1,-1,-1,-1,-1,    42, -1},  // 54
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,81,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 55
+         17,-1,-1,-1,-1,-1,    42, -1},  // 55
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,82,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 56
+         17,-1,-1,-1,-1,-1,    42, -1},  // 56
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,83,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 57
+         17,-1,-1,-1,-1,-1,    42, -1},  // 57
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,84,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 58
+         17,-1,-1,-1,-1,-1,    42, -1},  // 58
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
@@ -285,31 +285,31 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,85,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 60
+         17,-1,-1,-1,-1,-1,    42, -1},  // 60
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,86,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 61
+         17,-1,-1,-1,-1,-1,    42, -1},  // 61
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,87,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 62
+         17,-1,-1,-1,-1,-1,    42, -1},  // 62
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         88,-1,-1,-1,-1,-1,    39, -1},  // 63
+         88,-1,-1,-1,-1,-1,    42, -1},  // 63
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,89,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,90,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 64
+         17,-1,-1,-1,-1,-1,    42, -1},  // 64
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,91,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 65
+         17,-1,-1,-1,-1,-1,    42, -1},  // 65
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,92,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 66
+         17,-1,-1,-1,-1,-1,    42, -1},  // 66
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -321,7 +321,7 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    40, -1},  // 69
+         -1,-1,-1,-1,-1,-1,    43, -1},  // 69
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,93,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -329,7 +329,7 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,93,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    40, -1},  // 71
+         -1,-1,-1,-1,-1,-1,    43, -1},  // 71
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -341,35 +341,35 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,95,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 74
+         17,-1,-1,-1,-1,-1,    42, -1},  // 74
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,96,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 75
+         17,-1,-1,-1,-1,-1,    42, -1},  // 75
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,97,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 76
+         17,-1,-1,-1,-1,-1,    42, -1},  // 76
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,98,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 77
+         17,-1,-1,-1,-1,-1,    42, -1},  // 77
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,99,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 78
+         17,-1,-1,-1,-1,-1,    42, -1},  // 78
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,100,101,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 79
+         17,-1,-1,-1,-1,-1,    42, -1},  // 79
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,102,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 80
+         17,-1,-1,-1,-1,-1,    42, -1},  // 80
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,103,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 81
+         17,-1,-1,-1,-1,-1,    42, -1},  // 81
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
@@ -377,15 +377,15 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,104,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 83
+         17,-1,-1,-1,-1,-1,    42, -1},  // 83
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,105,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 84
+         17,-1,-1,-1,-1,-1,    42, -1},  // 84
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,106,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 85
+         17,-1,-1,-1,-1,-1,    42, -1},  // 85
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
@@ -393,31 +393,31 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,107,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 87
+         17,-1,-1,-1,-1,-1,    42, -1},  // 87
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,108,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 88
+         17,-1,-1,-1,-1,-1,    42, -1},  // 88
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,109,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 89
+         17,-1,-1,-1,-1,-1,    42, -1},  // 89
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,110,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 90
+         17,-1,-1,-1,-1,-1,    42, -1},  // 90
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,111,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 91
+         17,-1,-1,-1,-1,-1,    42, -1},  // 91
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,112,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 92
+         17,-1,-1,-1,-1,-1,    42, -1},  // 92
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    41, -1},  // 93
+         -1,-1,-1,-1,-1,-1,    44, -1},  // 93
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,113,-1,-1,-1,-1,-1,-1,-1,
@@ -425,19 +425,19 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,114,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 95
+         17,-1,-1,-1,-1,-1,    42, -1},  // 95
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,115,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 96
+         17,-1,-1,-1,-1,-1,    42, -1},  // 96
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,116,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 97
+         17,-1,-1,-1,-1,-1,    42, -1},  // 97
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,117,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 98
+         17,-1,-1,-1,-1,-1,    42, -1},  // 98
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
@@ -445,15 +445,15 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,118,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 100
+         17,-1,-1,-1,-1,-1,    42, -1},  // 100
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,119,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 101
+         17,-1,-1,-1,-1,-1,    42, -1},  // 101
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,120,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 102
+         17,-1,-1,-1,-1,-1,    42, -1},  // 102
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
@@ -461,39 +461,39 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,121,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 104
+         17,-1,-1,-1,-1,-1,    42, -1},  // 104
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,122,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 105
+         17,-1,-1,-1,-1,-1,    42, -1},  // 105
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,123,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 106
+         17,-1,-1,-1,-1,-1,    42, -1},  // 106
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,124,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 107
+         17,-1,-1,-1,-1,-1,    42, -1},  // 107
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,125,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 108
+         17,-1,-1,-1,-1,-1,    42, -1},  // 108
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,126,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 109
+         17,-1,-1,-1,-1,-1,    42, -1},  // 109
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,127,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 110
+         17,-1,-1,-1,-1,-1,    42, -1},  // 110
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,128,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 111
+         17,-1,-1,-1,-1,-1,    42, -1},  // 111
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,129,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 112
+         17,-1,-1,-1,-1,-1,    42, -1},  // 112
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,130,-1,-1,-1,-1,-1,
@@ -501,15 +501,15 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,131,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 114
+         17,-1,-1,-1,-1,-1,    42, -1},  // 114
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,132,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 115
+         17,-1,-1,-1,-1,-1,    42, -1},  // 115
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,133,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 116
+         17,-1,-1,-1,-1,-1,    42, -1},  // 116
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
@@ -521,43 +521,43 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,134,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 119
+         17,-1,-1,-1,-1,-1,    42, -1},  // 119
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,135,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 120
+         17,-1,-1,-1,-1,-1,    42, -1},  // 120
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,136,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 121
+         17,-1,-1,-1,-1,-1,    42, -1},  // 121
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,137,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 122
+         17,-1,-1,-1,-1,-1,    42, -1},  // 122
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,138,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 123
+         17,-1,-1,-1,-1,-1,    42, -1},  // 123
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,139,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 124
+         17,-1,-1,-1,-1,-1,    42, -1},  // 124
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          140,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 125
+         17,-1,-1,-1,-1,-1,    42, -1},  // 125
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,141,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 126
+         17,-1,-1,-1,-1,-1,    42, -1},  // 126
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,142,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 127
+         17,-1,-1,-1,-1,-1,    42, -1},  // 127
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,143,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 128
+         17,-1,-1,-1,-1,-1,    42, -1},  // 128
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
@@ -569,27 +569,27 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,145,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 131
+         17,-1,-1,-1,-1,-1,    42, -1},  // 131
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    36, -1},  // 132
+         17,-1,-1,-1,-1,-1,    39, -1},  // 132
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    34, -1},  // 133
+         17,-1,-1,-1,-1,-1,    37, -1},  // 133
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,146,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 134
+         17,-1,-1,-1,-1,-1,    42, -1},  // 134
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,147,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 135
+         17,-1,-1,-1,-1,-1,    42, -1},  // 135
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,148,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 136
+         17,-1,-1,-1,-1,-1,    42, -1},  // 136
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
@@ -597,7 +597,7 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,149,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 138
+         17,-1,-1,-1,-1,-1,    42, -1},  // 138
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
@@ -605,11 +605,11 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    37, -1},  // 140
+         17,-1,-1,-1,-1,-1,    40, -1},  // 140
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,150,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 141
+         17,-1,-1,-1,-1,-1,    42, -1},  // 141
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
@@ -625,11 +625,11 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    35, -1},  // 145
+         17,-1,-1,-1,-1,-1,    38, -1},  // 145
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,152,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 146
+         17,-1,-1,-1,-1,-1,    42, -1},  // 146
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
@@ -637,7 +637,7 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,153,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 148
+         17,-1,-1,-1,-1,-1,    42, -1},  // 148
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
@@ -645,7 +645,7 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,154,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 150
+         17,-1,-1,-1,-1,-1,    42, -1},  // 150
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,155,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -661,7 +661,7 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,156,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 154
+         17,-1,-1,-1,-1,-1,    42, -1},  // 154
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,157,-1,-1,-1,-1,-1,-1,
@@ -669,7 +669,7 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,158,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 156
+         17,-1,-1,-1,-1,-1,    42, -1},  // 156
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,159,-1,-1,-1,-1,-1,
@@ -677,23 +677,35 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,160,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 158
+         17,-1,-1,-1,-1,-1,    42, -1},  // 158
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    45, -1},  // 159
+         -1,-1,-1,-1,-1,-1,    48, -1},  // 159
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,161,17,17,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 160
+         17,-1,-1,-1,-1,-1,    42, -1},  // 160
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,162,17,17,17,17,17,
-         17,-1,-1,-1,-1,-1,    39, -1},  // 161
+         17,-1,-1,-1,-1,-1,    42, -1},  // 161
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,17,-1,-1,-1,-1,-1,-1,17,-1,-1,-1,-1,17,-1,17,17,17,17,17,
          17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
          17,-1,-1,-1,-1,-1,    17, -1},  // 162
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+         -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+         -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+         -1,-1,-1,-1,-1,-1,    34, -1},  // 163
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+         -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+         -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+         -1,-1,-1,-1,-1,-1,    35, -1},  // 164
+    {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+         -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+         -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+         -1,-1,-1,-1,-1,-1,    36, -1},  // 165
     // string
     { 1, 1,-1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
           1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1,
@@ -702,19 +714,19 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    49, -1},  // 1
+         -1,-1,-1,-1,-1,-1,    52, -1},  // 1
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    47, -1},  // 2
+         -1,-1,-1,-1,-1,-1,    50, -1},  // 2
     { 4, 4,-1, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
           4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
           4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-          4, 4, 4, 4, 4,-1,    49, -1},  // 3
+          4, 4, 4, 4, 4,-1,    52, -1},  // 3
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    48, -1},  // 4
+         -1,-1,-1,-1,-1,-1,    51, -1},  // 4
     // character
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -728,11 +740,11 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    51, -1},  // 1
+         -1,-1,-1,-1,-1,-1,    54, -1},  // 1
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    50, -1},  // 2
+         -1,-1,-1,-1,-1,-1,    53, -1},  // 2
     // ccomment
     { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1,
           3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
@@ -741,23 +753,23 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    54, -1},  // 1
+         -1,-1,-1,-1,-1,-1,    57, -1},  // 1
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
           4,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    54, -1},  // 2
+         -1,-1,-1,-1,-1,-1,    57, -1},  // 2
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1, 5,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    54, -1},  // 3
+         -1,-1,-1,-1,-1,-1,    57, -1},  // 3
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    53, -1},  // 4
+         -1,-1,-1,-1,-1,-1,    56, -1},  // 4
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    52, -1},  // 5
+         -1,-1,-1,-1,-1,-1,    55, -1},  // 5
     // test
     { 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
           3, 1, 1, 4, 1, 4, 1, 5, 6, 1, 1, 1, 1, 6, 7, 6, 6, 6, 6, 6,
@@ -766,39 +778,39 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    63, -1},  // 1
+         -1,-1,-1,-1,-1,-1,    66, -1},  // 1
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    57, -1},  // 2
+         -1,-1,-1,-1,-1,-1,    60, -1},  // 2
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1, 8,-1,-1,-1,-1,
           9,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    63, -1},  // 3
+         -1,-1,-1,-1,-1,-1,    66, -1},  // 3
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    55, -1},  // 4
+         -1,-1,-1,-1,-1,-1,    58, -1},  // 4
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,10,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    63, -1},  // 5
+         -1,-1,-1,-1,-1,-1,    66, -1},  // 5
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1, 6,-1,-1,-1,-1,-1,-1, 6,-1,-1,-1,-1, 6,-1, 6, 6, 6, 6, 6,
           6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
-          6,-1,-1,-1,-1,-1,    56, -1},  // 6
+          6,-1,-1,-1,-1,-1,    59, -1},  // 6
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,11,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    63, -1},  // 7
+         -1,-1,-1,-1,-1,-1,    66, -1},  // 7
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    62, -1},  // 8
+         -1,-1,-1,-1,-1,-1,    65, -1},  // 8
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    61, -1},  // 9
+         -1,-1,-1,-1,-1,-1,    64, -1},  // 9
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,12,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -878,7 +890,7 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    60, -1},  // 29
+         -1,-1,-1,-1,-1,-1,    63, -1},  // 29
     {-1,30,32,-1,-1,-1,30,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -886,11 +898,11 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,28,31,-1,-1,-1,28,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    -1, 58},  // 31
+         -1,-1,-1,-1,-1,-1,    -1, 61},  // 31
     {-1,30,32,-1,-1,-1,30,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    -1, 59},  // 32
+         -1,-1,-1,-1,-1,-1,    -1, 62},  // 32
     // test_content
     { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
           1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 4, 1, 1, 1, 1, 1,
@@ -899,31 +911,31 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    68, -1},  // 1
+         -1,-1,-1,-1,-1,-1,    71, -1},  // 1
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1, 5,-1,-1,-1,-1,    68, -1},  // 2
+         -1, 5,-1,-1,-1,-1,    71, -1},  // 2
     { 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
           6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
           6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
-          6, 6, 6, 6, 6,-1,    68, -1},  // 3
+          6, 6, 6, 6, 6,-1,    71, -1},  // 3
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1, 8,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    68, -1},  // 4
+         -1,-1,-1,-1,-1,-1,    71, -1},  // 4
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    66, -1},  // 5
+         -1,-1,-1,-1,-1,-1,    69, -1},  // 5
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    65, -1},  // 6
+         -1,-1,-1,-1,-1,-1,    68, -1},  // 6
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    64, -1},  // 7
+         -1,-1,-1,-1,-1,-1,    67, -1},  // 7
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1, 9,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -935,7 +947,7 @@ int const ScannerBase::s_dfa_[][68] =
     {-1, 9,10,-1,-1,-1, 9,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    -1, 67},  // 10
+         -1,-1,-1,-1,-1,-1,    -1, 70},  // 10
     // escape_test_content
     { 1, 1,-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
           1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
@@ -944,24 +956,24 @@ int const ScannerBase::s_dfa_[][68] =
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    70, -1},  // 1
+         -1,-1,-1,-1,-1,-1,    73, -1},  // 1
     {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
          -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
-         -1,-1,-1,-1,-1,-1,    69, -1},  // 2
+         -1,-1,-1,-1,-1,-1,    72, -1},  // 2
 };
 
 
 int const (*ScannerBase::s_dfaBase_[])[68] =
 {
     s_dfa_ + 0,
-    s_dfa_ + 163,
-    s_dfa_ + 168,
-    s_dfa_ + 169,
+    s_dfa_ + 166,
+    s_dfa_ + 171,
     s_dfa_ + 172,
-    s_dfa_ + 178,
-    s_dfa_ + 211,
-    s_dfa_ + 222,
+    s_dfa_ + 175,
+    s_dfa_ + 181,
+    s_dfa_ + 214,
+    s_dfa_ + 225,
 };
 
 size_t ScannerBase::s_istreamNr = 0;
@@ -1518,51 +1530,69 @@ try
         case 34:
         {
 #line 53 "lexer"
-            return CompilerBase::SCAN;
+            return CompilerBase::SHL;
         }
         break;
         case 35:
         {
 #line 54 "lexer"
-            return CompilerBase::PRINT;
+            return CompilerBase::SHR;
         }
         break;
         case 36:
         {
 #line 55 "lexer"
-            return CompilerBase::RAND;
+            return CompilerBase::XOR;
         }
         break;
         case 37:
         {
 #line 56 "lexer"
-            return CompilerBase::SIZEOF;
+            return CompilerBase::SCAN;
         }
         break;
         case 38:
         {
-#line 58 "lexer"
-            return CompilerBase::NUM;
+#line 57 "lexer"
+            return CompilerBase::PRINT;
         }
         break;
         case 39:
         {
-#line 59 "lexer"
-            return CompilerBase::IDENT;
+#line 58 "lexer"
+            return CompilerBase::RAND;
         }
         break;
         case 40:
         {
+#line 59 "lexer"
+            return CompilerBase::SIZEOF;
+        }
+        break;
+        case 41:
+        {
 #line 61 "lexer"
+            return CompilerBase::NUM;
+        }
+        break;
+        case 42:
+        {
+#line 62 "lexer"
+            return CompilerBase::IDENT;
+        }
+        break;
+        case 43:
+        {
+#line 64 "lexer"
             {
                 setMatched(matched().substr(1, 1));
                 return CompilerBase::CHR;
             }
         }
         break;
-        case 41:
+        case 44:
         {
-#line 65 "lexer"
+#line 68 "lexer"
             {
                 char escaped = escape(matched()[2]);
                 setMatched(std::string(1, escaped));
@@ -1570,49 +1600,49 @@ try
             }
         }
         break;
-        case 42:
+        case 45:
         {
-#line 71 "lexer"
+#line 74 "lexer"
             {
                 pushStartCondition(StartCondition_::string);
             }
         }
         break;
-        case 43:
+        case 46:
         {
-#line 75 "lexer"
+#line 78 "lexer"
             {
                 pushStartCondition(StartCondition_::eolcomment);
             }
         }
         break;
-        case 44:
+        case 47:
         {
-#line 79 "lexer"
+#line 82 "lexer"
             {
                 ++d_nestedCommentLevel;
                 pushStartCondition(StartCondition_::ccomment);
             }
         }
         break;
-        case 45:
+        case 48:
         {
-#line 85 "lexer"
+#line 88 "lexer"
             {
                 pushStartCondition(StartCondition_::test);
                 return CompilerBase::START_TEST;
             }
         }
         break;
-        case 46:
+        case 49:
         {
-#line 90 "lexer"
+#line 93 "lexer"
             return matched()[0];
         }
         break;
-        case 47:
+        case 50:
         {
-#line 93 "lexer"
+#line 96 "lexer"
             {
                 popStartCondition();
                 setMatched(matched().substr(0, matched().size() - 1));
@@ -1620,9 +1650,9 @@ try
             }
         }
         break;
-        case 48:
+        case 51:
         {
-#line 99 "lexer"
+#line 102 "lexer"
             {
                 char escaped = escape(matched().back());
                 setMatched(matched().substr(0, matched().size() - 2) + escaped);
@@ -1630,137 +1660,137 @@ try
             }
         }
         break;
-        case 49:
+        case 52:
         {
-#line 105 "lexer"
+#line 108 "lexer"
             more();
         }
         break;
-        case 50:
+        case 53:
         {
-#line 109 "lexer"
+#line 112 "lexer"
             popStartCondition();
         }
         break;
-        case 52:
+        case 55:
         {
-#line 114 "lexer"
+#line 117 "lexer"
             {
                 ++d_nestedCommentLevel;
             }
         }
         break;
-        case 53:
+        case 56:
         {
-#line 117 "lexer"
+#line 120 "lexer"
             {
                 if (--d_nestedCommentLevel == 0)
                 popStartCondition();
             }
         }
         break;
-        case 55:
+        case 58:
         {
-#line 126 "lexer"
+#line 129 "lexer"
             return matched()[0];
         }
         break;
-        case 56:
+        case 59:
         {
-#line 127 "lexer"
+#line 130 "lexer"
             return CompilerBase::IDENT;
         }
         break;
-        case 57:
+        case 60:
         {
-#line 129 "lexer"
+#line 132 "lexer"
             {
                 more();
                 pushStartCondition(StartCondition_::string);
             }
         }
         break;
-        case 58:
+        case 61:
         {
-#line 133 "lexer"
+#line 136 "lexer"
             {
                 pushStartCondition(StartCondition_::test_content);
                 return CompilerBase::INPUT;
             }
         }
         break;
-        case 59:
+        case 62:
         {
-#line 138 "lexer"
+#line 141 "lexer"
             {
                 pushStartCondition(StartCondition_::test_content);
                 return CompilerBase::EXPECT;
             }
         }
         break;
-        case 60:
+        case 63:
         {
-#line 143 "lexer"
+#line 146 "lexer"
             {
                 popStartCondition();
                 return CompilerBase::END_TEST;
             }
         }
         break;
-        case 61:
+        case 64:
         {
-#line 148 "lexer"
+#line 151 "lexer"
             {
                 pushStartCondition(StartCondition_::eolcomment);
             }
         }
         break;
-        case 62:
+        case 65:
         {
-#line 152 "lexer"
+#line 155 "lexer"
             {
                 ++d_nestedCommentLevel;
                 pushStartCondition(StartCondition_::ccomment);
             }
         }
         break;
-        case 65:
+        case 68:
         {
-#line 165 "lexer"
+#line 168 "lexer"
             {
                 setMatched(std::string(1, escape(matched()[1])));
                 return CompilerBase::CHR;
             }
         }
         break;
-        case 66:
+        case 69:
         {
-#line 170 "lexer"
+#line 173 "lexer"
             {
                 pushStartCondition(StartCondition_::escape_test_content);
             }
         }
         break;
-        case 67:
+        case 70:
         {
-#line 175 "lexer"
+#line 178 "lexer"
             {
                 popStartCondition();
                 return CompilerBase::END_TEST_CONTENT;
             }
         }
         break;
-        case 68:
+        case 71:
         {
-#line 180 "lexer"
+#line 183 "lexer"
             {
                 return CompilerBase::CHR;
             }
         }
         break;
-        case 69:
+        case 72:
         {
-#line 188 "lexer"
+#line 191 "lexer"
             {
                 char c = escapeTestContent(matched().substr(0, matched().size() - 1));
                 setMatched(std::string(1, c));
@@ -1769,9 +1799,9 @@ try
             }
         }
         break;
-        case 70:
+        case 73:
         {
-#line 195 "lexer"
+#line 198 "lexer"
             more();
         }
         break;
@@ -11,7 +11,7 @@ void printHelp(std::string const &progName)
               << "Options:\n"
               << "-h, --help          Display this text.\n"
               << "-t, --type [Type]   Specify the number of bytes per BF-cell, where [Type] is one of\n"
-                 "                    int8, int16 and int32 (int8 by default).\n"
+                 "                    int8, int16, int32 and int64 (int8 by default).\n"
               << "-I [path to folder] Specify additional include-path.\n"
               << "                      This option may appear multiple times to specify multiple folders.\n"
               << "-O0                 Do NOT do any constant expression evaluation.\n"
@@ -25,6 +25,9 @@ void printHelp(std::string const &progName)
               << "                      Your interpreter must support this extension!\n"
               << "--profile [file]    Write the memory profile to a file. In this file, the number of visits\n"
               << "                      to each of the cells is listed.\n"
+              << "--layout-profile [file]\n"
+              << "                    Place variables according to a profile written by --profile\n"
+              << "                      or bfint --heatmap. May appear multiple times to combine profiles.\n"
               << "--no-bcr            Disable break/continue/return statements for more compact output.\n"
               << "--no-multiple-inclusion-warning\n"
               << "                    Do not warn when a file is included more than once, or when files \n"
@@ -57,7 +60,8 @@ std::pair<Compiler::Options, int> parseCmdLine(std::vector<std::string> const &a
             static std::map<std::string, Compiler::CellType> const getType{
                 {"int8", Compiler::CellType::INT8},
                 {"int16", Compiler::CellType::INT16},
-                {"int32", Compiler::CellType::INT32}
+                {"int32", Compiler::CellType::INT32},
+                {"int64", Compiler::CellType::INT64}
             };
 
             auto tolower = [](std::string str)->std::string
@@ -173,6 +177,17 @@ std::pair<Compiler::Options, int> parseCmdLine(std::vector<std::string> const &a
             idx += 2;
 
         }
+        else if (args[idx] == "--layout-profile")
+        {
+            if (idx == args.size() - 1)
+            {
+                std::cerr << "ERROR: No filename passed to option \'--layout-profile\'.\n";
+                return {opt, 1};
+            }
+
+            opt.layoutProfiles.push_back(args[idx + 1]);
+            idx += 2;
+        }
         else if (args[idx] == "--no-bcr")
         {
             opt.bcrEnabled = false;
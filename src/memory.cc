@@ -7,7 +7,170 @@ void Memory::Cell::clear()
     content = Content::EMPTY;
     type = TypeSystem::Type{};
     value = 0;
+    known = true;
     synced = false;
+    prev = -1;
+    next = -1;
+    header = 0;
+    literal = false;
+    lower = 0;
+    upper = -1;
+    pinned = false;
+}
+
+Memory::Cell &Memory::modify(int const addr)
+{
+    assert(addr >= 0 && addr < (int)d_memory.size() && "address out of bounds");
+    if (d_checkpoints > 0)
+        d_cellLog.push_back({addr, d_memory[addr]});
+
+    return d_memory[addr];
+}
+
+Memory::Cell &Memory::write(int const addr)
+{
+    // Versions are never reused, not even after a rollback
+    Cell &cell = modify(addr);
+    cell.version = ++d_versions;
+    return cell;
+}
+
+void Memory::setHead(std::string const &scope, int const addr)
+{
+    auto const it = d_scopeHead.find(scope);
+    if (d_checkpoints > 0)
+        d_headLog.push_back({scope, (it != d_scopeHead.end()) ? it->second : -1});
+
+    if (addr == -1)
+    {
+        if (it != d_scopeHead.end())
+            d_scopeHead.erase(it);
+    }
+    else if (it != d_scopeHead.end())
+        it->second = addr;
+    else
+        d_scopeHead.insert({scope, addr});
+}
+
+Memory::AliasVector &Memory::modifyAliases(int const addr)
+{
+    AliasVector &aliases = d_aliasMap[addr];
+    if (d_checkpoints > 0)
+        d_aliasLog.push_back({addr, aliases});
+
+    return aliases;
+}
+
+Memory::Checkpoint Memory::checkpoint()
+{
+    ++d_checkpoints;
+    return {
+            .cellLogSize  = d_cellLog.size(),
+            .headLogSize  = d_headLog.size(),
+            .aliasLogSize = d_aliasLog.size(),
+            .maxAddr        = d_maxAddr,
+            .cellsInUse     = d_cellsInUse,
+            .peakCellsInUse = d_peakCellsInUse
+    };
+}
+
+void Memory::rollback(Checkpoint const &cp)
+{
+    // Undo all changes in reverse order
+    while (d_cellLog.size() > cp.cellLogSize)
+    {
+        auto &[addr, cell] = d_cellLog.back();
+        d_memory[addr] = std::move(cell);
+        d_cellLog.pop_back();
+    }
+
+    while (d_headLog.size() > cp.headLogSize)
+    {
+        auto const &[scope, head] = d_headLog.back();
+        if (head == -1)
+            d_scopeHead.erase(scope);
+        else
+            d_scopeHead[scope] = head;
+        d_headLog.pop_back();
+    }
+
+    while (d_aliasLog.size() > cp.aliasLogSize)
+    {
+        auto &[addr, aliases] = d_aliasLog.back();
+        d_aliasMap[addr] = std::move(aliases);
+        d_aliasLog.pop_back();
+    }
+
+    d_maxAddr = cp.maxAddr;
+    d_cellsInUse = cp.cellsInUse;
+    d_peakCellsInUse = cp.peakCellsInUse;
+    commit(cp);
+}
+
+void Memory::commit(Checkpoint const &)
+{
+    assert(d_checkpoints > 0 && "commit without matching checkpoint");
+
+    // Changes can only be discarded once no enclosing checkpoint needs them
+    if (--d_checkpoints == 0)
+    {
+        d_cellLog.clear();
+        d_headLog.clear();
+        d_aliasLog.clear();
+    }
+}
+
+void Memory::link(int const addr)
+{
+    std::string const &scope = d_memory[addr].scope;
+    auto const it = d_scopeHead.find(scope);
+    int const head = (it != d_scopeHead.end()) ? it->second : -1;
+
+    Cell &cell = modify(addr);
+    cell.next = head;
+    cell.prev = -1;
+    if (head != -1)
+        modify(head).prev = addr;
+
+    setHead(scope, addr);
+}
+
+void Memory::unlink(int const addr)
+{
+    Cell &cell = modify(addr);
+    int const prev = cell.prev;
+    int const next = cell.next;
+    cell.prev = -1;
+    cell.next = -1;
+
+    if (prev != -1)
+        modify(prev).next = next;
+    else
+        setHead(d_memory[addr].scope, next);
+
+    if (next != -1)
+        modify(next).prev = prev;
+}
+
+void Memory::free(int const addr)
+{
+    int const sz = d_memory[addr].size();
+    int const header = d_memory[addr].header;
+    for (int offset = -header; offset < sz; ++offset)
+    {
+        if (offset != 0)
+            write(addr + offset).clear();
+    }
+
+    unlink(addr);
+    write(addr).clear();
+    addCellsInUse(-(sz + header));
+}
+
+void Memory::addCellsInUse(int const n)
+{
+    d_cellsInUse += n;
+    d_peakCellsInUse = std::max(d_peakCellsInUse, d_cellsInUse);
 }
         
 int Memory::findFree(int const sz)
@@ -31,64 +194,141 @@ int Memory::findFree(int const sz)
     return findFree(sz);
 }
 
-int Memory::getTemp(std::string const &scope, TypeSystem::Type type)
+int Memory::findFreeNear(int const sz, int const near, bool const confined)
+{
+    // Find the free block of sz cells closest to the given address, by scanning
+    // outwards in both directions. When confined, the search is limited to the part
+    // of the tape that is already in use, so the footprint only grows when it is full.
+
+    if (!confined && near >= 0 && near + sz > (int)d_memory.size())
+        d_memory.resize(near + sz);
+    
+    int const tapeSize = confined ? d_maxAddr : (int)d_memory.size();
+    if (near < 0 || tapeSize == 0)
+        return findFree(sz);
+
+    int const origin = std::min(near, tapeSize - 1);
+
+    int right = -1;
+    for (int start = origin, run = 0; start + run < tapeSize; )
+    {
+        if (!d_memory[start + run].empty())
+        {
+            start += run + 1;
+            run = 0;
+        }
+        else if (++run == sz)
+        {
+            right = start;
+            break;
+        }
+    }
+
+    int left = -1;
+    for (int end = origin - 1, run = 0; end - run >= 0; )
+    {
+        if (!d_memory[end - run].empty())
+        {
+            end -= run + 1;
+            run = 0;
+        }
+        else if (++run == sz)
+        {
+            left = end - sz + 1;
+            break;
+        }
+    }
+
+    if (left == -1 && right == -1)
+        return findFree(sz);
+    if (left == -1)
+        return right;
+    if (right == -1)
+        return left;
+
+    return (origin - (left + sz - 1) < right - origin) ? left : right;
+}
+
+int Memory::getTemp(std::string const &scope, TypeSystem::Type type, int const near)
 {
-    return allocate("", scope, type);
+    return allocate("", scope, type, near);
 }
 
-int Memory::getTemp(std::string const &scope, int const sz)
+int Memory::getTemp(std::string const &scope, int const sz, int const near)
 {
-    return getTemp(scope, TypeSystem::Type(sz));
+    return getTemp(scope, TypeSystem::Type(sz), near);
 }
 
-int Memory::getTempBlock(std::string const &scope, int const sz)
+int Memory::getTempBlock(std::string const &scope, int const sz, int const near)
 {
-    int start = findFree(sz);
+    int start = findFreeNear(sz, near, true);
     for (int i = 0; i != sz; ++i)
     {
-        Cell &cell = d_memory[start + i];
+        Cell &cell = write(start + i);
         cell.clear();
         cell.scope = scope;
         cell.type = TypeSystem::Type(1);
         cell.content = Content::TEMP;
+        link(start + i);
     }
 
+    if (start + sz > d_maxAddr)
+        d_maxAddr = start + sz;
+
+    addCellsInUse(sz);
     return start;
 }
 
-int Memory::allocate(std::string const &ident, std::string const &scope, TypeSystem::Type type)
+int Memory::allocate(std::string const &ident, std::string const &scope, TypeSystem::Type type,
+                     int const near)
 {
     assert(type.defined() && "Trying to allocate undefined type");
 
     if (!ident.empty() && find(ident, scope, false) != -1)
         return  -1;
 
-    int const addr = findFree(type.size());
+    // Named variables are placed at their requested address (as given by a layout-profile)
+    // even when this lies outside the current footprint.
+    // Multi-dimensional arrays need an additional scratch-cell for each additional index
+    int const dims = type.dimensions().size();
+    int const header = (type.isIntType() && type.size() > 1) ? ArrayHeaderSize + std::max(dims - 1, 0) : 0;
+    int const addr = findFreeNear(type.size() + header, near, ident.empty()) + header;
     if (addr + type.size() > d_maxAddr)
         d_maxAddr = addr + type.size();
+
+    for (int i = 1; i <= header; ++i)
+    {
+        Cell &cell = write(addr - i);
+        cell.clear();
+        cell.type = TypeSystem::Type(1);
+        cell.content = Content::REFERENCED;
+    }
     
-    Cell &cell = d_memory[addr];
+    Cell &cell = write(addr);
     cell.clear();
     cell.identifier = ident;
     cell.scope = scope;
     cell.content = ident.empty() ? Content::TEMP : Content::NAMED;
     cell.type = type;
+    cell.header = header;
+    link(addr);
     
     place(type, addr);
+    addCellsInUse(type.size() + header);
     return addr;
 }
 
 void Memory::addAlias(int const addr, std::string const &ident, std::string const &scope)
 {
     assert(find(ident, scope, false) == -1 && "alias identifier already exists");
-    d_aliasMap[addr].push_back({ident, scope});
+    modifyAliases(addr).push_back({ident, scope});
 }
 
 void Memory::removeAlias(int const addr, std::string const &ident, std::string const &scope)
 {
     assert(d_aliasMap.find(addr) != d_aliasMap.end() && "trying to erase non existent alias");
     
-    std::erase_if(d_aliasMap[addr],
+    std::erase_if(modifyAliases(addr),
                   [&](auto const &pr){
                       return pr.first == ident && pr.second == scope;
                   });
@@ -96,11 +336,11 @@ void Memory::removeAlias(int const addr, std::string const &ident, std::string c
 
 void Memory::place(TypeSystem::Type type, int const addr, bool const recursive)
 {
-    if (type.isIntType())
+    if (!type.isStructType())
     {
         for (int i = 1; i != type.size(); ++i)
         {
-            Cell &cell = d_memory[addr + i];
+            Cell &cell = write(addr + i);
             cell.clear();
             cell.type = TypeSystem::Type(1);
             cell.content = Content::REFERENCED;
@@ -110,7 +350,7 @@ void Memory::place(TypeSystem::Type type, int const addr, bool const recursive)
 
     if (recursive)
     {
-        Cell &cell = d_memory[addr];
+        Cell &cell = write(addr);
         cell.clear();
         cell.content = Content::REFERENCED;
         cell.type = type;
@@ -124,14 +364,14 @@ void Memory::place(TypeSystem::Type type, int const addr, bool const recursive)
             continue;
         }
 
-        Cell &cell = d_memory[addr + f.offset];
+        Cell &cell = write(addr + f.offset);
         cell.clear();
         cell.type = f.type;
         cell.content = Content::REFERENCED;
 
         for (int i = 1; i != f.type.size(); ++i)
         {
-            Cell &cell = d_memory[addr + f.offset + i];
+            Cell &cell = write(addr + f.offset + i);
             cell.clear();
             cell.type = TypeSystem::Type(1);
             cell.content = Content::REFERENCED;
@@ -214,29 +454,59 @@ int Memory::find(std::string const &ident, std::string const &scope, bool const
 
 void Memory::freeTemps(std::string const &scope)
 {
-    freeIf([&](Cell const &cell){
-               return cell.content == Content::TEMP &&
-                   cell.scope == scope;
-           });
+    freeIf(scope, [&](Cell const &cell){
+                      return cell.content == Content::TEMP;
+                  });
+}
+
+void Memory::freeVariable(int const addr)
+{
+    assert(d_memory[addr].content == Content::NAMED && "freeVariable called on unnamed cell");
+    free(addr);
+}
+
+bool Memory::hasArrayHeader(int const addr) const
+{
+    assert(addr >= 0 && addr < (int)d_memory.size() && "address out of bounds");
+    return d_memory[addr].header > 0;
+}
+
+int Memory::headerSize(int const addr) const
+{
+    assert(addr >= 0 && addr < (int)d_memory.size() && "address out of bounds");
+    return d_memory[addr].header;
+}
+
+bool Memory::aliased(int const addr) const
+{
+    // Check if an alias refers to any of the cells of the variable at addr
+    int const sz = d_memory[addr].size();
+    for (auto it = d_aliasMap.lower_bound(addr); it != d_aliasMap.end() && it->first < addr + sz; ++it)
+    {
+        if (!it->second.empty())
+            return true;
+    }
+    return false;
 }
 
 void Memory::freeLocals(std::string const &scope)
 {
     // Remove all aliases from this scope
+    auto const inScope = [&](auto const &pr) -> bool
+                         {
+                             return pr.second == scope;
+                         };
+    
     for (auto &pr: d_aliasMap)
     {
-        std::erase_if(pr.second,
-                      [&](auto const &pr2) -> bool
-                      {
-                          return pr2.second == scope;
-                      });
+        if (std::any_of(pr.second.begin(), pr.second.end(), inScope))
+            std::erase_if(modifyAliases(pr.first), inScope);
     }
 
     // Free all memory in this scope
-    freeIf([&](Cell const &cell){
-               return cell.scope == scope;
-           }
-        );
+    freeIf(scope, [&](Cell const &){
+                      return true;
+                  });
 }
 
 int Memory::sizeOf(int const addr) const
@@ -255,19 +525,25 @@ int Memory::sizeOf(std::string const &ident, std::string const &scope) const
 
 void Memory::markAsTemp(int const addr)
 {
-    assert(addr >= 0 && addr < (int)d_memory.size() && "address out of bounds");
-    Cell &cell = d_memory[addr];
-    
+    Cell &cell = modify(addr);
     cell.identifier = "";
     cell.content = Content::TEMP;
+    cell.literal = false;
 }
 
 void Memory::rename(int const addr, std::string const &ident, std::string const &scope)
 {
     assert(addr >= 0 && addr < (int)d_memory.size() && "address out of bounds");
-    Cell &cell = d_memory[addr];
+    if (d_memory[addr].scope != scope)
+    {
+        unlink(addr);
+        modify(addr).scope = scope;
+        link(addr);
+    }
+
+    Cell &cell = modify(addr);
     cell.identifier = ident;
-    cell.scope = scope;
+    cell.literal = false;
 
     cell.content = Content::NAMED;
 }
@@ -302,35 +578,117 @@ TypeSystem::Type Memory::type(std::string const &ident, std::string const &scope
     return d_memory[addr].type;
 }
 
-int Memory::value(int const addr) const
+long Memory::value(int const addr) const
 {
     assert(addr >= 0 && addr < (int)d_memory.size() && "address out of bounds");
     return d_memory[addr].value;
 }
 
-int &Memory::value(int const addr) 
+void Memory::setValue(int const addr, long const val)
 {
-    assert(addr >= 0 && addr < (int)d_memory.size() && "address out of bounds");
-    return d_memory[addr].value;
+    Cell &cell = write(addr);
+    cell.value = val;
+    cell.known = true;
+    cell.literal = false;
+    cell.lower = 0;
+    cell.upper = -1;
+    cell.pinned = false;
 }
 
 bool Memory::valueKnown(int const addr) const
 {
     assert(addr >= 0 && addr < (int)d_memory.size() && "address out of bounds");
-    return d_memory[addr].value != -1;
+    return d_memory[addr].known;
 }
 
 void Memory::setValueUnknown(int const addr)
+{
+    Cell &cell = write(addr);
+    cell.value = -1;
+    cell.known = false;
+    cell.synced = false;
+    cell.literal = false;
+    cell.lower = 0;
+    cell.upper = -1;
+    cell.pinned = false;
+}
+
+void Memory::markLiteral(int const addr)
+{
+    assert(valueKnown(addr) && "marking cell with unknown value as literal");
+    modify(addr).literal = true;
+}
+
+bool Memory::isLiteral(int const addr) const
 {
     assert(addr >= 0 && addr < (int)d_memory.size() && "address out of bounds");
-    d_memory[addr].value = -1;
-    setSync(addr, false);
+    return d_memory[addr].literal;
 }
 
-void Memory::setSync(int const addr, bool sync)
+void Memory::setRange(int const addr, int const lower, int const upper)
+{
+    assert(lower >= 0 && lower <= upper && "invalid range");
+    Cell &cell = modify(addr);
+    cell.lower = lower;
+    cell.upper = upper;
+}
+
+void Memory::pinRange(int const addr, int const lower, int const upper)
+{
+    setRange(addr, lower, upper);
+    modify(addr).pinned = true;
+}
+
+std::pair<int, int> Memory::range(int const addr) const
+{
+    assert(addr >= 0 && addr < (int)d_memory.size() && "address out of bounds");
+    return {d_memory[addr].lower, d_memory[addr].upper};
+}
+
+bool Memory::rangePinned(int const addr) const
+{
+    assert(addr >= 0 && addr < (int)d_memory.size() && "address out of bounds");
+    return d_memory[addr].pinned;
+}
+
+int Memory::version(int const addr) const
 {
     assert(addr >= 0 && addr < (int)d_memory.size() && "address out of bounds");
-    d_memory[addr].synced = sync;
+    return d_memory[addr].version;
+}
+
+bool Memory::modifiedSince(Checkpoint const &cp) const
+{
+    // Only cells that were in use at the checkpoint count. The first entry of a cell
+    // in the undo-log holds its state at the checkpoint.
+    std::set<int> seen;
+    for (size_t idx = cp.cellLogSize; idx != d_cellLog.size(); ++idx)
+    {
+        auto const &[addr, cell] = d_cellLog[idx];
+        if (seen.insert(addr).second && !cell.empty() && cell.version != d_memory[addr].version)
+            return true;
+    }
+
+    return false;
+}
+
+std::set<int> Memory::writtenSince(Checkpoint const &cp) const
+{
+    std::set<int> seen;
+    std::set<int> written;
+    for (size_t idx = cp.cellLogSize; idx != d_cellLog.size(); ++idx)
+    {
+        auto const &[addr, cell] = d_cellLog[idx];
+        if (seen.insert(addr).second && cell.version != d_memory[addr].version)
+            written.insert(addr);
+    }
+
+    return written;
+}
+
+void Memory::setSync(int const addr, bool sync)
+{
+    modify(addr).synced = sync;
 }
 
 bool Memory::isSync(int const addr) const
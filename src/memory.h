@@ -2,15 +2,20 @@
 #define MEMORY_H
 
 #include <vector>
+#include <set>
+#include <algorithm>
 #include <iostream>
 #include <functional>
 #include <cassert>
-#include <stack>
 #include "typesystem.h"
 
 class Memory
 {
 public: 
+    // Number of scratch-cells reserved in front of each array, which are
+    // used by BFGenerator to walk the array when it is indexed at runtime.
+    static constexpr int ArrayHeaderSize = 4;
+    
     enum class Content
         {
          EMPTY,
@@ -26,8 +31,24 @@ private:
         std::string      scope;
         Content          content{Content::EMPTY};
         TypeSystem::Type type;
-        int              value{0};
+        long             value{0};
+        bool             known{true};
         bool             synced{false};
+
+        // Intrusive links into the list of cells owned by the same scope
+        int              prev{-1};
+        int              next{-1};
+        // Number of scratch-cells preceding an array (see headerSize())
+        int              header{0};
+        // Temporary holding a literal, whose value is known even in runtime loops
+        bool             literal{false};
+        // Bounds of an unknown value (upper == -1: unbounded). A pinned range
+        // holds throughout a runtime loop until the cell is written to.
+        int              lower{0};
+        int              upper{-1};
+        bool             pinned{false};
+        // Changes whenever the value of the cell changes or the cell is (re)allocated
+        int              version{0};
         
         void clear();
         bool empty() const
@@ -39,31 +60,46 @@ private:
         {
             return type.size();
         }
-
-    private:
-        using Members = std::tuple<std::string, // identifier
-                                   std::string, // scope
-                                   Content      // content
-                                   >;
-
-        std::stack<Members> d_backupStack;
     };
 
+    using AliasVector = std::vector<std::pair<std::string, std::string>>;
+    
     std::vector<Memory::Cell> d_memory;
-    std::map<int, std::vector<std::pair<std::string, std::string>>> d_aliasMap;
+    std::map<int, AliasVector> d_aliasMap;
+    std::map<std::string, int> d_scopeHead;
     
     int d_maxAddr{0};
+    int d_cellsInUse{0};
+    int d_peakCellsInUse{0};
+    int d_versions{0};
+
+    // Undo-logs, only recorded while a checkpoint is active
+    int d_checkpoints{0};
+    std::vector<std::pair<int, Cell>>         d_cellLog;
+    std::vector<std::pair<std::string, int>>  d_headLog;
+    std::vector<std::pair<int, AliasVector>>  d_aliasLog;
     
 public:
+    struct Checkpoint
+    {
+        size_t cellLogSize;
+        size_t headLogSize;
+        size_t aliasLogSize;
+        int    maxAddr;
+        int    cellsInUse;
+        int    peakCellsInUse;
+    };
+    
     Memory(size_t sz):
         d_memory(sz)
     {}
 
     size_t size() const;
-    int getTemp(std::string const &scope, TypeSystem::Type type);
-    int getTemp(std::string const &scope, int const sz = 1);
-    int getTempBlock(std::string const &scope, int const sz);
-    int allocate(std::string const &ident, std::string const &scope, TypeSystem::Type type);
+    int getTemp(std::string const &scope, TypeSystem::Type type, int const near = -1);
+    int getTemp(std::string const &scope, int const sz = 1, int const near = -1);
+    int getTempBlock(std::string const &scope, int const sz, int const near = -1);
+    int allocate(std::string const &ident, std::string const &scope, TypeSystem::Type type,
+                 int const near = -1);
     void addAlias(int const addr, std::string const &ident, std::string const &scope);
     void removeAlias(int const addr, std::string const &ident, std::string const &scope);
     
@@ -72,13 +108,26 @@ public:
     int sizeOf(std::string const &ident, std::string const &scope) const;
     void freeTemps(std::string const &scope);
     void freeLocals(std::string const &scope);
+    void freeVariable(int const addr);
+    bool aliased(int const addr) const;
+    bool hasArrayHeader(int const addr) const;
+    int headerSize(int const addr) const;
     void markAsTemp(int const addr);
     void rename(int const addr, std::string const &ident, std::string const &scope);
     bool isTemp(int const addr) const;
-    int value(int const addr) const;
-    int &value(int const addr);
+    long value(int const addr) const;
+    void setValue(int const addr, long const val);
     bool valueKnown(int const addr) const;
     void setValueUnknown(int const addr);
+    void markLiteral(int const addr);
+    bool isLiteral(int const addr) const;
+    void setRange(int const addr, int const lower, int const upper);
+    void pinRange(int const addr, int const lower, int const upper);
+    std::pair<int, int> range(int const addr) const;
+    bool rangePinned(int const addr) const;
+    int version(int const addr) const;
+    bool modifiedSince(Checkpoint const &cp) const;
+    std::set<int> writtenSince(Checkpoint const &cp) const;
     void setSync(int const addr, bool val);
     bool isSync(int const addr) const;
     std::string identifier(int const addr) const;
@@ -91,14 +140,32 @@ public:
         return d_maxAddr;
     }
 
+    size_t peakCellsInUse() const
+    {
+        return d_peakCellsInUse;
+    }
+
+    Checkpoint checkpoint();
+    void rollback(Checkpoint const &cp);
+    void commit(Checkpoint const &cp);
+
     void dump() const;
     
 private:    
+    Cell &modify(int const addr);
+    Cell &write(int const addr);
+    void setHead(std::string const &scope, int const addr);
+    AliasVector &modifyAliases(int const addr);
     int findFree(int sz = 1);
+    int findFreeNear(int const sz, int const near, bool const confined);
     void place(TypeSystem::Type type, int const addr, bool const recursive = false);
+    void link(int const addr);
+    void unlink(int const addr);
+    void free(int const addr);
+    void addCellsInUse(int const n);
 
     template <typename Predicate>
-    void freeIf(Predicate &&pred);
+    void freeIf(std::string const &scope, Predicate &&pred);
 };
 
 inline size_t Memory::size() const
@@ -107,23 +174,21 @@ inline size_t Memory::size() const
 }
 
 template <typename Predicate>
-void Memory::freeIf(Predicate&& pred)
+void Memory::freeIf(std::string const &scope, Predicate&& pred)
 {
-    for (size_t idx = 0; idx < d_memory.size(); ++idx)
+    // Only walk the cells owned by this scope
+    auto const it = d_scopeHead.find(scope);
+    if (it == d_scopeHead.end())
+        return;
+    
+    int addr = it->second;
+    while (addr != -1)
     {
-        Cell &cell = d_memory[idx];
-        if (pred(cell))
-        {
-            for (int offset = 1; offset < cell.size(); ++offset)
-            {
-                Cell &referenced = d_memory[idx + offset];
-                referenced.clear();
-            }
-            cell.clear();
-            idx += cell.size();
-        }
+        int const next = d_memory[addr].next;
+        if (pred(static_cast<Cell const &>(d_memory[addr])))
+            free(addr);
+        addr = next;
     }
-
 }
 
 
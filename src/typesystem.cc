@@ -21,9 +21,9 @@ namespace TypeSystem
             d_valid{false}
         {}
 
-        void addField(std::string const &name, Type const &type)
+        void addField(std::string const &name, Type const &type, int const offset)
         {
-            d_fields.emplace_back(Field{name, d_size, type});
+            d_fields.emplace_back(Field{name, offset, type});
             d_size += type.size();
         }
         
@@ -45,15 +45,21 @@ namespace TypeSystem
 
     static std::map<std::string, StructDefinition> typeMap;
 
-    static std::string intName(int const sz)
+    static std::string intName(int const sz, std::vector<int> const &dims)
     {
-        return "__int_" + std::to_string(sz) + "__";
+        if (dims.size() < 2)
+            return "__int_" + std::to_string(sz) + "__";
+
+        std::string name = "__int";
+        for (int const dim: dims)
+            name += '_' + std::to_string(dim);
+        return name + "__";
     }
 }
 
 int TypeSystem::Type::size() const
 {
-    if (isIntType())
+    if (isIntType() || isWideType())
         return d_size;
 
     auto const it = TypeSystem::typeMap.find(d_name);
@@ -65,12 +71,12 @@ int TypeSystem::Type::size() const
 
 std::string TypeSystem::Type::name() const
 {
-    return isStructType() ? d_name : TypeSystem::intName(d_size);
+    return (isStructType() || isWideType()) ? d_name : TypeSystem::intName(d_size, d_dims);
 }
 
 bool TypeSystem::Type::defined() const
 {
-    if (isIntType() || isNullType())
+    if (!isStructType())
         return true;
             
     auto const it = TypeSystem::typeMap.find(name());
@@ -84,6 +90,12 @@ std::vector<TypeSystem::Field> TypeSystem::Type::fields() const
     return typeMap.at(name()).fields();
 }
 
+std::vector<int> const &TypeSystem::Type::dimensions() const
+{
+    // Empty unless the type was declared with more than one dimension
+    return d_dims;
+}
+
 bool TypeSystem::Type::operator==(Type const &other) const
 {
     return name() == other.name();
@@ -94,6 +106,11 @@ bool TypeSystem::Type::isIntType() const
     return d_kind == Kind::INT;
 }
 
+bool TypeSystem::Type::isWideType() const
+{
+    return d_kind == Kind::WIDE;
+}
+
 bool TypeSystem::Type::isStructType() const
 {
     return d_kind == Kind::STRUCT;
@@ -105,15 +122,27 @@ bool TypeSystem::Type::isNullType() const
 }
 
 bool TypeSystem::add(std::string const &name,
-                     std::vector<std::pair<std::string, Type>> const &fields)
+                     std::vector<std::pair<std::string, Type>> const &fields,
+                     std::vector<size_t> const &placement)
 {
     if (typeMap.find(name) != typeMap.end())
         return false;
+
+    // Fields are laid out in the order given by placement (declaration order by
+    // default), but are always listed in declaration order.
+    std::vector<int> offsets(fields.size());
+    int offset = 1;
+    for (size_t i = 0; i != fields.size(); ++i)
+    {
+        size_t const idx = placement.empty() ? i : placement[i];
+        offsets[idx] = offset;
+        offset += fields[idx].second.size();
+    }
         
     StructDefinition s(name);
-    for (auto const &f: fields)
+    for (size_t i = 0; i != fields.size(); ++i)
     {
-        s.addField(f.first, f.second);
+        s.addField(fields[i].first, fields[i].second, offsets[i]);
     }
 
     typeMap.insert({name, s});
@@ -4,6 +4,7 @@
 #include <map>
 #include <variant>
 #include <vector>
+#include <numeric>
 #include <cassert>
 
 namespace TypeSystem
@@ -16,12 +17,14 @@ namespace TypeSystem
             {
              NULLTYPE,
              INT,
+             WIDE,
              STRUCT
             };
 
         int d_size{-1};
         std::string d_name{""};
         Kind d_kind{Kind::NULLTYPE};
+        std::vector<int> d_dims;
         
     public:
         Type() = default;
@@ -36,12 +39,28 @@ namespace TypeSystem
             d_kind(Kind::INT)
         {}
 
+        // Single integer spanning multiple cells (least significant cell first)
+        Type(std::string const &name, int const sz):
+            d_size(sz),
+            d_name(name),
+            d_kind(Kind::WIDE)
+        {}
+
+        // Multi-dimensional array, stored row after row (last index varies fastest)
+        Type(std::vector<int> const &dims):
+            d_size(std::accumulate(dims.begin(), dims.end(), 1, std::multiplies<int>())),
+            d_kind(Kind::INT),
+            d_dims(dims)
+        {}
+
         int size() const;
         std::string name() const;
         bool defined() const;
         std::vector<Field> fields() const;
+        std::vector<int> const &dimensions() const;
         bool operator==(Type const &other) const;
         bool isIntType() const;
+        bool isWideType() const;
         bool isStructType() const;
         bool isNullType() const;
     };
@@ -55,7 +74,8 @@ namespace TypeSystem
 
 
     bool add(std::string const &name,
-             std::vector<std::pair<std::string, Type>> const &fields);
+             std::vector<std::pair<std::string, Type>> const &fields,
+             std::vector<size_t> const &placement = {});
 };
 
 #endif // TYPES_H